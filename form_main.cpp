@@ -8,16 +8,26 @@
 #include "structures/vector/vector.h"
 #include "structures/array/array.h"
 #include "structures/list/array_list.h"
+#include "structures/list/small_array_list.h"
 #include "structures/list/linked_list.h"
+#include "structures/list/unrolled_linked_list.h"
+#include "structures/list/cyclical_list.h"
+#include "structures/list/rope_list.h"
+#include "structures/list/tiered_vector_list.h"
 #include "structures/stack/implicit_stack.h"
 #include "structures/stack/explicit_stack.h"
+#include "structures/stack/segmented_stack.h"
 #include "structures/queue/implicit_queue.h"
 #include "structures/queue/explicit_queue.h"
 #include "structures/priority_queue/priority_queue_sorted_array_list.h"
 #include "structures/priority_queue/priority_queue_unsorted_array_list.h"
 #include "structures/priority_queue/priority_queue_linked_list.h"
 #include "structures/priority_queue/priority_queue_two_lists.h"
+#include "structures/priority_queue/priority_queue_double_layer.h"
 #include "structures/priority_queue/heap.h"
+#include "structures/priority_queue/pairing_heap.h"
+#include "structures/priority_queue/radix_heap.h"
+#include "structures/priority_queue/bucket_queue.h"
 #include "structures/tree/multi_way_tree.h"
 #include "structures/tree/k_way_tree.h"
 #include "structures/tree/binary_tree.h"
@@ -70,11 +80,17 @@ namespace ui
 		factory->registerPrototype(structures::StructureADS::adsARRAY, new structures::Array<data::DataType>(10));
 
 		factory->registerPrototype(structures::StructureADS::adsLIST_ARRAY, new structures::ArrayList<data::DataType>());
+		factory->registerPrototype(structures::StructureADS::adsLIST_SMALL_ARRAY, new structures::SmallArrayList<data::DataType>());
 
 		factory->registerPrototype(structures::StructureADS::adsLIST_LINKED, new structures::LinkedList<data::DataType>());
+		factory->registerPrototype(structures::StructureADS::adsLIST_UNROLLED, new structures::UnrolledLinkedList<data::DataType>());
+		factory->registerPrototype(structures::StructureADS::adsLIST_CYCLICAL, new structures::CyclicalList<data::DataType>());
+		factory->registerPrototype(structures::StructureADS::adsLIST_ROPE, new structures::RopeList<data::DataType>());
+		factory->registerPrototype(structures::StructureADS::adsLIST_TIERED_VECTOR, new structures::TieredVectorList<data::DataType>());
 
 		factory->registerPrototype(structures::StructureADS::adsSTACK_ARRAY, new structures::ImplicitStack<data::DataType>());
 		factory->registerPrototype(structures::StructureADS::adsSTACK_LIST, new structures::ExplicitStack<data::DataType>());
+		factory->registerPrototype(structures::StructureADS::adsSTACK_SEGMENTED, new structures::SegmentedStack<data::DataType>());
 
 		factory->registerPrototype(structures::StructureADS::adsQUEUE_ARRAY, new structures::ImplicitQueue<data::DataType>());
 		factory->registerPrototype(structures::StructureADS::adsQUEUE_LIST, new structures::ExplicitQueue<data::DataType>());
@@ -83,7 +99,15 @@ namespace ui
 		factory->registerPrototype(structures::StructureADS::adsPRIORITY_QUEUE_ARRAY_LIST_UNSORTED, new structures::PriorityQueueUnsortedArrayList<data::DataType>());
 		factory->registerPrototype(structures::StructureADS::adsPRIORITY_QUEUE_LINKED_LIST, new structures::PriorityQueueLinkedList<data::DataType>());
 		factory->registerPrototype(structures::StructureADS::adsPRIORITY_QUEUE_TWO_LISTS, new structures::PriorityQueueTwoLists<data::DataType>());
+		factory->registerPrototype(structures::StructureADS::adsPRIORITY_QUEUE_DOUBLE_LAYER, new structures::PriorityQueueDoubleLayer<data::DataType>());
 		factory->registerPrototype(structures::StructureADS::adsPRIORITY_QUEUE_HEAP, new structures::Heap<data::DataType>());
+		factory->registerPrototype(structures::StructureADS::adsPRIORITY_QUEUE_PAIRING_HEAP, new structures::PairingHeap<data::DataType>());
+		// Radix heap a bucket queue su urcene pre monotonne pouzitie (priorita vkladanych prvkov neklesne pod poslednu odobratu).
+		// Undo popu vracia do frontu uz odobrate priority, kontrola monotonnosti sa preto v UI vypina. Vlozenie pod poslednu odobratu
+		// prioritu ale stoji O(n) v radix heape (prerozdelenie vedier) a O(bucketCount) v bucket queue (posun okna), nemonotonne
+		// casy v grafe preto nezodpovedaju ich beznemu pouzitiu.
+		factory->registerPrototype(structures::StructureADS::adsPRIORITY_QUEUE_RADIX_HEAP, new structures::RadixHeap<data::DataType>(false));
+		factory->registerPrototype(structures::StructureADS::adsPRIORITY_QUEUE_BUCKET_QUEUE, new structures::BucketQueue<data::DataType>(1024, false));
 
 		factory->registerPrototype(structures::StructureADS::adsTREE_MULTI_WAY, new structures::MultiWayTree<data::DataType>());
 		factory->registerPrototype(structures::StructureADS::adsTREE_K_WAY, new structures::KWayTree<data::DataType, 5>());
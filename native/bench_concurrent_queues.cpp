@@ -0,0 +1,150 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/queue/spsc_queue.h"
+#include "../structures/queue/mpmc_queue.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Vypise priepustnost ako doplnok k nameranemu casu. </summary>
+		void reportThroughput(const char* structure, const char* operation, long long items, long long milliseconds)
+		{
+			NativeRoutines::report(structure, operation, milliseconds);
+			if (milliseconds > 0)
+			{
+				std::printf("  %-28s %-32s %8lld M items/s\n", "", "", items / milliseconds / 1000);
+			}
+		}
+	}
+
+	void benchSpscQueue()
+	{
+		const long long count = 50000000;
+		const size_t batchSize = 64;
+		std::printf("  1 producer, 1 consumer, %lld items, capacity 1024\n", count);
+
+		{
+			structures::SpscQueue<long long> queue(1024);
+			Stopwatch stopwatch;
+			std::thread consumer([&]()
+			{
+				long long sum = 0;
+				long long item;
+				for (long long received = 0; received < count; )
+				{
+					if (queue.tryPop(item))
+					{
+						sum += item;
+						received++;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+				NativeRoutines::consume(sum);
+			});
+			for (long long i = 0; i < count; i++)
+			{
+				while (!queue.tryPush(i))
+				{
+					std::this_thread::yield();
+				}
+			}
+			consumer.join();
+			reportThroughput("SpscQueue<long long>", "tryPush/tryPop", count, stopwatch.elapsedMs());
+		}
+
+		{
+			structures::SpscQueue<long long> queue(1024);
+			Stopwatch stopwatch;
+			std::thread consumer([&]()
+			{
+				std::vector<long long> target(batchSize);
+				long long sum = 0;
+				for (long long received = 0; received < count; )
+				{
+					const size_t popped = queue.popBatch(target.data(), batchSize);
+					for (size_t i = 0; i < popped; i++)
+					{
+						sum += target[i];
+					}
+					received += static_cast<long long>(popped);
+					if (popped == 0)
+					{
+						std::this_thread::yield();
+					}
+				}
+				NativeRoutines::consume(sum);
+			});
+			std::vector<long long> items(batchSize);
+			for (long long sent = 0; sent < count; )
+			{
+				const size_t prepared = static_cast<size_t>(std::min<long long>(batchSize, count - sent));
+				for (size_t i = 0; i < prepared; i++)
+				{
+					items[i] = sent + static_cast<long long>(i);
+				}
+				size_t offset = 0;
+				while (offset < prepared)
+				{
+					const size_t pushed = queue.pushBatch(items.data() + offset, prepared - offset);
+					offset += pushed;
+					if (pushed == 0)
+					{
+						std::this_thread::yield();
+					}
+				}
+				sent += static_cast<long long>(prepared);
+			}
+			consumer.join();
+			reportThroughput("SpscQueue<long long>", "pushBatch/popBatch (64)", count, stopwatch.elapsedMs());
+		}
+	}
+
+	void benchMpmcQueue()
+	{
+		const long long perProducer = 5000000;
+		const int pairs[] = { 1, 2, 4 };
+		for (int count : pairs)
+		{
+			structures::MpmcQueue<long long> queue(1024);
+			Stopwatch stopwatch;
+			std::vector<std::thread> threads;
+			for (int producer = 0; producer < count; producer++)
+			{
+				threads.emplace_back([&queue, perProducer]()
+				{
+					for (long long i = 0; i < perProducer; i++)
+					{
+						queue.pushWait(std::move(i));
+					}
+				});
+			}
+			for (int consumer = 0; consumer < count; consumer++)
+			{
+				threads.emplace_back([&queue, perProducer]()
+				{
+					long long sum = 0;
+					for (long long i = 0; i < perProducer; i++)
+					{
+						sum += queue.popWait();
+					}
+					NativeRoutines::consume(sum);
+				});
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+			const std::string operation = std::to_string(count) + " producers, " + std::to_string(count) + " consumers";
+			reportThroughput("MpmcQueue<long long>", operation.c_str(), count * perProducer, stopwatch.elapsedMs());
+		}
+	}
+}
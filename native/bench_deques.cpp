@@ -0,0 +1,77 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/deque/work_stealing_deque.h"
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace native {
+
+	void benchWorkStealingDeque()
+	{
+		const int count = 10000000;
+		std::printf("  owner pushes %d items, pops every other one\n", count);
+
+		const int thieveCounts[] = { 0, 1, 3 };
+		for (int thieves : thieveCounts)
+		{
+			structures::WorkStealingDeque<int> deque;
+			std::atomic<bool> done(false);
+			std::atomic<long long> stolen(0);
+			Stopwatch stopwatch;
+
+			std::vector<std::thread> threads;
+			for (int thief = 0; thief < thieves; thief++)
+			{
+				threads.emplace_back([&deque, &done, &stolen]()
+				{
+					long long local = 0;
+					int item;
+					while (!done.load(std::memory_order_acquire) || deque.size() > 0)
+					{
+						if (deque.trySteal(item))
+						{
+							local++;
+						}
+						else
+						{
+							std::this_thread::yield();
+						}
+					}
+					stolen += local;
+				});
+			}
+
+			long long sum = 0;
+			int item;
+			for (int i = 0; i < count; i++)
+			{
+				deque.push(i);
+				if (i % 2 == 1 && deque.tryPop(item))
+				{
+					sum += item;
+				}
+			}
+			while (deque.tryPop(item))
+			{
+				sum += item;
+			}
+			done.store(true, std::memory_order_release);
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+			NativeRoutines::consume(sum);
+
+			const std::string operation = "push/tryPop, " + std::to_string(thieves) + " thieves";
+			NativeRoutines::report("WorkStealingDeque<int>", operation.c_str(), stopwatch.elapsedMs());
+			if (thieves > 0)
+			{
+				std::printf("  %-28s %-32s %8lld stolen\n", "", "", stolen.load());
+			}
+		}
+	}
+}
@@ -0,0 +1,128 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/list/array_list.h"
+#include "../structures/list/linked_list.h"
+#include "../structures/list/tiered_vector_list.h"
+#include "../structures/list/unrolled_linked_list.h"
+
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace native {
+
+	namespace {
+		/// <summary> Vlozi count prvkov na nahodne pozicie, potom cita nahodne indexy a nakoniec odoberie polovicu prvkov z nahodnych pozicii. </summary>
+		/// <param name = "name"> Nazov struktury vo vypise. </param>
+		/// <param name = "count"> Pocet vkladanych prvkov. </param>
+		/// <param name = "reads"> Pocet citani. </param>
+		template<typename L>
+		void benchPositional(const char* name, int count, int reads)
+		{
+			std::mt19937 random(1);
+			L list;
+
+			Stopwatch stopwatch;
+			for (int i = 0; i < count; i++)
+			{
+				list.insert(i, static_cast<int>(random() % (list.size() + 1)));
+			}
+			NativeRoutines::report(name, ("insert x" + std::to_string(count)).c_str(), stopwatch.elapsedMs());
+
+			stopwatch.restart();
+			long long sum = 0;
+			for (int i = 0; i < reads; i++)
+			{
+				sum += list[static_cast<int>(random() % count)];
+			}
+			NativeRoutines::consume(sum);
+			NativeRoutines::report(name, ("operator[] x" + std::to_string(reads)).c_str(), stopwatch.elapsedMs());
+
+			stopwatch.restart();
+			for (int i = 0; i < count / 2; i++)
+			{
+				list.removeAt(static_cast<int>(random() % list.size()));
+			}
+			NativeRoutines::report(name, ("removeAt x" + std::to_string(count / 2)).c_str(), stopwatch.elapsedMs());
+		}
+
+		/// <summary> Prejde zoznam s count prvkami desatkrat cez indexy a desatkrat iteratorom. </summary>
+		/// <param name = "name"> Nazov struktury vo vypise. </param>
+		/// <param name = "count"> Pocet prvkov. </param>
+		template<typename L>
+		void benchScan(const char* name, int count)
+		{
+			L list;
+			for (int i = 0; i < count; i++)
+			{
+				list.add(i);
+			}
+
+			Stopwatch stopwatch;
+			long long sum = 0;
+			for (int pass = 0; pass < 10; pass++)
+			{
+				for (int i = 0; i < count; i++)
+				{
+					sum += list[i];
+				}
+			}
+			NativeRoutines::consume(sum);
+			NativeRoutines::report(name, "scan by index x10", stopwatch.elapsedMs());
+
+			stopwatch.restart();
+			sum = 0;
+			for (int pass = 0; pass < 10; pass++)
+			{
+				for (int item : list)
+				{
+					sum += item;
+				}
+			}
+			NativeRoutines::consume(sum);
+			NativeRoutines::report(name, "scan by iterator x10", stopwatch.elapsedMs());
+		}
+	}
+
+	void benchTieredVectorList()
+	{
+		const int linkedCounts[] = { 20000, 50000 };
+		for (int count : linkedCounts)
+		{
+			std::printf("  n = %d, positions uniformly random\n", count);
+			benchPositional<structures::ArrayList<int>>("ArrayList<int>", count, 100000);
+			benchPositional<structures::LinkedList<int>>("LinkedList<int>", count, 100000);
+			benchPositional<structures::TieredVectorList<int>>("TieredVectorList<int>", count, 100000);
+		}
+
+		// LinkedList by pri vacsich poctoch bezal desiatky minut.
+		const int counts[] = { 200000, 1000000 };
+		for (int count : counts)
+		{
+			std::printf("  n = %d, positions uniformly random\n", count);
+			benchPositional<structures::ArrayList<int>>("ArrayList<int>", count, 100000);
+			benchPositional<structures::TieredVectorList<int>>("TieredVectorList<int>", count, 100000);
+		}
+	}
+
+	void benchUnrolledLinkedList()
+	{
+		std::printf("  n = 20000, positions uniformly random\n");
+		benchPositional<structures::ArrayList<int>>("ArrayList<int>", 20000, 100000);
+		benchPositional<structures::LinkedList<int>>("LinkedList<int>", 20000, 100000);
+		benchPositional<structures::UnrolledLinkedList<int>>("UnrolledLinkedList<int>", 20000, 100000);
+
+		const int counts[] = { 50000, 200000 };
+		for (int count : counts)
+		{
+			std::printf("  n = %d, positions uniformly random\n", count);
+			benchPositional<structures::ArrayList<int>>("ArrayList<int>", count, 100000);
+			benchPositional<structures::UnrolledLinkedList<int>>("UnrolledLinkedList<int>", count, 100000);
+		}
+
+		std::printf("  n = 50000, full scans\n");
+		benchScan<structures::ArrayList<int>>("ArrayList<int>", 50000);
+		benchScan<structures::LinkedList<int>>("LinkedList<int>", 50000);
+		benchScan<structures::UnrolledLinkedList<int>>("UnrolledLinkedList<int>", 50000);
+	}
+}
@@ -0,0 +1,208 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/priority_queue/heap.h"
+#include "../structures/priority_queue/pairing_heap.h"
+#include "../structures/priority_queue/radix_heap.h"
+#include "../structures/priority_queue/bucket_queue.h"
+#include "../structures/priority_queue/priority_queue_double_layer.h"
+#include "../structures/priority_queue/priority_queue_two_lists.h"
+#include "../structures/priority_queue/priority_queue_sorted_array_list.h"
+#include "../structures/priority_queue/priority_queue_unsorted_array_list.h"
+#include "../structures/priority_queue/priority_queue_linked_list.h"
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Vlozi count prvkov s nahodnymi prioritami a potom ich vsetky odoberie, kazdu fazu meria zvlast. </summary>
+		/// <param name = "name"> Nazov struktury vo vypise. </param>
+		/// <param name = "queue"> Prazdny prioritny front. </param>
+		/// <param name = "count"> Pocet prvkov. </param>
+		void benchPushThenPop(const char* name, structures::PriorityQueue<int>& queue, int count)
+		{
+			std::mt19937 random(1);
+			Stopwatch stopwatch;
+			for (int i = 0; i < count; i++)
+			{
+				queue.push(static_cast<int>(random() % 1000000000), i);
+			}
+			NativeRoutines::report(name, "push", stopwatch.elapsedMs());
+
+			stopwatch.restart();
+			long long sum = 0;
+			for (int i = 0; i < count; i++)
+			{
+				sum += queue.pop();
+			}
+			NativeRoutines::consume(sum);
+			NativeRoutines::report(name, "pop", stopwatch.elapsedMs());
+		}
+
+		/// <summary>
+		/// Monotonna zataz ako pri hladani najkratsich ciest: po naplneni kazdy krok odoberie minimum a vlozi prvok
+		/// s prioritou o nahodnu hodnotu 1..1000 vacsou, nez mala odobrana.
+		/// </summary>
+		/// <param name = "name"> Nazov struktury vo vypise. </param>
+		/// <param name = "queue"> Prazdny prioritny front. </param>
+		/// <param name = "count"> Pocet prvkov po naplneni. </param>
+		/// <param name = "steps"> Pocet krokov pop + push. </param>
+		void benchMonotone(const char* name, structures::PriorityQueue<int>& queue, int count, int steps)
+		{
+			std::mt19937 random(1);
+			for (int i = 0; i < count; i++)
+			{
+				queue.push(static_cast<int>(random() % 1000), i);
+			}
+
+			Stopwatch stopwatch;
+			long long sum = 0;
+			for (int i = 0; i < steps; i++)
+			{
+				const int priority = queue.peekPriority();
+				sum += queue.pop();
+				queue.push(priority + 1 + static_cast<int>(random() % 1000), i);
+			}
+			NativeRoutines::consume(sum);
+			NativeRoutines::report(name, "pop + push", stopwatch.elapsedMs());
+		}
+
+		/// <summary> Vlozi count prvkov s nahodnymi prioritami, vykona count krokov pop + push a nakoniec vsetko odoberie. </summary>
+		/// <param name = "name"> Nazov struktury vo vypise. </param>
+		/// <param name = "queue"> Prazdny prioritny front. </param>
+		/// <param name = "count"> Pocet prvkov. </param>
+		void benchMixed(const char* name, structures::PriorityQueue<int>& queue, int count)
+		{
+			std::mt19937 random(1);
+			Stopwatch stopwatch;
+			long long sum = 0;
+			for (int i = 0; i < count; i++)
+			{
+				queue.push(static_cast<int>(random() % 1000000000), i);
+			}
+			for (int i = 0; i < count; i++)
+			{
+				sum += queue.pop();
+				queue.push(static_cast<int>(random() % 1000000000), i);
+			}
+			for (int i = 0; i < count; i++)
+			{
+				sum += queue.pop();
+			}
+			NativeRoutines::consume(sum);
+			NativeRoutines::report(name, ("n = " + std::to_string(count)).c_str(), stopwatch.elapsedMs());
+		}
+
+		/// <summary> Vlozi count prvkov, count krat precita vrchol a vykona count krokov pop + push, kazdu fazu meria zvlast. </summary>
+		/// <param name = "name"> Nazov struktury vo vypise. </param>
+		/// <param name = "queue"> Prazdny prioritny front. </param>
+		/// <param name = "count"> Pocet prvkov. </param>
+		void benchPushPeekPop(const char* name, structures::PriorityQueue<int>& queue, int count)
+		{
+			std::mt19937 random(1);
+			Stopwatch stopwatch;
+			for (int i = 0; i < count; i++)
+			{
+				queue.push(static_cast<int>(random() % 1000000000), i);
+			}
+			NativeRoutines::report(name, "push", stopwatch.elapsedMs());
+
+			stopwatch.restart();
+			long long sum = 0;
+			for (int i = 0; i < count; i++)
+			{
+				sum += queue.peek() + queue.peekPriority();
+			}
+			NativeRoutines::report(name, "peek + peekPriority", stopwatch.elapsedMs());
+
+			stopwatch.restart();
+			for (int i = 0; i < count; i++)
+			{
+				sum += queue.pop();
+				queue.push(static_cast<int>(random() % 1000000000), i);
+			}
+			NativeRoutines::consume(sum);
+			NativeRoutines::report(name, "pop + push", stopwatch.elapsedMs());
+		}
+	}
+
+	void benchPairingHeap()
+	{
+		const int count = 1000000;
+		std::printf("  %d random pushes, then %d pops\n", count, count);
+		structures::PairingHeap<int> pairingHeap;
+		benchPushThenPop("PairingHeap<int>", pairingHeap, count);
+		structures::Heap<int> heap;
+		benchPushThenPop("Heap<int>", heap, count);
+
+		// Znizovanie priorit cez handle, pri ktorom ma parovacia halda O(1) amortizovane.
+		std::printf("  %d pushes, %d decreaseKey, then %d pops\n", count, count, count);
+		std::mt19937 random(1);
+		std::vector<structures::PairingHeap<int>::Handle> handles;
+		handles.reserve(count);
+		Stopwatch stopwatch;
+		for (int i = 0; i < count; i++)
+		{
+			handles.push_back(pairingHeap.insert(500000000 + static_cast<int>(random() % 500000000), i));
+		}
+		for (int i = 0; i < count; i++)
+		{
+			const structures::PairingHeap<int>::Handle& handle = handles[random() % count];
+			const int priority = pairingHeap.priorityOf(handle);
+			pairingHeap.decreaseKey(handle, priority - static_cast<int>(random() % (priority / 2 + 1)));
+		}
+		long long sum = 0;
+		while (pairingHeap.size() > 0)
+		{
+			sum += pairingHeap.pop();
+		}
+		NativeRoutines::consume(sum);
+		NativeRoutines::report("PairingHeap<int>", "push + decreaseKey + pop", stopwatch.elapsedMs());
+	}
+	void benchMonotonePriorityQueues()
+	{
+		const int count = 100000;
+		const int steps = 2000000;
+		std::printf("  %d items, then %d x (pop, push popped + rand(1..1000))\n", count, steps);
+		structures::Heap<int> heap;
+		benchMonotone("Heap<int>", heap, count, steps);
+		structures::PairingHeap<int> pairingHeap;
+		benchMonotone("PairingHeap<int>", pairingHeap, count, steps);
+		structures::RadixHeap<int> radixHeap;
+		benchMonotone("RadixHeap<int>", radixHeap, count, steps);
+		structures::BucketQueue<int> bucketQueue(1024);
+		benchMonotone("BucketQueue<int>(1024)", bucketQueue, count, steps);
+	}
+	void benchPriorityQueueDoubleLayer()
+	{
+		std::printf("  n random pushes, n x (pop + push), n pops\n");
+		const int counts[] = { 10000, 100000, 1000000, 10000000 };
+		for (int count : counts)
+		{
+			structures::Heap<int> heap;
+			benchMixed("Heap<int>", heap, count);
+			structures::PriorityQueueDoubleLayer<int> doubleLayer;
+			benchMixed("DoubleLayer<int>", doubleLayer, count);
+			// Pop v dvoch zoznamoch trva O(sqrt n), pri 1e7 prvkoch by meranie trvalo hodiny.
+			if (count <= 1000000)
+			{
+				structures::PriorityQueueTwoLists<int> twoLists;
+				benchMixed("TwoLists<int>", twoLists, count);
+			}
+		}
+	}
+	void benchPriorityQueueLists()
+	{
+		const int count = 20000;
+		std::printf("  n = %d, random priorities, every phase n times\n", count);
+		structures::PriorityQueueSortedArrayList<int> sorted;
+		benchPushPeekPop("SortedArrayList<int>", sorted, count);
+		structures::PriorityQueueUnsortedArrayList<int> unsorted;
+		benchPushPeekPop("UnsortedArrayList<int>", unsorted, count);
+		structures::PriorityQueueLinkedList<int> linked;
+		benchPushPeekPop("LinkedList<int>", linked, count);
+	}
+}
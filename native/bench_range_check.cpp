@@ -0,0 +1,64 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/array/array.h"
+#include "../structures/list/array_list.h"
+
+#include <cstdio>
+
+namespace native {
+
+	namespace {
+		/// <summary> Vrati nazov politiky DS_RANGE_CHECK, s ktorou bol program prelozeny. </summary>
+		const char* rangeCheckPolicy()
+		{
+#if DS_RANGE_CHECK == DS_RANGE_CHECK_ALWAYS
+			return "ALWAYS";
+#elif DS_RANGE_CHECK == DS_RANGE_CHECK_DEBUG
+			return structures::DSRoutines::isRangeCheckEnabled() ? "DEBUG (NDEBUG not defined)" : "DEBUG (NDEBUG defined)";
+#else
+			return "NEVER";
+#endif
+		}
+	}
+
+	// Politika sa vybera pri preklade, kazda sa meria v samostatnom preklade (vo Visual Studiu /p:DsRangeCheck=0|1|2).
+	void benchRangeCheck()
+	{
+		const int count = 1 << 20;
+		const int passes = 200;
+
+		structures::Array<int> array(count);
+		structures::ArrayList<int> list;
+		for (int i = 0; i < count; i++)
+		{
+			array[i] = i;
+			list.add(i);
+		}
+
+		std::printf("  DS_RANGE_CHECK = %s, %d passes over %d ints\n", rangeCheckPolicy(), passes, count);
+
+		Stopwatch stopwatch;
+		long long sum = 0;
+		for (int pass = 0; pass < passes; pass++)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				sum += array[i];
+			}
+		}
+		NativeRoutines::consume(sum);
+		NativeRoutines::report("Array<int>", "operator[]", stopwatch.elapsedMs());
+
+		stopwatch.restart();
+		sum = 0;
+		for (int pass = 0; pass < passes; pass++)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				sum += list[i];
+			}
+		}
+		NativeRoutines::consume(sum);
+		NativeRoutines::report("ArrayList<int>", "operator[]", stopwatch.elapsedMs());
+	}
+}
@@ -0,0 +1,102 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/search_routines.h"
+#include "../structures/list/array_list.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Nazov jadra vo vypise. </summary>
+		const char* kernelName(structures::SearchKernel kernel)
+		{
+			switch (kernel)
+			{
+			case structures::skSSE2:
+				return "SSE2";
+			case structures::skAVX2:
+				return "AVX2";
+			default:
+				return "scalar";
+			}
+		}
+
+		/// <summary> Odmeria vsetky dostupne jadra na poli count prvkov: hladanie chybajucej hodnoty a pocitanie vyskytov. </summary>
+		/// <param name = "typeName"> Nazov typu prvku vo vypise. </param>
+		/// <param name = "count"> Pocet prvkov pola. </param>
+		/// <param name = "totalItems"> Kolko prvkov spolu prejde kazde jadro v kazdej operacii. </param>
+		template<typename Lane>
+		void benchKernels(const char* typeName, int count, long long totalItems)
+		{
+			std::vector<Lane> items(count);
+			for (int i = 0; i < count; i++)
+			{
+				items[i] = static_cast<Lane>(i % 100);
+			}
+			const Lane missing = static_cast<Lane>(101);
+			const Lane present = static_cast<Lane>(7);
+			const long long passes = totalItems / count;
+
+			const structures::SearchKernel kernels[] = { structures::skSCALAR, structures::skSSE2, structures::skAVX2 };
+			for (structures::SearchKernel kernel : kernels)
+			{
+				if (!structures::SearchRoutines::isKernelSupported(kernel))
+				{
+					std::printf("  %-28s %s not supported on this CPU\n", typeName, kernelName(kernel));
+					continue;
+				}
+				const std::string name = std::string(typeName) + " " + kernelName(kernel);
+
+				Stopwatch stopwatch;
+				long long result = 0;
+				for (long long pass = 0; pass < passes; pass++)
+				{
+					result += structures::SearchRoutines::scanWith(kernel, items.data(), count, missing, false);
+				}
+				NativeRoutines::consume(result);
+				NativeRoutines::report(name.c_str(), "indexOf (missing)", stopwatch.elapsedMs());
+
+				stopwatch.restart();
+				result = 0;
+				for (long long pass = 0; pass < passes; pass++)
+				{
+					result += structures::SearchRoutines::scanWith(kernel, items.data(), count, present, true);
+				}
+				NativeRoutines::consume(result);
+				NativeRoutines::report(name.c_str(), "count", stopwatch.elapsedMs());
+			}
+		}
+	}
+
+	void benchSearch()
+	{
+		const int count = 1 << 14;
+		const long long totalItems = 1LL << 29;
+		std::printf("  %d items per array, %lld items scanned per row\n", count, totalItems);
+		benchKernels<std::int8_t>("int8", count, totalItems);
+		benchKernels<std::int16_t>("int16", count, totalItems);
+		benchKernels<std::int32_t>("int32", count, totalItems);
+		benchKernels<std::int64_t>("int64", count, totalItems);
+		benchKernels<float>("float", count, totalItems);
+		benchKernels<double>("double", count, totalItems);
+
+		// Cela cesta cez ArrayList, s automatickym vyberom jadra.
+		structures::ArrayList<int> list;
+		for (int i = 0; i < count; i++)
+		{
+			list.add(i % 100);
+		}
+		Stopwatch stopwatch;
+		long long result = 0;
+		for (long long pass = 0; pass < totalItems / count; pass++)
+		{
+			result += list.getIndexOf(101);
+		}
+		NativeRoutines::consume(result);
+		NativeRoutines::report("ArrayList<int>", "getIndexOf (missing)", stopwatch.elapsedMs());
+	}
+}
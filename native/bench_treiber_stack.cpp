@@ -0,0 +1,79 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/stack/treiber_stack.h"
+#include "../structures/stack/implicit_stack.h"
+
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Pocet vlakien v meraniach zasobnikov. </summary>
+		const int THREAD_COUNT = 4;
+		/// <summary> Pocet dvojic push a pop v kazdom vlakne. </summary>
+		const long long OPERATIONS = 500000;
+
+		/// <summary> Spusti THREAD_COUNT vlakien, kazde vykona OPERATIONS krat pushPop(i). </summary>
+		/// <param name = "pushPop"> Jedna dvojica push a pop, vracia odobrany prvok. </param>
+		/// <returns> Cas v milisekundach. </returns>
+		template<typename F>
+		long long runThreads(F pushPop)
+		{
+			Stopwatch stopwatch;
+			std::vector<std::thread> threads;
+			for (int thread = 0; thread < THREAD_COUNT; thread++)
+			{
+				threads.emplace_back([&pushPop]()
+				{
+					long long sum = 0;
+					for (long long i = 0; i < OPERATIONS; i++)
+					{
+						sum += pushPop(i);
+					}
+					NativeRoutines::consume(sum);
+				});
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+			return stopwatch.elapsedMs();
+		}
+
+		/// <summary> Odmeria TreiberStack s danou velkostou pola eliminacie. </summary>
+		/// <param name = "name"> Nazov vo vypise. </param>
+		/// <param name = "eliminationSize"> Velkost pola eliminacie, 0 bez eliminacie. </param>
+		void benchTreiber(const char* name, size_t eliminationSize)
+		{
+			structures::TreiberStack<long long> stack(eliminationSize);
+			const long long milliseconds = runThreads([&stack](long long i)
+			{
+				stack.push(i);
+				long long item = 0;
+				stack.tryPop(item);
+				return item;
+			});
+			NativeRoutines::report(name, "push + pop", milliseconds);
+		}
+	}
+
+	void benchTreiberStack()
+	{
+		std::printf("  %d threads x %lld push + pop\n", THREAD_COUNT, OPERATIONS);
+		benchTreiber("Treiber, no elimination", 0);
+		benchTreiber("Treiber, elimination 8", 8);
+
+		structures::ImplicitStack<long long> stack;
+		std::mutex mutex;
+		const long long milliseconds = runThreads([&stack, &mutex](long long i)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stack.push(i);
+			return stack.pop();
+		});
+		NativeRoutines::report("mutex + ImplicitStack", "push + pop", milliseconds);
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+namespace native {
+
+	// Testy
+
+	/// <summary> Skalarne, SSE2 a AVX2 jadro SearchRoutines dava rovnake vysledky pre vsetky sirky prvkov, dlzky, posuny aj NaN. </summary>
+	void testSearch();
+
+	/// <summary> SpscQueue: jednovlaknove spravanie a prenos medzi producentom a konzumentom po jednom prvku aj po davkach, s kontrolou poradia a suctu. </summary>
+	void testSpscQueue();
+
+	/// <summary> MpmcQueue: jednovlaknove spravanie a 1, 2 a 4 dvojice producentov a konzumentov s kontrolou poradia a suctu. </summary>
+	void testMpmcQueue();
+
+	/// <summary> BlockingQueue: casove limity, zatvorenie, kopia a producenti s konzumentmi mixujucimi blokujuce, casovane a hromadne operacie. </summary>
+	void testBlockingQueue();
+
+	/// <summary> EpochReclamation: uzly sa neuvolnia, kym ich moze vidiet vlakno v slote, a kazdy sa nakoniec uvolni prave raz. </summary>
+	void testEpochReclamation();
+
+	/// <summary> TreiberStack: jednovlaknove spravanie a sucasne push a tryPop bez eliminacie aj s eliminaciou, s kontrolou poctu a suctu. </summary>
+	void testTreiberStack();
+
+	/// <summary> ChunkedDeque: nahodne operacie na oboch koncoch porovnane so std::deque, kopia, priradenie a hranice blokov. </summary>
+	void testChunkedDeque();
+
+	/// <summary> WorkStealingDeque: poradie vlastnika a kradnucich vlakien a sucasne kradnutie, kazdy prvok odobraty prave raz. </summary>
+	void testWorkStealingDeque();
+
+	/// <summary> insertRange a removeIf volane cez odkaz na List pre zoznamy s vlastnou aj predvolenou implementaciou. </summary>
+	void testListBulkOperations();
+
+	/// <summary> ArrayList, LinkedList a DoublyLinkedList: emplace vytvori prvok na mieste, bez kopirovania a presunu. </summary>
+	void testListEmplace();
+
+	/// <summary> PairingHeap: poradie pri znizovani priorit, meld, clear a v ladiacom preklade odmietnutie cudzich a neplatnych odkazov. </summary>
+	void testPairingHeap();
+
+	// Merania
+
+	/// <summary> Indexovany pristup do Array a ArrayList pri politike DS_RANGE_CHECK, s ktorou bol program prelozeny. </summary>
+	void benchRangeCheck();
+
+	/// <summary> TieredVectorList proti ArrayList a LinkedList: vkladanie, citanie a odoberanie na nahodnych poziciach. </summary>
+	void benchTieredVectorList();
+
+	/// <summary> UnrolledLinkedList proti ArrayList a LinkedList: operacie na nahodnych poziciach a prechod celym zoznamom. </summary>
+	void benchUnrolledLinkedList();
+
+	/// <summary> Skalarne, SSE2 a AVX2 jadro SearchRoutines pre kazdu sirku prvku. </summary>
+	void benchSearch();
+
+	/// <summary> Priepustnost SpscQueue s jednym producentom a jednym konzumentom, po jednom prvku a po davkach. </summary>
+	void benchSpscQueue();
+
+	/// <summary> Priepustnost MpmcQueue s 1, 2 a 4 dvojicami producentov a konzumentov. </summary>
+	void benchMpmcQueue();
+
+	/// <summary> TreiberStack bez eliminacie a s eliminaciou proti ImplicitStack chranenemu mutexom. </summary>
+	void benchTreiberStack();
+
+	/// <summary> WorkStealingDeque: vlastnik vklada a odobera, 0, 1 a 3 vlakna kradnu. </summary>
+	void benchWorkStealingDeque();
+
+	/// <summary> PairingHeap proti Heap pri nahodnych vlozeniach a odoberani a PairingHeap so znizovanim priorit cez handle. </summary>
+	void benchPairingHeap();
+
+	/// <summary> Heap, PairingHeap, RadixHeap a BucketQueue pri monotonnej zatazi, v ktorej odobrane priority neklesaju. </summary>
+	void benchMonotonePriorityQueues();
+
+	/// <summary> PriorityQueueDoubleLayer proti Heap a PriorityQueueTwoLists pri 1e4 az 1e7 prvkoch. </summary>
+	void benchPriorityQueueDoubleLayer();
+
+	/// <summary> Prioritne fronty nad zoznamami (utriedeny, neutriedeny a zretazeny): push, peek a pop + push. </summary>
+	void benchPriorityQueueLists();
+}
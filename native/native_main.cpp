@@ -0,0 +1,123 @@
+// Nativny program (bez /clr) s testami a meraniami struktur, ktore sa v projekte DataStructures nedaju prelozit alebo odmerat.
+//
+// Pouzitie:
+//   DataStructuresNative test [nazov]    spusti vsetky testy, alebo iba test s danym nazvom
+//   DataStructuresNative bench [nazov]   spusti vsetky merania, alebo iba meranie s danym nazvom
+//   DataStructuresNative list            vypise nazvy testov a merani
+//
+// Mimo Visual Studia (napr. s ThreadSanitizer alebo AddressSanitizer) sa da prelozit z korenoveho adresara:
+//   g++ -std=c++14 -O2 -pthread [-fsanitize=thread] native/*.cpp structures/ds_routines.cpp structures/structure.cpp
+//       structures/memory_routines.cpp structures/search_routines.cpp structures/vector/vector.cpp -o native_tests
+
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/heap_monitor.h"
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+
+namespace {
+
+	/// <summary> Testy, spustaju sa prikazom test. </summary>
+	const native::NativeCase tests[] = {
+		{ "search", native::testSearch },
+		{ "spsc_queue", native::testSpscQueue },
+		{ "mpmc_queue", native::testMpmcQueue },
+		{ "blocking_queue", native::testBlockingQueue },
+		{ "epoch_reclamation", native::testEpochReclamation },
+		{ "treiber_stack", native::testTreiberStack },
+		{ "chunked_deque", native::testChunkedDeque },
+		{ "work_stealing_deque", native::testWorkStealingDeque },
+		{ "list_bulk_operations", native::testListBulkOperations },
+		{ "list_emplace", native::testListEmplace },
+		{ "pairing_heap", native::testPairingHeap },
+		{ nullptr, nullptr }
+	};
+
+	/// <summary> Merania, spustaju sa prikazom bench. </summary>
+	const native::NativeCase benchmarks[] = {
+		{ "range_check", native::benchRangeCheck },
+		{ "tiered_vector_list", native::benchTieredVectorList },
+		{ "unrolled_linked_list", native::benchUnrolledLinkedList },
+		{ "search", native::benchSearch },
+		{ "spsc_queue", native::benchSpscQueue },
+		{ "mpmc_queue", native::benchMpmcQueue },
+		{ "treiber_stack", native::benchTreiberStack },
+		{ "work_stealing_deque", native::benchWorkStealingDeque },
+		{ "pairing_heap", native::benchPairingHeap },
+		{ "monotone_priority_queues", native::benchMonotonePriorityQueues },
+		{ "priority_queue_double_layer", native::benchPriorityQueueDoubleLayer },
+		{ "priority_queue_lists", native::benchPriorityQueueLists },
+		{ nullptr, nullptr }
+	};
+
+	/// <summary> Spusti pripady, ktorych nazov sa zhoduje s filtrom (bez filtra vsetky). </summary>
+	/// <returns> Pocet neuspesnych pripadov. </returns>
+	int run(const native::NativeCase* cases, const char* filter)
+	{
+		int failed = 0;
+		int executed = 0;
+		for (const native::NativeCase* nativeCase = cases; nativeCase->name != nullptr; nativeCase++)
+		{
+			if (filter != nullptr && std::strcmp(filter, nativeCase->name) != 0)
+			{
+				continue;
+			}
+			executed++;
+			std::printf("[ RUN  ] %s\n", nativeCase->name);
+			std::fflush(stdout);
+			try
+			{
+				nativeCase->run();
+				std::printf("[  OK  ] %s\n", nativeCase->name);
+			}
+			catch (const std::exception& exception)
+			{
+				std::printf("[ FAIL ] %s: %s\n", nativeCase->name, exception.what());
+				failed++;
+			}
+			std::fflush(stdout);
+		}
+		if (filter != nullptr && executed == 0)
+		{
+			std::printf("Nothing matches '%s'.\n", filter);
+			return 1;
+		}
+		return failed;
+	}
+
+	/// <summary> Vypise nazvy pripadov. </summary>
+	void list(const char* title, const native::NativeCase* cases)
+	{
+		std::printf("%s:\n", title);
+		for (const native::NativeCase* nativeCase = cases; nativeCase->name != nullptr; nativeCase++)
+		{
+			std::printf("  %s\n", nativeCase->name);
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	initHeapMonitor();
+
+	const char* command = argc > 1 ? argv[1] : "test";
+	const char* filter = argc > 2 ? argv[2] : nullptr;
+	if (std::strcmp(command, "test") == 0)
+	{
+		return run(tests, filter);
+	}
+	if (std::strcmp(command, "bench") == 0)
+	{
+		return run(benchmarks, filter);
+	}
+	if (std::strcmp(command, "list") == 0)
+	{
+		list("test", tests);
+		list("bench", benchmarks);
+		return 0;
+	}
+	std::printf("Usage: %s test|bench [name] | list\n", argv[0]);
+	return 1;
+}
@@ -0,0 +1,50 @@
+#include "native_routines.h"
+
+#include <cstdio>
+#include <string>
+
+namespace native {
+
+	namespace {
+		/// <summary> Sem sa zapisuju spotrebovane vysledky merani. </summary>
+		volatile long long sink = 0;
+	}
+
+	Stopwatch::Stopwatch() :
+		start_(std::chrono::steady_clock::now())
+	{
+	}
+
+	void Stopwatch::restart()
+	{
+		start_ = std::chrono::steady_clock::now();
+	}
+
+	long long Stopwatch::elapsedMs() const
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_).count();
+	}
+
+	NativeRoutines::NativeRoutines()
+	{
+	}
+
+	void NativeRoutines::check(bool condition, const char* text, const char* file, int line)
+	{
+		if (!condition)
+		{
+			throw std::logic_error(std::string(file) + ":" + std::to_string(line) + ": " + text);
+		}
+	}
+
+	void NativeRoutines::consume(long long value)
+	{
+		sink = sink + value;
+	}
+
+	void NativeRoutines::report(const char* structure, const char* operation, long long milliseconds)
+	{
+		std::printf("  %-28s %-32s %8lld ms\n", structure, operation, milliseconds);
+		std::fflush(stdout);
+	}
+}
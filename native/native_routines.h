@@ -0,0 +1,66 @@
+#pragma once
+
+#include <chrono>
+#include <stdexcept>
+
+/// <summary> Overi podmienku testu. Pri neuspechu vyhodi std::logic_error s textom podmienky a miestom v zdrojovom kode. </summary>
+#define NATIVE_CHECK(condition) ::native::NativeRoutines::check((condition), #condition, __FILE__, __LINE__)
+
+namespace native {
+
+	/// <summary> Funkcia vykonavajuca test alebo meranie. </summary>
+	typedef void (*NativeCaseFunction)();
+
+	/// <summary> Pomenovany test alebo meranie spustitelne z prikazoveho riadku. </summary>
+	struct NativeCase
+	{
+		/// <summary> Nazov, pod ktorym sa spusta. </summary>
+		const char* name;
+		/// <summary> Funkcia, ktora ho vykona. </summary>
+		NativeCaseFunction run;
+	};
+
+	/// <summary> Meria cas od svojho vytvorenia, alebo od posledneho restartu. </summary>
+	class Stopwatch
+	{
+	public:
+		/// <summary> Konstruktor. Spusti meranie. </summary>
+		Stopwatch();
+
+		/// <summary> Zacne merat odznova. </summary>
+		void restart();
+
+		/// <summary> Vrati pocet milisekund od zaciatku merania. </summary>
+		/// <returns> Namerany cas v milisekundach. </returns>
+		long long elapsedMs() const;
+	private:
+		/// <summary> Zaciatok merania. </summary>
+		std::chrono::steady_clock::time_point start_;
+	};
+
+	/// <summary> Kniznicna trieda obsahujuca pomocne rutiny testov a merani. </summary>
+	class NativeRoutines
+	{
+	public:
+		/// <summary> Overi podmienku testu. </summary>
+		/// <param name = "condition"> Overovana podmienka. </param>
+		/// <param name = "text"> Text podmienky. </param>
+		/// <param name = "file"> Subor, v ktorom sa podmienka overuje. </param>
+		/// <param name = "line"> Riadok, na ktorom sa podmienka overuje. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak podmienka neplati. </exception>
+		static void check(bool condition, const char* text, const char* file, int line);
+
+		/// <summary> Spotrebuje vysledok merania, aby ho prekladac nemohol vynechat. </summary>
+		/// <param name = "value"> Vysledok merania. </param>
+		static void consume(long long value);
+
+		/// <summary> Vypise jeden riadok vysledku merania. </summary>
+		/// <param name = "structure"> Nazov meranej struktury. </param>
+		/// <param name = "operation"> Nazov meranej operacie. </param>
+		/// <param name = "milliseconds"> Namerany cas v milisekundach. </param>
+		static void report(const char* structure, const char* operation, long long milliseconds);
+	private:
+		/// <summary> Sukromny konstruktor znemoznuje vytvorenie instancie kniznicnej triedy. </summary>
+		NativeRoutines();
+	};
+}
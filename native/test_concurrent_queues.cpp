@@ -0,0 +1,526 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/queue/spsc_queue.h"
+#include "../structures/queue/mpmc_queue.h"
+#include "../structures/queue/blocking_queue.h"
+#include "../structures/queue/implicit_queue.h"
+#include "../structures/queue/explicit_queue.h"
+#include "../structures/list/array_list.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Producent vlozi cisla 1..count po jednom, konzument overi ich poradie a spocita ich. </summary>
+		/// <param name = "capacity"> Kapacita frontu, pri malej kapacite je front casto plny aj prazdny. </param>
+		/// <param name = "count"> Pocet prenasanych prvkov. </param>
+		void checkSpscSingle(size_t capacity, long long count)
+		{
+			structures::SpscQueue<long long> queue(capacity);
+			long long sum = 0;
+			bool ordered = true;
+
+			std::thread consumer([&]()
+			{
+				structures::Backoff backoff;
+				long long expected = 1;
+				long long item;
+				while (expected <= count)
+				{
+					if (queue.tryPop(item))
+					{
+						ordered = ordered && item == expected;
+						sum += item;
+						expected++;
+						backoff.reset();
+					}
+					else
+					{
+						backoff.pause();
+					}
+				}
+			});
+
+			structures::Backoff backoff;
+			for (long long i = 1; i <= count; i++)
+			{
+				while (!queue.tryPush(i))
+				{
+					backoff.pause();
+				}
+				backoff.reset();
+			}
+			consumer.join();
+
+			NATIVE_CHECK(ordered);
+			NATIVE_CHECK(sum == count * (count + 1) / 2);
+			NATIVE_CHECK(queue.size() == 0);
+		}
+
+		/// <summary> Ako checkSpscSingle, ale obe strany pracuju po davkach roznej velkosti, ktore sa casto lamu cez koniec pola. </summary>
+		void checkSpscBatch(size_t capacity, long long count)
+		{
+			structures::SpscQueue<long long> queue(capacity);
+			long long sum = 0;
+			bool ordered = true;
+
+			std::thread consumer([&]()
+			{
+				structures::Backoff backoff;
+				std::vector<long long> target(37);
+				long long expected = 1;
+				while (expected <= count)
+				{
+					const size_t popped = queue.popBatch(target.data(), target.size());
+					for (size_t i = 0; i < popped; i++)
+					{
+						ordered = ordered && target[i] == expected;
+						sum += target[i];
+						expected++;
+					}
+					if (popped == 0)
+					{
+						backoff.pause();
+					}
+					else
+					{
+						backoff.reset();
+					}
+				}
+			});
+
+			structures::Backoff backoff;
+			std::vector<long long> items(53);
+			long long next = 1;
+			while (next <= count)
+			{
+				size_t prepared = 0;
+				while (prepared < items.size() && next + static_cast<long long>(prepared) <= count)
+				{
+					items[prepared] = next + static_cast<long long>(prepared);
+					prepared++;
+				}
+				size_t offset = 0;
+				while (offset < prepared)
+				{
+					const size_t pushed = queue.pushBatch(items.data() + offset, prepared - offset);
+					offset += pushed;
+					if (pushed == 0)
+					{
+						backoff.pause();
+					}
+					else
+					{
+						backoff.reset();
+					}
+				}
+				next += static_cast<long long>(prepared);
+			}
+			consumer.join();
+
+			NATIVE_CHECK(ordered);
+			NATIVE_CHECK(sum == count * (count + 1) / 2);
+		}
+
+		/// <summary>
+		/// Producenti vkladaju svoje cisla 1..perProducer (polovica cez tryPush, polovica cez pushWait), konzumenti ich odoberaju
+		/// (striedavo tryPop a popWait). Kazdy konzument overi, ze prvky jedneho producenta vidi vo vzostupnom poradi,
+		/// nakoniec sa skontroluje sucet vsetkych odobranych prvkov.
+		/// </summary>
+		/// <param name = "pairs"> Pocet producentov a rovnaky pocet konzumentov. </param>
+		/// <param name = "capacity"> Kapacita frontu. </param>
+		/// <param name = "perProducer"> Pocet prvkov, ktore vlozi kazdy producent. </param>
+		void checkMpmc(int pairs, size_t capacity, long long perProducer)
+		{
+			structures::MpmcQueue<long long> queue(capacity);
+			std::atomic<long long> remaining(pairs * perProducer);
+			std::atomic<long long> sum(0);
+			std::atomic<bool> ordered(true);
+
+			std::vector<std::thread> threads;
+			for (int producer = 0; producer < pairs; producer++)
+			{
+				threads.emplace_back([&queue, producer, perProducer]()
+				{
+					structures::Backoff backoff;
+					for (long long i = 1; i <= perProducer; i++)
+					{
+						// Producent je zakodovany v hornych bitoch, poradie v dolnych.
+						long long item = (static_cast<long long>(producer) << 40) | i;
+						if (i % 2 == 0)
+						{
+							queue.pushWait(std::move(item));
+						}
+						else
+						{
+							while (!queue.tryPush(item))
+							{
+								backoff.pause();
+							}
+							backoff.reset();
+						}
+					}
+				});
+			}
+			for (int consumer = 0; consumer < pairs; consumer++)
+			{
+				threads.emplace_back([&queue, &remaining, &sum, &ordered, pairs]()
+				{
+					std::vector<long long> last(pairs, 0);
+					structures::Backoff backoff;
+					long long localSum = 0;
+					long long item;
+					bool useWait = false;
+					// Konzument si najprv rezervuje jeden este neodobrany prvok, az potom ho odoberie, preto popWait nikdy neostane cakat navzdy.
+					while (remaining.fetch_sub(1, std::memory_order_relaxed) > 0)
+					{
+						if (useWait)
+						{
+							item = queue.popWait();
+						}
+						else
+						{
+							while (!queue.tryPop(item))
+							{
+								backoff.pause();
+							}
+							backoff.reset();
+						}
+						useWait = !useWait;
+						const int producer = static_cast<int>(item >> 40);
+						const long long sequence = item & ((1LL << 40) - 1);
+						if (sequence <= last[producer])
+						{
+							ordered = false;
+						}
+						last[producer] = sequence;
+						localSum += item;
+					}
+					sum += localSum;
+				});
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			long long expected = 0;
+			for (int producer = 0; producer < pairs; producer++)
+			{
+				expected += perProducer * (static_cast<long long>(producer) << 40) + perProducer * (perProducer + 1) / 2;
+			}
+			NATIVE_CHECK(ordered);
+			NATIVE_CHECK(sum == expected);
+			NATIVE_CHECK(queue.size() == 0);
+		}
+
+		/// <summary>
+		/// Producenti vkladaju svoje cisla 1..perProducer (striedavo push a tryPush s casovym limitom), konzumenti odoberaju
+		/// striedavo cez pop, tryPop s casovym limitom a drainTo. Po skonceni producentov sa front zatvori, konzumenti
+		/// doberu zvysok a skontroluje sa pocet a sucet vsetkych odobranych prvkov.
+		/// </summary>
+		/// <param name = "queue"> Testovany front. </param>
+		/// <param name = "producers"> Pocet producentov. </param>
+		/// <param name = "consumers"> Pocet konzumentov. </param>
+		/// <param name = "perProducer"> Pocet prvkov, ktore vlozi kazdy producent. </param>
+		void checkBlocking(structures::BlockingQueue<long long>& queue, int producers, int consumers, long long perProducer)
+		{
+			std::atomic<long long> popped(0);
+			std::atomic<long long> sum(0);
+
+			std::vector<std::thread> producerThreads;
+			for (int producer = 0; producer < producers; producer++)
+			{
+				producerThreads.emplace_back([&queue, producer, perProducer]()
+				{
+					for (long long i = 1; i <= perProducer; i++)
+					{
+						const long long item = (static_cast<long long>(producer) << 40) | i;
+						if (i % 2 == 0)
+						{
+							queue.push(item);
+						}
+						else
+						{
+							while (!queue.tryPush(item, std::chrono::microseconds(100)))
+							{
+							}
+						}
+					}
+				});
+			}
+			std::vector<std::thread> consumerThreads;
+			for (int consumer = 0; consumer < consumers; consumer++)
+			{
+				consumerThreads.emplace_back([&queue, &popped, &sum, consumer]()
+				{
+					structures::ArrayList<long long> drained;
+					long long localCount = 0;
+					long long localSum = 0;
+					long long item;
+					for (int round = consumer; ; round++)
+					{
+						if (round % 3 == 0)
+						{
+							try
+							{
+								item = queue.pop();
+							}
+							catch (const std::out_of_range&)
+							{
+								break;
+							}
+							localCount++;
+							localSum += item;
+						}
+						else if (round % 3 == 1)
+						{
+							if (queue.tryPop(item, std::chrono::microseconds(200)))
+							{
+								localCount++;
+								localSum += item;
+							}
+							else if (queue.isClosed() && queue.size() == 0)
+							{
+								break;
+							}
+						}
+						else
+						{
+							drained.clear();
+							localCount += static_cast<long long>(queue.drainTo(drained, 16));
+							for (long long drainedItem : drained)
+							{
+								localSum += drainedItem;
+							}
+						}
+					}
+					popped += localCount;
+					sum += localSum;
+				});
+			}
+
+			for (std::thread& thread : producerThreads)
+			{
+				thread.join();
+			}
+			queue.close();
+			for (std::thread& thread : consumerThreads)
+			{
+				thread.join();
+			}
+
+			long long expected = 0;
+			for (int producer = 0; producer < producers; producer++)
+			{
+				expected += perProducer * (static_cast<long long>(producer) << 40) + perProducer * (perProducer + 1) / 2;
+			}
+			NATIVE_CHECK(popped == producers * perProducer);
+			NATIVE_CHECK(sum == expected);
+			NATIVE_CHECK(queue.size() == 0);
+		}
+	}
+
+	void testSpscQueue()
+	{
+		// Jednovlaknove spravanie: kapacita, plny a prazdny front, kopia.
+		structures::SpscQueue<int> queue(5);
+		NATIVE_CHECK(queue.capacity() == 8);
+		for (int i = 0; i < 8; i++)
+		{
+			NATIVE_CHECK(queue.tryPush(i));
+		}
+		NATIVE_CHECK(!queue.tryPush(8));
+		bool thrown = false;
+		try
+		{
+			queue.push(8);
+		}
+		catch (const std::out_of_range&)
+		{
+			thrown = true;
+		}
+		NATIVE_CHECK(thrown);
+
+		structures::SpscQueue<int> copy(queue);
+		NATIVE_CHECK(copy.size() == 8);
+		for (int i = 0; i < 8; i++)
+		{
+			NATIVE_CHECK(queue.peek() == i);
+			NATIVE_CHECK(queue.pop() == i);
+		}
+		int item = -1;
+		NATIVE_CHECK(!queue.tryPop(item));
+		NATIVE_CHECK(copy.pop() == 0);
+
+		int items[] = { 10, 11, 12, 13, 14, 15 };
+		NATIVE_CHECK(queue.pushBatch(items, 6) == 6);
+		NATIVE_CHECK(queue.pushBatch(items, 6) == 2);
+		int target[10];
+		NATIVE_CHECK(queue.popBatch(target, 10) == 8);
+		NATIVE_CHECK(target[0] == 10 && target[5] == 15 && target[6] == 10 && target[7] == 11);
+
+		// Producent a konzument v roznych vlaknach.
+		checkSpscSingle(4, 200000);
+		checkSpscSingle(1024, 1000000);
+		checkSpscBatch(64, 1000000);
+		checkSpscBatch(1024, 1000000);
+	}
+
+	void testMpmcQueue()
+	{
+		// Jednovlaknove spravanie: kapacita, plny a prazdny front, kopia a clear.
+		structures::MpmcQueue<int> queue(3);
+		NATIVE_CHECK(queue.capacity() == 4);
+		for (int i = 0; i < 4; i++)
+		{
+			queue.push(i);
+		}
+		NATIVE_CHECK(!queue.tryPush(4));
+		bool thrown = false;
+		try
+		{
+			queue.push(4);
+		}
+		catch (const std::out_of_range&)
+		{
+			thrown = true;
+		}
+		NATIVE_CHECK(thrown);
+
+		structures::MpmcQueue<int> copy(queue);
+		for (int i = 0; i < 4; i++)
+		{
+			NATIVE_CHECK(queue.peek() == i);
+			NATIVE_CHECK(queue.pop() == i);
+		}
+		int item = -1;
+		NATIVE_CHECK(!queue.tryPop(item));
+		NATIVE_CHECK(copy.size() == 4);
+		copy.clear();
+		NATIVE_CHECK(copy.size() == 0);
+		// Po niekolkych kolach okolo pola musia poradove cisla bunek stale sediet.
+		for (int i = 0; i < 100; i++)
+		{
+			copy.push(i);
+			copy.push(i + 1);
+			NATIVE_CHECK(copy.pop() == i);
+			NATIVE_CHECK(copy.pop() == i + 1);
+		}
+
+		// Viac producentov a konzumentov.
+		const int pairs[] = { 1, 2, 4 };
+		for (int count : pairs)
+		{
+			checkMpmc(count, 2, 50000);
+			checkMpmc(count, 1024, 200000);
+		}
+	}
+	void testBlockingQueue()
+	{
+		// Jednovlaknove spravanie: casove limity, peek, kopia a priradenie.
+		structures::BlockingQueue<int> queue(new structures::ImplicitQueue<int>(4), 3);
+		NATIVE_CHECK(queue.capacity() == 3);
+		for (int i = 0; i < 3; i++)
+		{
+			NATIVE_CHECK(queue.tryPush(i, std::chrono::milliseconds(0)));
+		}
+		NATIVE_CHECK(!queue.tryPush(3, std::chrono::milliseconds(0)));
+		Stopwatch stopwatch;
+		NATIVE_CHECK(!queue.tryPush(3, std::chrono::milliseconds(20)));
+		NATIVE_CHECK(stopwatch.elapsedMs() >= 19);
+
+		const structures::BlockingQueue<int>& constQueue = queue;
+		NATIVE_CHECK(constQueue.peek() == 0);
+		bool thrown = false;
+		try
+		{
+			queue.peek();
+		}
+		catch (const std::logic_error&)
+		{
+			thrown = true;
+		}
+		NATIVE_CHECK(thrown);
+
+		structures::BlockingQueue<int> copy(queue);
+		structures::BlockingQueue<int> assigned(new structures::ImplicitQueue<int>(4), 3);
+		assigned.push(100);
+		assigned = queue;
+		for (int i = 0; i < 3; i++)
+		{
+			NATIVE_CHECK(queue.pop() == i);
+			NATIVE_CHECK(copy.pop() == i);
+			NATIVE_CHECK(assigned.pop() == i);
+		}
+		int item = -1;
+		stopwatch.restart();
+		NATIVE_CHECK(!queue.tryPop(item, std::chrono::milliseconds(20)));
+		NATIVE_CHECK(stopwatch.elapsedMs() >= 19);
+
+		// Zatvoreny front: pridavanie vyhodi vynimku, zvysok sa da odobrat.
+		queue.push(7);
+		queue.push(8);
+		queue.close();
+		NATIVE_CHECK(queue.isClosed());
+		thrown = false;
+		try
+		{
+			queue.push(9);
+		}
+		catch (const std::logic_error&)
+		{
+			thrown = true;
+		}
+		NATIVE_CHECK(thrown);
+		NATIVE_CHECK(queue.pop() == 7);
+		NATIVE_CHECK(queue.tryPop(item, std::chrono::milliseconds(0)) && item == 8);
+		NATIVE_CHECK(!queue.tryPop(item, std::chrono::milliseconds(0)));
+		thrown = false;
+		try
+		{
+			queue.pop();
+		}
+		catch (const std::out_of_range&)
+		{
+			thrown = true;
+		}
+		NATIVE_CHECK(thrown);
+
+		// Zatvorenie zobudi konzumenta cakajuceho v pop.
+		structures::BlockingQueue<int> waiting(new structures::ExplicitQueue<int>(), 2);
+		int first = 0;
+		std::atomic<bool> woken(false);
+		std::thread consumer([&waiting, &first, &woken]()
+		{
+			first = waiting.pop();
+			try
+			{
+				waiting.pop();
+			}
+			catch (const std::out_of_range&)
+			{
+				woken = true;
+			}
+		});
+		waiting.push(1);
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		waiting.close();
+		consumer.join();
+		NATIVE_CHECK(first == 1);
+		NATIVE_CHECK(woken);
+
+		// Producenti a konzumenti v roznych vlaknach, nad implicitnym aj explicitnym frontom.
+		structures::BlockingQueue<long long> implicitQueue(new structures::ImplicitQueue<long long>(16), 16);
+		checkBlocking(implicitQueue, 3, 3, 50000);
+		structures::BlockingQueue<long long> explicitQueue(new structures::ExplicitQueue<long long>(), 2);
+		checkBlocking(explicitQueue, 3, 3, 20000);
+		structures::BlockingQueue<long long> singleQueue(new structures::ImplicitQueue<long long>(1), 1);
+		checkBlocking(singleQueue, 1, 4, 20000);
+	}
+}
@@ -0,0 +1,250 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/deque/chunked_deque.h"
+#include "../structures/deque/work_stealing_deque.h"
+
+#include <atomic>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Porovna obsah ChunkedDeque s referencnym std::deque cez operator[], peekFront a peekBack. </summary>
+		/// <param name = "deque"> Testovany front. </param>
+		/// <param name = "expected"> Ocakavany obsah. </param>
+		template<int K>
+		void checkSameContent(const structures::ChunkedDeque<int, K>& deque, const std::deque<int>& expected)
+		{
+			NATIVE_CHECK(deque.size() == expected.size());
+			for (size_t i = 0; i < expected.size(); i++)
+			{
+				NATIVE_CHECK(deque[static_cast<int>(i)] == expected[i]);
+			}
+			if (!expected.empty())
+			{
+				NATIVE_CHECK(deque.peekFront() == expected.front());
+				NATIVE_CHECK(deque.peekBack() == expected.back());
+			}
+		}
+
+		/// <summary>
+		/// Vlastnik vklada cisla 1..count a obcas odobera zo spodu, kradnuce vlakna kradnu z vrchu. Kazde cislo musi
+		/// byt odobrate prave raz, ci uz ho vzal vlastnik, alebo ine vlakno.
+		/// </summary>
+		/// <param name = "thieves"> Pocet kradnucich vlakien. </param>
+		/// <param name = "capacity"> Pociatocna kapacita, mala kapacita vynuti casty rast pola. </param>
+		/// <param name = "count"> Pocet vlozenych prvkov. </param>
+		/// <param name = "popEvery"> Vlastnik odobera po kazdom popEvery-tom vlozeni, 1 znamena stale o posledny prvok. </param>
+		void checkStealing(int thieves, size_t capacity, int count, int popEvery)
+		{
+			structures::WorkStealingDeque<int> deque(capacity);
+			std::vector<std::atomic<int>> taken(count + 1);
+			for (std::atomic<int>& flag : taken)
+			{
+				flag.store(0, std::memory_order_relaxed);
+			}
+			std::atomic<bool> done(false);
+			std::atomic<int> outOfRange(0);
+
+			std::vector<std::thread> threads;
+			for (int thief = 0; thief < thieves; thief++)
+			{
+				threads.emplace_back([&deque, &taken, &done, &outOfRange, count]()
+				{
+					int item;
+					while (!done.load(std::memory_order_acquire) || deque.size() > 0)
+					{
+						if (deque.trySteal(item))
+						{
+							if (item < 1 || item > count)
+							{
+								outOfRange++;
+							}
+							else
+							{
+								taken[item]++;
+							}
+						}
+						else
+						{
+							std::this_thread::yield();
+						}
+					}
+				});
+			}
+
+			int item;
+			for (int i = 1; i <= count; i++)
+			{
+				deque.push(i);
+				if (i % popEvery == 0 && deque.tryPop(item))
+				{
+					taken[item]++;
+				}
+			}
+			while (deque.tryPop(item))
+			{
+				taken[item]++;
+			}
+			done.store(true, std::memory_order_release);
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			int missing = 0;
+			int duplicate = 0;
+			for (int i = 1; i <= count; i++)
+			{
+				const int times = taken[i].load(std::memory_order_relaxed);
+				missing += times == 0 ? 1 : 0;
+				duplicate += times > 1 ? 1 : 0;
+			}
+			NATIVE_CHECK(outOfRange == 0);
+			NATIVE_CHECK(missing == 0);
+			NATIVE_CHECK(duplicate == 0);
+			NATIVE_CHECK(deque.size() == 0);
+		}
+	}
+
+	void testChunkedDeque()
+	{
+		// Nahodne operacie na oboch koncoch s malymi blokmi, aby sa casto prechadzalo cez hranice blokov a mapa rastla aj centrovala.
+		std::mt19937 random(7);
+		structures::ChunkedDeque<int, 4> deque;
+		std::deque<int> expected;
+		for (int step = 0; step < 20000; step++)
+		{
+			// V prvej polovici prevazuje vkladanie, v druhej odoberanie.
+			const unsigned operation = random() % 10;
+			const bool grow = step < 10000 ? operation < 6 : operation < 4;
+			const int value = static_cast<int>(random() % 1000);
+			if (grow || expected.empty())
+			{
+				if (random() % 2 == 0)
+				{
+					deque.pushFront(value);
+					expected.push_front(value);
+				}
+				else
+				{
+					deque.pushBack(value);
+					expected.push_back(value);
+				}
+			}
+			else if (random() % 2 == 0)
+			{
+				NATIVE_CHECK(deque.popFront() == expected.front());
+				expected.pop_front();
+			}
+			else
+			{
+				NATIVE_CHECK(deque.popBack() == expected.back());
+				expected.pop_back();
+			}
+			if (step % 997 == 0)
+			{
+				checkSameContent(deque, expected);
+			}
+		}
+		checkSameContent(deque, expected);
+
+		structures::ChunkedDeque<int, 4> copy(deque);
+		checkSameContent(copy, expected);
+		structures::ChunkedDeque<int, 4> assigned;
+		assigned.pushBack(-1);
+		assigned = deque;
+		checkSameContent(assigned, expected);
+		// Kopia nesmie zdielat bloky s originalom.
+		const int first = copy[0];
+		deque[0] = first + 1;
+		NATIVE_CHECK(copy[0] == first);
+
+		// Front sa posuva stale jednym smerom, mapa sa musi centrovat namiesto neobmedzeneho rastu.
+		deque.clear();
+		for (int round = 0; round < 20; round++)
+		{
+			for (int i = 0; i < 500; i++)
+			{
+				deque.pushBack(round * 500 + i);
+			}
+			for (int i = 0; i < 500; i++)
+			{
+				NATIVE_CHECK(deque.popFront() == round * 500 + i);
+			}
+		}
+		for (int round = 0; round < 20; round++)
+		{
+			for (int i = 0; i < 500; i++)
+			{
+				deque.pushFront(i);
+			}
+			for (int i = 0; i < 500; i++)
+			{
+				NATIVE_CHECK(deque.popBack() == i);
+			}
+		}
+
+		// Striedave vkladanie a odoberanie na hranici bloku pri jedinom prvku.
+		deque.clear();
+		NATIVE_CHECK(deque.size() == 0);
+		for (int i = 0; i < 100; i++)
+		{
+			deque.pushBack(i);
+			NATIVE_CHECK(deque.popFront() == i);
+			deque.pushFront(i);
+			NATIVE_CHECK(deque.popBack() == i);
+		}
+
+		bool thrown = false;
+		try
+		{
+			deque.popFront();
+		}
+		catch (const std::out_of_range&)
+		{
+			thrown = true;
+		}
+		NATIVE_CHECK(thrown);
+	}
+
+	void testWorkStealingDeque()
+	{
+		// Jednovlaknove spravanie: vlastnik odobera od konca (LIFO), kradne sa zo zaciatku (FIFO), pole rastie.
+		structures::WorkStealingDeque<int> deque(2);
+		for (int i = 0; i < 10; i++)
+		{
+			deque.push(i);
+		}
+		NATIVE_CHECK(deque.size() == 10);
+		NATIVE_CHECK(deque.capacity() == 16);
+
+		structures::WorkStealingDeque<int> copy(deque);
+		int item = -1;
+		NATIVE_CHECK(deque.tryPop(item) && item == 9);
+		NATIVE_CHECK(deque.trySteal(item) && item == 0);
+		NATIVE_CHECK(deque.size() == 8);
+		deque.clear();
+		NATIVE_CHECK(deque.size() == 0);
+		NATIVE_CHECK(!deque.tryPop(item));
+		NATIVE_CHECK(!deque.trySteal(item));
+
+		NATIVE_CHECK(copy.size() == 10);
+		for (int i = 0; i < 5; i++)
+		{
+			NATIVE_CHECK(copy.trySteal(item) && item == i);
+			NATIVE_CHECK(copy.tryPop(item) && item == 9 - i);
+		}
+		NATIVE_CHECK(!copy.tryPop(item));
+
+		// Vlastnik a kradnuce vlakna: front rastie (aj s rastom pola pocas kradnutia), alebo sa stale bojuje o posledny prvok.
+		checkStealing(1, 2, 200000, 4);
+		checkStealing(3, 2, 200000, 4);
+		checkStealing(3, 1024, 200000, 4);
+		checkStealing(3, 1024, 200000, 1);
+	}
+}
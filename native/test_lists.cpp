@@ -0,0 +1,179 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/list/array_list.h"
+#include "../structures/list/linked_list.h"
+#include "../structures/list/doubly_linked_list.h"
+#include "../structures/list/small_array_list.h"
+#include "../structures/list/cyclical_list.h"
+
+#include <stdexcept>
+#include <cstring>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Pocet kopirovani a presunov Tracked. </summary>
+		int trackedTransfers = 0;
+
+		/// <summary> Prvok, ktory pocita, kolkokrat bol skopirovany alebo presunuty. ArrayList presuva prvky po bytoch, preto nevlastni pamat. </summary>
+		struct Tracked
+		{
+			/// <summary> Konstruktor z viacerych argumentov. </summary>
+			/// <param name = "name"> Nazov. </param>
+			/// <param name = "value"> Hodnota. </param>
+			Tracked(const char* name, int value) :
+				name(name),
+				value(value)
+			{
+			}
+
+			/// <summary> Kopirovaci konstruktor. </summary>
+			Tracked(const Tracked& other) :
+				name(other.name),
+				value(other.value)
+			{
+				trackedTransfers++;
+			}
+
+			/// <summary> Presuvaci konstruktor. </summary>
+			Tracked(Tracked&& other) :
+				name(other.name),
+				value(other.value)
+			{
+				trackedTransfers++;
+			}
+
+			/// <summary> Operator priradenia. </summary>
+			Tracked& operator=(const Tracked& other)
+			{
+				name = other.name;
+				value = other.value;
+				trackedTransfers++;
+				return *this;
+			}
+
+			/// <summary> Presuvaci operator priradenia. </summary>
+			Tracked& operator=(Tracked&& other)
+			{
+				name = other.name;
+				value = other.value;
+				trackedTransfers++;
+				return *this;
+			}
+
+			/// <summary> Operator porovnania. </summary>
+			bool operator==(const Tracked& other) const
+			{
+				return std::strcmp(name, other.name) == 0 && value == other.value;
+			}
+
+			/// <summary> Nazov. </summary>
+			const char* name;
+			/// <summary> Hodnota. </summary>
+			int value;
+		};
+
+		/// <summary> Metoda emplace konkretneho zoznamu vytvori prvky na mieste, cez odkaz na List sa kazdy presunie prave raz. </summary>
+		/// <param name = "list"> Prazdny testovany zoznam. </param>
+		template<typename L>
+		void checkEmplace(L& list)
+		{
+			trackedTransfers = 0;
+			for (int i = 0; i < 10; i++)
+			{
+				list.emplace("direct", i);
+			}
+			NATIVE_CHECK(trackedTransfers == 0);
+
+			structures::List<Tracked>& base = list;
+			base.emplace("base", 10);
+			NATIVE_CHECK(trackedTransfers == 1);
+
+			NATIVE_CHECK(list.size() == 11);
+			for (int i = 0; i < 11; i++)
+			{
+				const Tracked& item = list[i];
+				NATIVE_CHECK(item.value == i);
+				NATIVE_CHECK(std::strcmp(item.name, i < 10 ? "direct" : "base") == 0);
+			}
+		}
+
+		/// <summary> Porovna obsah zoznamu s ocakavanym obsahom. </summary>
+		/// <param name = "list"> Testovany zoznam. </param>
+		/// <param name = "expected"> Ocakavany obsah. </param>
+		void checkSameContent(structures::List<int>& list, const std::vector<int>& expected)
+		{
+			NATIVE_CHECK(list.size() == expected.size());
+			for (size_t i = 0; i < expected.size() && i < list.size(); i++)
+			{
+				NATIVE_CHECK(list[static_cast<int>(i)] == expected[i]);
+			}
+		}
+
+		/// <summary>
+		/// Vola insertRange a removeIf iba cez odkaz na List, teda cez virtualne metody insertRangeImpl a removeIfImpl.
+		/// Vysledok musi byt rovnaky pre kazdy zoznam, ci metody prekryva, alebo pouziva predvolene.
+		/// </summary>
+		/// <param name = "list"> Prazdny testovany zoznam. </param>
+		void checkBulkOperations(structures::List<int>& list)
+		{
+			const std::vector<int> first = { 1, 2, 3, 4, 5 };
+			const std::vector<int> second = { 10, 11, 12 };
+
+			list.insertRange(0, first.begin(), first.end());
+			checkSameContent(list, first);
+			list.insertRange(2, second.begin(), second.end());
+			checkSameContent(list, { 1, 2, 10, 11, 12, 3, 4, 5 });
+			list.insertRange(static_cast<int>(list.size()), second.begin(), second.begin() + 1);
+			list.insertRange(0, second.begin(), second.begin());
+			checkSameContent(list, { 1, 2, 10, 11, 12, 3, 4, 5, 10 });
+
+			NATIVE_CHECK(list.removeIf([](const int& item) { return item % 2 == 0; }) == 5);
+			checkSameContent(list, { 1, 11, 3, 5 });
+			NATIVE_CHECK(list.removeIf([](const int& item) { return item > 100; }) == 0);
+			checkSameContent(list, { 1, 11, 3, 5 });
+
+			bool thrown = false;
+			try
+			{
+				list.insertRange(static_cast<int>(list.size()) + 1, first.begin(), first.end());
+			}
+			catch (const std::out_of_range&)
+			{
+				thrown = true;
+			}
+			NATIVE_CHECK(thrown);
+			checkSameContent(list, { 1, 11, 3, 5 });
+
+			NATIVE_CHECK(list.removeIf([](const int&) { return true; }) == 4);
+			NATIVE_CHECK(list.isEmpty());
+		}
+	}
+
+	void testListBulkOperations()
+	{
+		structures::ArrayList<int> arrayList;
+		checkBulkOperations(arrayList);
+		structures::LinkedList<int> linkedList;
+		checkBulkOperations(linkedList);
+		structures::DoublyLinkedList<int> doublyLinkedList;
+		checkBulkOperations(doublyLinkedList);
+		// Mala vnutorna kapacita, aby vkladanie presiahlo vlozene prvky.
+		structures::SmallArrayList<int, 4> smallArrayList;
+		checkBulkOperations(smallArrayList);
+		// CyclicalList metody neprekryva, overuju sa predvolene insertRangeImpl a removeIfImpl.
+		structures::CyclicalList<int> cyclicalList;
+		checkBulkOperations(cyclicalList);
+	}
+
+	void testListEmplace()
+	{
+		structures::ArrayList<Tracked> arrayList;
+		checkEmplace(arrayList);
+		structures::LinkedList<Tracked> linkedList;
+		checkEmplace(linkedList);
+		structures::DoublyLinkedList<Tracked> doublyLinkedList;
+		checkEmplace(doublyLinkedList);
+	}
+}
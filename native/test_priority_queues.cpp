@@ -0,0 +1,105 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/priority_queue/pairing_heap.h"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Zisti, ci priorityOf s danym odkazom vyhodi std::logic_error. </summary>
+		/// <param name = "heap"> Halda, ktorej sa odkaz predklada. </param>
+		/// <param name = "handle"> Odkaz. </param>
+		/// <returns> true, ak bola vyhodena vynimka. </returns>
+		bool rejectsHandle(const structures::PairingHeap<int>& heap, const structures::PairingHeap<int>::Handle& handle)
+		{
+			try
+			{
+				heap.priorityOf(handle);
+			}
+			catch (const std::logic_error&)
+			{
+				return true;
+			}
+			return false;
+		}
+	}
+
+	void testPairingHeap()
+	{
+		// Nahodne priority a nahodne znizovanie cez odkazy, prvky musia vyjst v poradi priorit.
+		std::mt19937 random(11);
+		structures::PairingHeap<int> heap;
+		std::vector<structures::PairingHeap<int>::Handle> handles;
+		std::vector<int> priorities;
+		for (int i = 0; i < 5000; i++)
+		{
+			const int priority = static_cast<int>(random() % 100000);
+			handles.push_back(heap.insert(priority, i));
+			priorities.push_back(priority);
+		}
+		for (int i = 0; i < 2000; i++)
+		{
+			const size_t item = random() % handles.size();
+			priorities[item] -= static_cast<int>(random() % 1000);
+			heap.decreaseKey(handles[item], priorities[item]);
+			NATIVE_CHECK(heap.priorityOf(handles[item]) == priorities[item]);
+		}
+		std::vector<int> expected(priorities);
+		std::sort(expected.begin(), expected.end());
+		for (size_t i = 0; i < expected.size(); i++)
+		{
+			NATIVE_CHECK(heap.peekPriority() == expected[i]);
+			const int item = heap.pop();
+			NATIVE_CHECK(priorities[item] == expected[i]);
+		}
+		NATIVE_CHECK(heap.size() == 0);
+
+		// Odkazy na prvky druhej haldy zostanu po meld platne v tejto halde.
+		structures::PairingHeap<int> other;
+		structures::PairingHeap<int>::Handle own = heap.insert(50, 1);
+		structures::PairingHeap<int>::Handle melded = other.insert(60, 2);
+		other.insert(70, 3);
+		heap.meld(other);
+		NATIVE_CHECK(heap.size() == 3);
+		NATIVE_CHECK(other.size() == 0);
+		heap.decreaseKey(melded, 10);
+		NATIVE_CHECK(heap.priorityOf(own) == 50);
+		NATIVE_CHECK(heap.pop() == 2);
+
+		// clear uvolni aj uzly v zalohe.
+		NATIVE_CHECK(heap.memoryUsage().bytesWasted > 0);
+		heap.clear();
+		NATIVE_CHECK(heap.size() == 0);
+		NATIVE_CHECK(heap.memoryUsage().bytesWasted == 0);
+		NATIVE_CHECK(heap.memoryUsage().allocations == 0);
+
+		NATIVE_CHECK(rejectsHandle(heap, structures::PairingHeap<int>::Handle()));
+#ifndef NDEBUG
+		// Odkaz na prvok inej haldy, na odobraty prvok a na odobraty prvok, ktoreho uzol uz nesie iny prvok.
+		structures::PairingHeap<int>::Handle foreign = other.insert(5, 5);
+		NATIVE_CHECK(rejectsHandle(heap, foreign));
+		NATIVE_CHECK(!rejectsHandle(other, foreign));
+		structures::PairingHeap<int>::Handle popped = heap.insert(1, 1);
+		heap.pop();
+		NATIVE_CHECK(rejectsHandle(heap, popped));
+		structures::PairingHeap<int>::Handle reused = heap.insert(2, 2);
+		NATIVE_CHECK(rejectsHandle(heap, popped));
+		NATIVE_CHECK(!rejectsHandle(heap, reused));
+		bool thrown = false;
+		try
+		{
+			heap.decreaseKey(foreign, 0);
+		}
+		catch (const std::logic_error&)
+		{
+			thrown = true;
+		}
+		NATIVE_CHECK(thrown);
+		NATIVE_CHECK(other.priorityOf(foreign) == 5);
+#endif
+	}
+}
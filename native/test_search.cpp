@@ -0,0 +1,124 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/search_routines.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Jadra, ktore sa daju na tomto procesore pouzit. </summary>
+		std::vector<structures::SearchKernel> supportedKernels()
+		{
+			std::vector<structures::SearchKernel> result;
+			const structures::SearchKernel kernels[] = { structures::skSCALAR, structures::skSSE2, structures::skAVX2 };
+			for (structures::SearchKernel kernel : kernels)
+			{
+				if (structures::SearchRoutines::isKernelSupported(kernel))
+				{
+					result.push_back(kernel);
+				}
+			}
+			return result;
+		}
+
+		/// <summary> Porovna vsetky jadra s jednoduchym cyklom na danom useku pamate, hlada prvy vyskyt aj pocet vyskytov. </summary>
+		template<typename Lane>
+		void checkAllKernels(const Lane* items, int count, Lane value)
+		{
+			int expectedIndex = -1;
+			int expectedCount = 0;
+			for (int i = 0; i < count; i++)
+			{
+				if (items[i] == value)
+				{
+					if (expectedIndex == -1)
+					{
+						expectedIndex = i;
+					}
+					expectedCount++;
+				}
+			}
+			for (structures::SearchKernel kernel : supportedKernels())
+			{
+				NATIVE_CHECK(structures::SearchRoutines::scanWith(kernel, items, count, value, false) == expectedIndex);
+				NATIVE_CHECK(structures::SearchRoutines::scanWith(kernel, items, count, value, true) == expectedCount);
+			}
+			NATIVE_CHECK(structures::SearchRoutines::indexOf(items, count, value) == expectedIndex);
+			NATIVE_CHECK(structures::SearchRoutines::count(items, count, value) == expectedCount);
+		}
+
+		/// <summary>
+		/// Pre kazdu dlzku az po niekolko celych registrov AVX2 a kazdy posun zaciatku voci zarovnaniu
+		/// umiestni hladanu hodnotu na zaciatok, do stredu, na koniec (do zvysku, ktory nevyplni register) a nikam.
+		/// </summary>
+		template<typename Lane>
+		void checkLengthsAndOffsets(Lane filler, Lane value)
+		{
+			const int lanesPerRegister = static_cast<int>(32 / sizeof(Lane));
+			const int maxCount = 3 * lanesPerRegister + 3;
+			std::vector<Lane> buffer(maxCount + 8, filler);
+			for (int offset = 0; offset < 4; offset++)
+			{
+				for (int count = 0; count <= maxCount; count++)
+				{
+					Lane* items = buffer.data() + offset;
+					std::fill(buffer.begin(), buffer.end(), filler);
+					checkAllKernels<Lane>(items, count, value);
+					if (count == 0)
+					{
+						continue;
+					}
+					const int positions[] = { 0, count / 2, count - 1 };
+					for (int position : positions)
+					{
+						items[position] = value;
+						checkAllKernels<Lane>(items, count, value);
+					}
+					// Hodnota hned za koncom useku sa nesmie najst.
+					std::fill(buffer.begin(), buffer.end(), filler);
+					items[count] = value;
+					checkAllKernels<Lane>(items, count, value);
+				}
+			}
+		}
+	}
+
+	void testSearch()
+	{
+		checkLengthsAndOffsets<std::int8_t>(1, -7);
+		checkLengthsAndOffsets<std::int16_t>(1, -7);
+		checkLengthsAndOffsets<std::int32_t>(1, -7);
+		checkLengthsAndOffsets<std::int64_t>(1, -7);
+		checkLengthsAndOffsets<float>(1.0f, -7.5f);
+		checkLengthsAndOffsets<double>(1.0, -7.5);
+
+		// 64-bitove porovnanie v SSE2 sa sklada z dvoch 32-bitovych, zhoda jednej polovice nestaci.
+		const std::int64_t lowHalf = 0x0000000700000001LL;
+		const std::int64_t highHalf = 0x0000000100000007LL;
+		checkLengthsAndOffsets<std::int64_t>(lowHalf, 0x0000000100000001LL);
+		checkLengthsAndOffsets<std::int64_t>(highHalf, 0x0000000100000001LL);
+
+		// NaN sa nerovna nicomu, ani sebe. -0.0 sa rovna +0.0.
+		const float floatNaN = std::numeric_limits<float>::quiet_NaN();
+		const double doubleNaN = std::numeric_limits<double>::quiet_NaN();
+		checkLengthsAndOffsets<float>(floatNaN, floatNaN);
+		checkLengthsAndOffsets<float>(floatNaN, 1.0f);
+		checkLengthsAndOffsets<float>(-0.0f, 0.0f);
+		checkLengthsAndOffsets<double>(doubleNaN, doubleNaN);
+		checkLengthsAndOffsets<double>(doubleNaN, 1.0);
+		checkLengthsAndOffsets<double>(-0.0, 0.0);
+
+		const float floats[] = { floatNaN, 2.0f, floatNaN, -0.0f, 2.0f, 3.0f, floatNaN, 0.0f, 2.0f, 5.0f };
+		for (structures::SearchKernel kernel : supportedKernels())
+		{
+			NATIVE_CHECK(structures::SearchRoutines::scanWith(kernel, floats, 10, floatNaN, false) == -1);
+			NATIVE_CHECK(structures::SearchRoutines::scanWith(kernel, floats, 10, floatNaN, true) == 0);
+			NATIVE_CHECK(structures::SearchRoutines::scanWith(kernel, floats, 10, 0.0f, true) == 2);
+			NATIVE_CHECK(structures::SearchRoutines::scanWith(kernel, floats, 10, 2.0f, false) == 1);
+		}
+	}
+}
@@ -0,0 +1,258 @@
+#include "native_cases.h"
+#include "native_routines.h"
+#include "../structures/stack/treiber_stack.h"
+#include "../structures/epoch_reclamation.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace native {
+
+	namespace {
+		/// <summary> Pocet vytvorenych uzlov CountedNode. </summary>
+		std::atomic<long long> countedCreated(0);
+		/// <summary> Pocet zrusenych uzlov CountedNode. </summary>
+		std::atomic<long long> countedDestroyed(0);
+
+		/// <summary> Uzol pre EpochReclamation, ktory pocita svoje vytvorenie a zrusenie a pri zruseni prepise svoju kontrolnu hodnotu. </summary>
+		struct CountedNode
+		{
+			/// <summary> Konstruktor. </summary>
+			/// <param name = "value"> Hodnota uzla. </param>
+			CountedNode(long long value) :
+				value(value),
+				check(~value),
+				retiredNext(nullptr)
+			{
+				countedCreated++;
+			}
+
+			/// <summary> Destruktor. </summary>
+			~CountedNode()
+			{
+				check = value;
+				countedDestroyed++;
+			}
+
+			/// <summary> Hodnota uzla. </summary>
+			long long value;
+			/// <summary> Kontrolna hodnota, pokial uzol zije, plati check == ~value. </summary>
+			long long check;
+			/// <summary> Zretazenie vyradenych uzlov. </summary>
+			CountedNode* retiredNext;
+		};
+
+		/// <summary>
+		/// Kym vlakno drzi slot z epochy pred vyradenim uzlov, ziadny z nich sa nesmie uvolnit.
+		/// Po uvolneni slotu sa musia zacat uvolnovat a destruktor spravy epoch uvolni zvysok.
+		/// </summary>
+		void checkEpochPinning()
+		{
+			const long long createdBefore = countedCreated;
+			const long long destroyedBefore = countedDestroyed;
+			{
+				structures::EpochReclamation<CountedNode> reclamation;
+				std::mutex mutex;
+				std::condition_variable condition;
+				bool pinned = false;
+				bool release = false;
+
+				std::thread reader([&]()
+				{
+					structures::EpochReclamation<CountedNode>::Guard guard(reclamation);
+					std::unique_lock<std::mutex> lock(mutex);
+					pinned = true;
+					condition.notify_all();
+					condition.wait(lock, [&]() { return release; });
+				});
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					condition.wait(lock, [&]() { return pinned; });
+				}
+
+				for (int i = 0; i < 1000; i++)
+				{
+					structures::EpochReclamation<CountedNode>::Guard guard(reclamation);
+					guard.retire(new CountedNode(i));
+				}
+				const long long destroyedWhilePinned = countedDestroyed - destroyedBefore;
+				const size_t retiredWhilePinned = reclamation.retiredCount();
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					release = true;
+				}
+				condition.notify_all();
+				reader.join();
+				NATIVE_CHECK(destroyedWhilePinned == 0);
+				NATIVE_CHECK(retiredWhilePinned == 1000);
+
+				for (int i = 0; i < 1000; i++)
+				{
+					structures::EpochReclamation<CountedNode>::Guard guard(reclamation);
+					guard.retire(new CountedNode(i));
+				}
+				NATIVE_CHECK(countedDestroyed > destroyedBefore);
+				NATIVE_CHECK(static_cast<long long>(reclamation.retiredCount()) == 2000 - (countedDestroyed - destroyedBefore));
+			}
+			NATIVE_CHECK(countedCreated - createdBefore == 2000);
+			NATIVE_CHECK(countedDestroyed - destroyedBefore == 2000);
+		}
+
+		/// <summary>
+		/// Vlakna opakovane citaju zdielany uzol a nahradzaju ho novym, stary vyradia. Citany uzol musi byt stale zivy
+		/// (kontrolna hodnota), na konci musi byt kazdy vytvoreny uzol prave raz zruseny.
+		/// </summary>
+		/// <param name = "threadCount"> Pocet vlakien. </param>
+		/// <param name = "iterations"> Pocet nahradeni, o ktore sa pokusi kazde vlakno. </param>
+		void checkEpochReplacing(int threadCount, int iterations)
+		{
+			const long long createdBefore = countedCreated;
+			const long long destroyedBefore = countedDestroyed;
+			std::atomic<bool> alive(true);
+			{
+				structures::EpochReclamation<CountedNode> reclamation;
+				std::atomic<CountedNode*> shared(new CountedNode(0));
+
+				std::vector<std::thread> threads;
+				for (int thread = 0; thread < threadCount; thread++)
+				{
+					threads.emplace_back([&]()
+					{
+						for (int i = 0; i < iterations; i++)
+						{
+							structures::EpochReclamation<CountedNode>::Guard guard(reclamation);
+							CountedNode* current = shared.load(std::memory_order_acquire);
+							if (current->check != ~current->value)
+							{
+								alive = false;
+							}
+							CountedNode* replacement = new CountedNode(current->value + 1);
+							if (shared.compare_exchange_strong(current, replacement, std::memory_order_acq_rel))
+							{
+								guard.retire(current);
+							}
+							else
+							{
+								delete replacement;
+							}
+						}
+					});
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+				delete shared.load();
+			}
+			NATIVE_CHECK(alive);
+			NATIVE_CHECK(countedCreated - createdBefore == countedDestroyed - destroyedBefore);
+		}
+
+		/// <summary>
+		/// Kazde vlakno strieda push a tryPop, vklada cisla so svojim indexom v hornych bitoch.
+		/// Na konci sa zvysok zasobnika vyprazdni a skontroluje sa pocet a sucet vsetkych odobranych prvkov.
+		/// </summary>
+		/// <param name = "eliminationSize"> Velkost pola eliminacie, 0 bez eliminacie. </param>
+		/// <param name = "threadCount"> Pocet vlakien. </param>
+		/// <param name = "perThread"> Pocet prvkov, ktore vlozi kazde vlakno. </param>
+		void checkTreiberStress(size_t eliminationSize, int threadCount, long long perThread)
+		{
+			structures::TreiberStack<long long> stack(eliminationSize);
+			std::atomic<long long> popped(0);
+			std::atomic<long long> sum(0);
+
+			std::vector<std::thread> threads;
+			for (int thread = 0; thread < threadCount; thread++)
+			{
+				threads.emplace_back([&stack, &popped, &sum, thread, perThread]()
+				{
+					long long localCount = 0;
+					long long localSum = 0;
+					long long item;
+					for (long long i = 1; i <= perThread; i++)
+					{
+						stack.push((static_cast<long long>(thread) << 40) | i);
+						// Kazde tretie kolo sa neodobera, zasobnik tak postupne rastie.
+						if (i % 3 != 0 && stack.tryPop(item))
+						{
+							localCount++;
+							localSum += item;
+						}
+					}
+					popped += localCount;
+					sum += localSum;
+				});
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			long long item;
+			while (stack.tryPop(item))
+			{
+				popped++;
+				sum += item;
+			}
+			long long expected = 0;
+			for (int thread = 0; thread < threadCount; thread++)
+			{
+				expected += perThread * (static_cast<long long>(thread) << 40) + perThread * (perThread + 1) / 2;
+			}
+			NATIVE_CHECK(popped == threadCount * perThread);
+			NATIVE_CHECK(sum == expected);
+			NATIVE_CHECK(stack.size() == 0);
+		}
+	}
+
+	void testEpochReclamation()
+	{
+		checkEpochPinning();
+		checkEpochReplacing(4, 50000);
+	}
+
+	void testTreiberStack()
+	{
+		// Jednovlaknove spravanie: poradie, prazdny zasobnik, kopia a priradenie.
+		structures::TreiberStack<int> stack;
+		for (int i = 0; i < 10; i++)
+		{
+			stack.push(i);
+		}
+		NATIVE_CHECK(stack.size() == 10);
+		NATIVE_CHECK(stack.peek() == 9);
+
+		structures::TreiberStack<int> copy(stack);
+		structures::TreiberStack<int> assigned(4);
+		assigned.push(100);
+		assigned = stack;
+		for (int i = 9; i >= 0; i--)
+		{
+			NATIVE_CHECK(stack.pop() == i);
+			NATIVE_CHECK(copy.pop() == i);
+			NATIVE_CHECK(assigned.pop() == i);
+		}
+		int item = -1;
+		NATIVE_CHECK(!stack.tryPop(item));
+		bool thrown = false;
+		try
+		{
+			stack.pop();
+		}
+		catch (const std::out_of_range&)
+		{
+			thrown = true;
+		}
+		NATIVE_CHECK(thrown);
+
+		// Sucasne push a tryPop, bez eliminacie a s eliminaciou.
+		checkTreiberStress(0, 4, 200000);
+		checkTreiberStress(8, 4, 200000);
+		checkTreiberStress(1, 8, 50000);
+	}
+}
@@ -10,7 +10,7 @@ namespace structures
 	/// <summary> Pole. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v poli. </typepram>
 	template<typename T> 
-	class Array	: public Structure
+	class Array final : public Structure
 	{
 	public:
 		/// <summary> Konstruktor vytvori pole o velkosti size prvkov. </summary>
@@ -34,6 +34,10 @@ namespace structures
 		/// <returns> Pocet prvkov v poli. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru pole obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru pole obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Struktura (pole), z ktorej ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa toto pole nachadza po priradeni. </returns>
@@ -74,6 +78,26 @@ namespace structures
 		/// <exception cref="std::out_of_range"> Vyhodena, ak zaciatocne alebo koncove indexy nepatria do prislusnych poli. </exception> 
 		static void copy(const Array<T>& src, const int srcStartIndex, Array<T>& dest, const int destStartIndex, const int length);
 
+		/// <summary> Vrati adresu prveho prvku pola. Prvky pola su v pamati ulozene za sebou. </summary>
+		/// <returns> Adresa prveho prvku pola, pre prazdne pole nullptr. </returns>
+		/// <remarks> Nekontroluje indexy, je urcena pre rychle prechody polom. </remarks>
+		T* data();
+
+		/// <summary> Vrati konstantnu adresu prveho prvku pola. Prvky pola su v pamati ulozene za sebou. </summary>
+		/// <returns> Adresa prveho prvku pola, pre prazdne pole nullptr. </returns>
+		/// <remarks> Nekontroluje indexy, je urcena pre rychle prechody polom. </remarks>
+		const T* data() const;
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok pola. </summary>
+		/// <param name = "function"> Volana funkcia, dostane adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function);
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok pola. </summary>
+		/// <param name = "function"> Volana funkcia, dostane konstantnu adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function) const;
+
 	private:
 		/// <summary> Vektor s datami. </summary>
 		Vector* vector_;
@@ -167,6 +191,17 @@ namespace structures
 		return size_;
 	}
 
+	template<typename T>
+	inline MemoryUsage Array<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(Array<T>));
+		if (this->vector_ != nullptr)
+		{
+			result.addAllocation(this->vector_->memoryUsage());
+		}
+		return result;
+	}
+
 	template<typename T>
 	T& Array<T>::operator[](const int index)
 	{
@@ -195,6 +230,42 @@ namespace structures
 		Vector::copy(*src.vector_, src.mapFunction(srcStartIndex), *dest.vector_, dest.mapFunction(destStartIndex), src.mapFunction(length));
 	}
 
+	template<typename T>
+	inline T* Array<T>::data()
+	{
+		return this->size_ > 0 ? reinterpret_cast<T*>(this->vector_->getBytePointer(0)) : nullptr;
+	}
+
+	template<typename T>
+	inline const T* Array<T>::data() const
+	{
+		return this->size_ > 0 ? reinterpret_cast<const T*>(this->vector_->getBytePointer(0)) : nullptr;
+	}
+
+	template<typename T>
+	template<typename Function>
+	inline void Array<T>::forEach(Function function)
+	{
+		T* item = this->data();
+		T* end = item + this->size_;
+		for (; item != end; ++item)
+		{
+			function(*item);
+		}
+	}
+
+	template<typename T>
+	template<typename Function>
+	inline void Array<T>::forEach(Function function) const
+	{
+		const T* item = this->data();
+		const T* end = item + this->size_;
+		for (; item != end; ++item)
+		{
+			function(*item);
+		}
+	}
+
 	template<typename T>
 	inline int Array<T>::mapFunction(const int index) const
 	{
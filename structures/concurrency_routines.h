@@ -0,0 +1,87 @@
+#pragma once
+
+// <atomic> a <thread> nie su pri preklade s /clr k dispozicii, subezne struktury sa pouzivaju z nativnych prekladovych jednotiek.
+#ifdef _M_CEE
+#error "Concurrent structures require native compilation, <atomic> and <thread> are not available with /clr."
+#endif
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+/// <summary> Naznaci procesoru, ze vlakno caka v cykle (instrukcia pause). </summary>
+#define DS_CPU_RELAX() _mm_pause()
+#else
+/// <summary> Naznaci procesoru, ze vlakno caka v cykle. </summary>
+#define DS_CPU_RELAX() std::atomic_signal_fence(std::memory_order_seq_cst)
+#endif
+
+namespace structures
+{
+	/// <summary> Kniznicna trieda obsahujuca spolocne konstanty subeznych struktur. </summary>
+	class ConcurrencyRoutines
+	{
+	public:
+		/// <summary> Velkost riadku cache. Udaje zapisovane roznymi vlaknami sa od seba oddeluju aspon o tuto velkost. </summary>
+		static const size_t CACHE_LINE_SIZE = 64;
+	private:
+		/// <summary> Sukromny konstruktor znemoznuje vytvorenie instancie kniznicnej triedy. </summary>
+		ConcurrencyRoutines();
+	};
+
+	/// <summary> Exponencialne cakanie pri opakovanych neuspesnych pokusoch o pristup k zdielanym udajom. </summary>
+	/// <remarks> Najprv kratko toci v cykle, potom prenechava procesor inym vlaknam, nakoniec na chvilu uspi vlakno. </remarks>
+	class Backoff
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		Backoff();
+
+		/// <summary> Pocka, cim viac neuspesnych pokusov uz bolo, tym dlhsie. </summary>
+		void pause();
+
+		/// <summary> Zabudne neuspesne pokusy, dalsie cakanie bude opat najkratsie. </summary>
+		void reset();
+	private:
+		/// <summary> Pocet pokusov, pocas ktorych sa toci v cykle. </summary>
+		static const unsigned SPIN_LIMIT = 6;
+		/// <summary> Pocet pokusov, po ktorom sa vlakno uspava namiesto prenechania procesora. </summary>
+		static const unsigned YIELD_LIMIT = 16;
+
+		/// <summary> Pocet doterajsich neuspesnych pokusov. </summary>
+		unsigned attempt_;
+	};
+
+	inline Backoff::Backoff() :
+		attempt_(0)
+	{
+	}
+
+	inline void Backoff::pause()
+	{
+		if (attempt_ < SPIN_LIMIT)
+		{
+			for (unsigned i = 0; i < (1u << attempt_); i++)
+			{
+				DS_CPU_RELAX();
+			}
+		}
+		else if (attempt_ < YIELD_LIMIT)
+		{
+			std::this_thread::yield();
+		}
+		else
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(50));
+			return;
+		}
+		attempt_++;
+	}
+
+	inline void Backoff::reset()
+	{
+		attempt_ = 0;
+	}
+}
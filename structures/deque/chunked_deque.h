@@ -0,0 +1,474 @@
+#pragma once
+
+#include "deque.h"
+#include "../array/array.h"
+#include "../ds_routines.h"
+
+#include <stdexcept>
+
+namespace structures
+{
+	/// <summary> Obojstranny front implementovany useky pevnej velkosti. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v obojstrannom fronte. </typepram>
+	/// <typeparam name = "K"> Pocet prvkov v jednom useku. </typepram>
+	/// <remarks>
+	/// Prvky lezia v usekoch po K prvkov, na useky ukazuje mapa (pole ukazovatelov) s volnym miestom na oboch stranach.
+	/// Pridanie a odobratie na oboch koncoch trva O(1), novy usek sa alokuje raz za K prvkov a pri rozsireni mapy
+	/// sa kopiruju iba ukazovatele na useky, nie prvky. Jeden uvolneny usek si front necha v zalohe,
+	/// aby striedave pridavanie a odoberanie na hranici useku nealokovalo pamat.
+	/// </remarks>
+	template<typename T, int K = 64>
+	class ChunkedDeque final : public Deque<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		ChunkedDeque();
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Obojstranny front, z ktoreho sa prevezmu vlastnosti. </param>
+		ChunkedDeque(const ChunkedDeque<T, K>& other);
+
+		/// <summary> Destruktor. </summary>
+		~ChunkedDeque();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat obojstranneho frontu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov v obojstrannom fronte. </summary>
+		/// <returns> Pocet prvkov v obojstrannom fronte. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru obojstranny front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru obojstranny front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Obojstranny front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento obojstranny front nachadza po priradeni. </returns>
+		Deque<T>& operator=(const Deque<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Obojstranny front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento obojstranny front nachadza po priradeni. </returns>
+		ChunkedDeque<T, K>& operator=(const ChunkedDeque<T, K>& other);
+
+		/// <summary> Vymaze obojstranny front. </summary>
+		void clear() override;
+
+		/// <summary> Prida prvok na zaciatok obojstranneho frontu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void pushFront(const T& data) override;
+
+		/// <summary> Prida prvok na zaciatok obojstranneho frontu. Prvok presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void pushFront(T&& data) override;
+
+		/// <summary> Prida prvok na koniec obojstranneho frontu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void pushBack(const T& data) override;
+
+		/// <summary> Prida prvok na koniec obojstranneho frontu. Prvok presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void pushBack(T&& data) override;
+
+		/// <summary> Odstrani prvok zo zaciatku obojstranneho frontu. </summary>
+		/// <returns> Prvok na zaciatku obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		T popFront() override;
+
+		/// <summary> Odstrani prvok z konca obojstranneho frontu. </summary>
+		/// <returns> Prvok na konci obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		T popBack() override;
+
+		/// <summary> Vrati prvok na zaciatku obojstranneho frontu. </summary>
+		/// <returns> Prvok na zaciatku obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		T& peekFront() override;
+
+		/// <summary> Vrati prvok na zaciatku obojstranneho frontu. </summary>
+		/// <returns> Prvok na zaciatku obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		const T peekFront() const override;
+
+		/// <summary> Vrati prvok na konci obojstranneho frontu. </summary>
+		/// <returns> Prvok na konci obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		T& peekBack() override;
+
+		/// <summary> Vrati prvok na konci obojstranneho frontu. </summary>
+		/// <returns> Prvok na konci obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		const T peekBack() const override;
+
+		/// <summary> Vrati adresou prvok na indexe (index 0 je zaciatok obojstranneho frontu). </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Adresa prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do obojstranneho frontu. </exception>
+		T& operator[](const int index);
+
+		/// <summary> Vrati hodnotou prvok na indexe (index 0 je zaciatok obojstranneho frontu). </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Hodnota prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do obojstranneho frontu. </exception>
+		const T operator[](const int index) const;
+
+	private:
+		/// <summary> Usek obojstranneho frontu. </summary>
+		struct Chunk
+		{
+			/// <summary> Prvky useku. </summary>
+			T items[K];
+		};
+
+		/// <summary> Mapa usekov, nullptr na miestach bez prvkov. </summary>
+		Array<Chunk*>* map_;
+		/// <summary> Uvolneny usek odlozeny na dalsie pouzitie, alebo nullptr. </summary>
+		Chunk* spare_;
+		/// <summary> Pozicia prveho prvku, usek start_ / K, miesto v useku start_ % K. </summary>
+		size_t start_;
+		/// <summary> Pocet prvkov v obojstrannom fronte. </summary>
+		size_t size_;
+		/// <summary> Pocet alokovanych usekov v mape. </summary>
+		size_t chunkCount_;
+
+	private:
+		/// <summary> Pociatocna velkost mapy. </summary>
+		static const size_t INITIAL_MAP_SIZE = 8;
+
+		/// <summary> Vrati adresu prvku na pozicii. </summary>
+		/// <param name = "position"> Pozicia prvku v mape. </param>
+		/// <returns> Adresa prvku. </returns>
+		T& at(const size_t position) const;
+
+		/// <summary> Zabezpeci, aby na danom mieste mapy bol usek. Pouzije zalozny usek, ak existuje. </summary>
+		/// <param name = "chunkIndex"> Index useku v mape. </param>
+		void acquireChunk(const size_t chunkIndex);
+
+		/// <summary> Odstrani usek z mapy. Ak zaloha este nie je obsadena, usek si ponecha. </summary>
+		/// <param name = "chunkIndex"> Index useku v mape. </param>
+		void releaseChunk(const size_t chunkIndex);
+
+		/// <summary> Uvolni miesto na okraji mapy a obsadene useky umiestni do jej stredu. </summary>
+		/// <remarks> Mapu zdvojnasobi, iba ak je obsadena viac ako z polovice, inak useky presunie v existujucej mape. </remarks>
+		void growMap();
+
+		/// <summary> Po vyprazdneni presunie zaciatok do stredu mapy. </summary>
+		void recenter();
+	};
+
+	template<typename T, int K>
+	inline ChunkedDeque<T, K>::ChunkedDeque() :
+		Deque<T>(),
+		map_(new Array<Chunk*>(INITIAL_MAP_SIZE)),
+		spare_(nullptr),
+		start_(0),
+		size_(0),
+		chunkCount_(0)
+	{
+		recenter();
+	}
+
+	template<typename T, int K>
+	inline ChunkedDeque<T, K>::ChunkedDeque(const ChunkedDeque<T, K>& other) :
+		ChunkedDeque()
+	{
+		*this = other;
+	}
+
+	template<typename T, int K>
+	inline ChunkedDeque<T, K>::~ChunkedDeque()
+	{
+		clear();
+		delete spare_;
+		spare_ = nullptr;
+		delete map_;
+		map_ = nullptr;
+	}
+
+	template<typename T, int K>
+	inline Structure* ChunkedDeque<T, K>::clone() const
+	{
+		return new ChunkedDeque<T, K>(*this);
+	}
+
+	template<typename T, int K>
+	inline size_t ChunkedDeque<T, K>::size() const
+	{
+		return size_;
+	}
+
+	template<typename T, int K>
+	inline MemoryUsage ChunkedDeque<T, K>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(ChunkedDeque<T, K>));
+		result.addAllocation(map_->memoryUsage());
+		result.addAllocations(sizeof(Chunk), chunkCount_, chunkCount_ * sizeof(Chunk) - size_ * sizeof(T));
+		if (spare_ != nullptr)
+		{
+			result.addAllocations(sizeof(Chunk), 1, sizeof(Chunk));
+		}
+		return result;
+	}
+
+	template<typename T, int K>
+	inline Deque<T>& ChunkedDeque<T, K>::operator=(const Deque<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const ChunkedDeque<T, K>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline ChunkedDeque<T, K>& ChunkedDeque<T, K>::operator=(const ChunkedDeque<T, K>& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			for (size_t i = 0; i < other.size_; i++)
+			{
+				pushBack(other.at(other.start_ + i));
+			}
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline void ChunkedDeque<T, K>::clear()
+	{
+		if (size_ > 0)
+		{
+			const size_t last = (start_ + size_ - 1) / K;
+			for (size_t chunkIndex = start_ / K; chunkIndex <= last; chunkIndex++)
+			{
+				releaseChunk(chunkIndex);
+			}
+			size_ = 0;
+		}
+		recenter();
+	}
+
+	template<typename T, int K>
+	inline void ChunkedDeque<T, K>::pushFront(const T& data)
+	{
+		pushFront(T(data));
+	}
+
+	template<typename T, int K>
+	inline void ChunkedDeque<T, K>::pushFront(T&& data)
+	{
+		if (start_ == 0)
+		{
+			growMap();
+		}
+		start_--;
+		if (size_ == 0 || start_ % K == K - 1)
+		{
+			acquireChunk(start_ / K);
+		}
+		at(start_) = std::move(data);
+		size_++;
+	}
+
+	template<typename T, int K>
+	inline void ChunkedDeque<T, K>::pushBack(const T& data)
+	{
+		pushBack(T(data));
+	}
+
+	template<typename T, int K>
+	inline void ChunkedDeque<T, K>::pushBack(T&& data)
+	{
+		if (start_ + size_ == map_->size() * K)
+		{
+			growMap();
+		}
+		const size_t position = start_ + size_;
+		if (size_ == 0 || position % K == 0)
+		{
+			acquireChunk(position / K);
+		}
+		at(position) = std::move(data);
+		size_++;
+	}
+
+	template<typename T, int K>
+	inline T ChunkedDeque<T, K>::popFront()
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("ChunkedDeque<T, K>::popFront: Deque is empty.");
+		}
+		T result = std::move(at(start_));
+		start_++;
+		size_--;
+		if (size_ == 0 || start_ % K == 0)
+		{
+			releaseChunk((start_ - 1) / K);
+		}
+		if (size_ == 0)
+		{
+			recenter();
+		}
+		return result;
+	}
+
+	template<typename T, int K>
+	inline T ChunkedDeque<T, K>::popBack()
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("ChunkedDeque<T, K>::popBack: Deque is empty.");
+		}
+		const size_t position = start_ + size_ - 1;
+		T result = std::move(at(position));
+		size_--;
+		if (size_ == 0 || position % K == 0)
+		{
+			releaseChunk(position / K);
+		}
+		if (size_ == 0)
+		{
+			recenter();
+		}
+		return result;
+	}
+
+	template<typename T, int K>
+	inline T& ChunkedDeque<T, K>::peekFront()
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("ChunkedDeque<T, K>::peekFront: Deque is empty.");
+		}
+		return at(start_);
+	}
+
+	template<typename T, int K>
+	inline const T ChunkedDeque<T, K>::peekFront() const
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("ChunkedDeque<T, K>::peekFront: Deque is empty.");
+		}
+		return at(start_);
+	}
+
+	template<typename T, int K>
+	inline T& ChunkedDeque<T, K>::peekBack()
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("ChunkedDeque<T, K>::peekBack: Deque is empty.");
+		}
+		return at(start_ + size_ - 1);
+	}
+
+	template<typename T, int K>
+	inline const T ChunkedDeque<T, K>::peekBack() const
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("ChunkedDeque<T, K>::peekBack: Deque is empty.");
+		}
+		return at(start_ + size_ - 1);
+	}
+
+	template<typename T, int K>
+	inline T& ChunkedDeque<T, K>::operator[](const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_, "ChunkedDeque<T, K>::operator[]: Invalid index.");
+		return at(start_ + index);
+	}
+
+	template<typename T, int K>
+	inline const T ChunkedDeque<T, K>::operator[](const int index) const
+	{
+		DSRoutines::rangeCheckExcept(index, size_, "ChunkedDeque<T, K>::operator[]: Invalid index.");
+		return at(start_ + index);
+	}
+
+	template<typename T, int K>
+	inline T& ChunkedDeque<T, K>::at(const size_t position) const
+	{
+		return map_->data()[position / K]->items[position % K];
+	}
+
+	template<typename T, int K>
+	inline void ChunkedDeque<T, K>::acquireChunk(const size_t chunkIndex)
+	{
+		Chunk*& chunk = map_->data()[chunkIndex];
+		if (spare_ != nullptr)
+		{
+			chunk = spare_;
+			spare_ = nullptr;
+		}
+		else
+		{
+			chunk = new Chunk();
+		}
+		chunkCount_++;
+	}
+
+	template<typename T, int K>
+	inline void ChunkedDeque<T, K>::releaseChunk(const size_t chunkIndex)
+	{
+		Chunk*& chunk = map_->data()[chunkIndex];
+		if (spare_ == nullptr)
+		{
+			spare_ = chunk;
+		}
+		else
+		{
+			delete chunk;
+		}
+		chunk = nullptr;
+		chunkCount_--;
+	}
+
+	template<typename T, int K>
+	inline void ChunkedDeque<T, K>::growMap()
+	{
+		const size_t mapSize = map_->size();
+		const size_t first = start_ / K;
+		const size_t used = size_ > 0 ? (start_ + size_ - 1) / K - first + 1 : 0;
+		if (2 * used <= mapSize)
+		{
+			// Pri pouziti ako front sa prvky posuvaju jednym smerom, mapa by inak rastla s poctom operacii, nie s poctom prvkov.
+			const size_t newFirst = (mapSize - used) / 2;
+			Chunk** chunks = map_->data();
+			if (used > 0)
+			{
+				Array<Chunk*>::copy(*map_, static_cast<int>(first), *map_, static_cast<int>(newFirst), static_cast<int>(used));
+			}
+			for (size_t i = first; i < first + used; i++)
+			{
+				if (i < newFirst || i >= newFirst + used)
+				{
+					chunks[i] = nullptr;
+				}
+			}
+			start_ = newFirst * K + start_ % K;
+			return;
+		}
+		const size_t newMapSize = 2 * mapSize;
+		const size_t newFirst = (newMapSize - used) / 2;
+		Array<Chunk*>* newMap = new Array<Chunk*>(newMapSize);
+		if (used > 0)
+		{
+			Array<Chunk*>::copy(*map_, static_cast<int>(first), *newMap, static_cast<int>(newFirst), static_cast<int>(used));
+		}
+		delete map_;
+		map_ = newMap;
+		start_ = newFirst * K + start_ % K;
+	}
+
+	template<typename T, int K>
+	inline void ChunkedDeque<T, K>::recenter()
+	{
+		start_ = map_->size() / 2 * K;
+	}
+}
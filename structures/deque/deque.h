@@ -0,0 +1,110 @@
+#pragma once
+
+#include "../structure.h"
+
+namespace structures
+{
+	/// <summary> Obojstranny front (deque). </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v obojstrannom fronte. </typepram>
+	template<typename T>
+	class Deque : public Structure
+	{
+	public:
+		/// <summary> Destruktor. </summary>
+		~Deque();
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Struktura (obojstranny front), z ktorej ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento obojstranny front nachadza po priradeni. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, vstupny parameter nie je obojstranny front. </exception>
+		/// <remarks> Vyuziva typovy operator priradenia. </remarks>
+		Structure& operator=(const Structure& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Obojstranny front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento obojstranny front nachadza po priradeni. </returns>
+		virtual Deque<T>& operator=(const Deque<T>& other) = 0;
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat udajovej struktury. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		virtual Structure* clone() const = 0;
+
+		/// <summary> Vrati pocet prvkov v obojstrannom fronte. </summary>
+		/// <returns> Pocet prvkov v obojstrannom fronte. </returns>
+		virtual size_t size() const = 0;
+
+		/// <summary> Vymaze obojstranny front. </summary>
+		virtual void clear() = 0;
+
+		/// <summary> Prida prvok na zaciatok obojstranneho frontu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		virtual void pushFront(const T& data) = 0;
+
+		/// <summary> Prida prvok na zaciatok obojstranneho frontu. Prvok presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		virtual void pushFront(T&& data) = 0;
+
+		/// <summary> Prida prvok na koniec obojstranneho frontu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		virtual void pushBack(const T& data) = 0;
+
+		/// <summary> Prida prvok na koniec obojstranneho frontu. Prvok presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		virtual void pushBack(T&& data) = 0;
+
+		/// <summary> Odstrani prvok zo zaciatku obojstranneho frontu. </summary>
+		/// <returns> Prvok na zaciatku obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		virtual T popFront() = 0;
+
+		/// <summary> Odstrani prvok z konca obojstranneho frontu. </summary>
+		/// <returns> Prvok na konci obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		virtual T popBack() = 0;
+
+		/// <summary> Vrati prvok na zaciatku obojstranneho frontu. </summary>
+		/// <returns> Prvok na zaciatku obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		virtual T& peekFront() = 0;
+
+		/// <summary> Vrati prvok na zaciatku obojstranneho frontu. </summary>
+		/// <returns> Prvok na zaciatku obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		virtual const T peekFront() const = 0;
+
+		/// <summary> Vrati prvok na konci obojstranneho frontu. </summary>
+		/// <returns> Prvok na konci obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		virtual T& peekBack() = 0;
+
+		/// <summary> Vrati prvok na konci obojstranneho frontu. </summary>
+		/// <returns> Prvok na konci obojstranneho frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je obojstranny front prazdny. </exception>
+		virtual const T peekBack() const = 0;
+
+	protected:
+		/// <summary> Konstruktor. </summary>
+		Deque();
+	};
+
+	template<typename T>
+	inline Deque<T>::~Deque()
+	{
+	}
+
+	template<typename T>
+	inline Structure& Deque<T>::operator=(const Structure& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const Deque<T>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline Deque<T>::Deque() :
+		Structure()
+	{
+	}
+}
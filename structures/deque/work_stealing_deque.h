@@ -0,0 +1,324 @@
+#pragma once
+
+#include "../structure.h"
+#include "../ds_routines.h"
+#include "../concurrency_routines.h"
+
+#include <type_traits>
+#include <stdexcept>
+
+namespace structures
+{
+	/// <summary> Obojstranny front na rozdelovanie prace medzi vlakna (work-stealing deque, Chase-Lev). </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v obojstrannom fronte. </typepram>
+	/// <remarks>
+	/// Vlastnik frontu pridava a odobera prvky na spodnom konci (push, tryPop) ako v zasobniku, ostatne vlakna
+	/// kradnu prvky z horneho konca (trySteal). Vlastnik sa s ostatnymi vlaknami synchronizuje iba pri poslednom prvku.
+	/// Kruhove pole rastie, stare polia sa neuvolnuju hned, lebo z nich este mozu citat kradnuce vlakna,
+	/// uchovavaju sa v zozname a uvolnia sa az v destruktore alebo v clear.
+	/// Poradie operacii nad pamatou podla N. M. Le a kol., Correct and Efficient Work-Stealing for Weak Memory Models (2013).
+	/// Kopirovanie, priradenie a clear nie su bezpecne pri sucasnom pouzivani frontu.
+	/// </remarks>
+	template<typename T>
+	class WorkStealingDeque final : public Structure
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque<T>: T must be trivially copyable.");
+	public:
+		/// <summary> Konstruktor. </summary>
+		WorkStealingDeque();
+
+		/// <summary> Parametricky konstruktor. </summary>
+		/// <param name = "capacity"> Pociatocna kapacita, zaokruhli sa nahor na mocninu 2 (aspon 2). </param>
+		WorkStealingDeque(const size_t capacity);
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Obojstranny front, z ktoreho sa prevezmu vlastnosti. </param>
+		WorkStealingDeque(const WorkStealingDeque<T>& other);
+
+		/// <summary> Destruktor. </summary>
+		~WorkStealingDeque();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat obojstranneho frontu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov v obojstrannom fronte. </summary>
+		/// <returns> Pocet prvkov v obojstrannom fronte. </returns>
+		/// <remarks> Pri sucasnom pouzivani frontu je vysledok iba odhad. </remarks>
+		size_t size() const override;
+
+		/// <summary> Vrati aktualnu kapacitu obojstranneho frontu. </summary>
+		/// <returns> Kapacita obojstranneho frontu. </returns>
+		size_t capacity() const;
+
+		/// <summary> Vrati udaje o pamati, ktoru obojstranny front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru obojstranny front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Struktura (obojstranny front), z ktorej ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento obojstranny front nachadza po priradeni. </returns>
+		Structure& operator=(const Structure& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Obojstranny front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento obojstranny front nachadza po priradeni. </returns>
+		WorkStealingDeque<T>& operator=(const WorkStealingDeque<T>& other);
+
+		/// <summary> Vymaze obojstranny front a uvolni stare polia. </summary>
+		void clear();
+
+		/// <summary> Prida prvok na spodny koniec. Vola iba vlastnik. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void push(const T& data);
+
+		/// <summary> Pokusi sa odobrat prvok zo spodneho konca. Vola iba vlastnik. </summary>
+		/// <param name = "data"> Premenna, do ktorej sa prvok zapise. </param>
+		/// <returns> true, ak bol prvok odobrany, false, ak je front prazdny alebo posledny prvok ukradlo ine vlakno. </returns>
+		bool tryPop(T& data);
+
+		/// <summary> Pokusi sa ukradnut prvok z horneho konca. Moze volat lubovolne vlakno. </summary>
+		/// <param name = "data"> Premenna, do ktorej sa prvok zapise. </param>
+		/// <returns> true, ak bol prvok ukradnuty, false, ak je front prazdny alebo prvok ziskalo ine vlakno. </returns>
+		bool trySteal(T& data);
+
+	private:
+		/// <summary> Kruhove pole prvkov. </summary>
+		struct Buffer
+		{
+			/// <summary> Maska pozicie v poli (kapacita - 1). </summary>
+			long long mask;
+			/// <summary> Prvky pola. </summary>
+			std::atomic<T>* items;
+			/// <summary> Predchadzajuce (mensie) pole, alebo nullptr. </summary>
+			Buffer* previous;
+		};
+
+		/// <summary> Aktualne kruhove pole. </summary>
+		std::atomic<Buffer*> buffer_;
+
+		/// <summary> Oddeluje horny koniec od nemennych udajov. </summary>
+		char paddingTop_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+		/// <summary> Pozicia horneho konca, z ktoreho kradnu ostatne vlakna. </summary>
+		std::atomic<long long> top_;
+
+		/// <summary> Oddeluje spodny koniec od horneho. </summary>
+		char paddingBottom_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+		/// <summary> Pozicia za spodnym koncom, na ktorom pracuje vlastnik. </summary>
+		std::atomic<long long> bottom_;
+
+		/// <summary> Oddeluje spodny koniec od nasledujucich objektov v pamati. </summary>
+		char paddingEnd_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+
+	private:
+		/// <summary> Vytvori kruhove pole. </summary>
+		/// <param name = "capacity"> Kapacita, mocnina 2. </param>
+		/// <param name = "previous"> Predchadzajuce pole. </param>
+		/// <returns> Nove pole. </returns>
+		static Buffer* createBuffer(const size_t capacity, Buffer* previous);
+
+		/// <summary> Uvolni pole a vsetky predchadzajuce polia. </summary>
+		/// <param name = "buffer"> Uvolnovane pole. </param>
+		static void destroyBuffers(Buffer* buffer);
+
+		/// <summary> Zdvojnasobi kapacitu pola, prvky medzi top a bottom prekopiruje. </summary>
+		/// <param name = "buffer"> Aktualne pole. </param>
+		/// <param name = "top"> Pozicia horneho konca. </param>
+		/// <param name = "bottom"> Pozicia za spodnym koncom. </param>
+		/// <returns> Nove pole. </returns>
+		Buffer* grow(Buffer* buffer, const long long top, const long long bottom);
+	};
+
+	template<typename T>
+	inline WorkStealingDeque<T>::WorkStealingDeque() :
+		WorkStealingDeque(256)
+	{
+	}
+
+	template<typename T>
+	inline WorkStealingDeque<T>::WorkStealingDeque(const size_t capacity) :
+		Structure(),
+		buffer_(createBuffer(DSRoutines::ceilPowerOfTwo(capacity < 2 ? 2 : capacity), nullptr)),
+		top_(0),
+		bottom_(0)
+	{
+	}
+
+	template<typename T>
+	inline WorkStealingDeque<T>::WorkStealingDeque(const WorkStealingDeque<T>& other) :
+		WorkStealingDeque(other.capacity())
+	{
+		*this = other;
+	}
+
+	template<typename T>
+	inline WorkStealingDeque<T>::~WorkStealingDeque()
+	{
+		destroyBuffers(buffer_.load(std::memory_order_relaxed));
+		buffer_.store(nullptr, std::memory_order_relaxed);
+	}
+
+	template<typename T>
+	inline Structure* WorkStealingDeque<T>::clone() const
+	{
+		return new WorkStealingDeque<T>(*this);
+	}
+
+	template<typename T>
+	inline size_t WorkStealingDeque<T>::size() const
+	{
+		const long long bottom = bottom_.load(std::memory_order_acquire);
+		const long long top = top_.load(std::memory_order_acquire);
+		return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+	}
+
+	template<typename T>
+	inline size_t WorkStealingDeque<T>::capacity() const
+	{
+		return static_cast<size_t>(buffer_.load(std::memory_order_acquire)->mask + 1);
+	}
+
+	template<typename T>
+	inline MemoryUsage WorkStealingDeque<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(WorkStealingDeque<T>), 3 * ConcurrencyRoutines::CACHE_LINE_SIZE);
+		const Buffer* buffer = buffer_.load(std::memory_order_acquire);
+		result.addAllocations(sizeof(Buffer) + capacity() * sizeof(std::atomic<T>), 1, (capacity() - size()) * sizeof(std::atomic<T>));
+		for (const Buffer* retired = buffer->previous; retired != nullptr; retired = retired->previous)
+		{
+			const size_t bytes = sizeof(Buffer) + static_cast<size_t>(retired->mask + 1) * sizeof(std::atomic<T>);
+			result.addAllocations(bytes, 1, bytes);
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline Structure& WorkStealingDeque<T>::operator=(const Structure& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const WorkStealingDeque<T>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline WorkStealingDeque<T>& WorkStealingDeque<T>::operator=(const WorkStealingDeque<T>& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			const Buffer* otherBuffer = other.buffer_.load(std::memory_order_acquire);
+			const long long otherBottom = other.bottom_.load(std::memory_order_acquire);
+			for (long long i = other.top_.load(std::memory_order_acquire); i < otherBottom; i++)
+			{
+				push(otherBuffer->items[i & otherBuffer->mask].load(std::memory_order_relaxed));
+			}
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline void WorkStealingDeque<T>::clear()
+	{
+		Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+		destroyBuffers(buffer->previous);
+		buffer->previous = nullptr;
+		top_.store(0, std::memory_order_relaxed);
+		bottom_.store(0, std::memory_order_release);
+	}
+
+	template<typename T>
+	inline void WorkStealingDeque<T>::push(const T& data)
+	{
+		const long long bottom = bottom_.load(std::memory_order_relaxed);
+		const long long top = top_.load(std::memory_order_acquire);
+		Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+		if (bottom - top > buffer->mask)
+		{
+			buffer = grow(buffer, top, bottom);
+		}
+		buffer->items[bottom & buffer->mask].store(data, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom_.store(bottom + 1, std::memory_order_relaxed);
+	}
+
+	template<typename T>
+	inline bool WorkStealingDeque<T>::tryPop(T& data)
+	{
+		const long long bottom = bottom_.load(std::memory_order_relaxed) - 1;
+		Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+		bottom_.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		long long top = top_.load(std::memory_order_relaxed);
+		if (top > bottom)
+		{
+			// Front bol prazdny, spodny koniec sa vrati.
+			bottom_.store(bottom + 1, std::memory_order_relaxed);
+			return false;
+		}
+		data = buffer->items[bottom & buffer->mask].load(std::memory_order_relaxed);
+		if (top == bottom)
+		{
+			// Posledny prvok, o ten sa vlastnik moze pretekat s kradnucimi vlaknami.
+			const bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			bottom_.store(bottom + 1, std::memory_order_relaxed);
+			return won;
+		}
+		return true;
+	}
+
+	template<typename T>
+	inline bool WorkStealingDeque<T>::trySteal(T& data)
+	{
+		long long top = top_.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const long long bottom = bottom_.load(std::memory_order_acquire);
+		if (top >= bottom)
+		{
+			return false;
+		}
+		Buffer* buffer = buffer_.load(std::memory_order_acquire);
+		const T result = buffer->items[top & buffer->mask].load(std::memory_order_relaxed);
+		if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return false;
+		}
+		data = result;
+		return true;
+	}
+
+	template<typename T>
+	inline typename WorkStealingDeque<T>::Buffer* WorkStealingDeque<T>::createBuffer(const size_t capacity, Buffer* previous)
+	{
+		Buffer* result = new Buffer();
+		result->mask = static_cast<long long>(capacity) - 1;
+		result->items = new std::atomic<T>[capacity];
+		result->previous = previous;
+		return result;
+	}
+
+	template<typename T>
+	inline void WorkStealingDeque<T>::destroyBuffers(Buffer* buffer)
+	{
+		while (buffer != nullptr)
+		{
+			Buffer* previous = buffer->previous;
+			delete[] buffer->items;
+			delete buffer;
+			buffer = previous;
+		}
+	}
+
+	template<typename T>
+	inline typename WorkStealingDeque<T>::Buffer* WorkStealingDeque<T>::grow(Buffer* buffer, const long long top, const long long bottom)
+	{
+		Buffer* result = createBuffer(2 * static_cast<size_t>(buffer->mask + 1), buffer);
+		for (long long i = top; i < bottom; i++)
+		{
+			result->items[i & result->mask].store(buffer->items[i & buffer->mask].load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+		buffer_.store(result, std::memory_order_release);
+		return result;
+	}
+}
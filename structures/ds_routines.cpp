@@ -1,3 +1,4 @@
+#include <limits>
 #include <stdexcept>
 
 #include "ds_routines.h"
@@ -18,9 +19,13 @@ namespace structures {
 			return adtARRAY;
 
 		case adsLIST_ARRAY:
+		case adsLIST_SMALL_ARRAY:
 		case adsLIST_LINKED:
 		case adsLIST_DOUBLE_LINKED:
 		case adsLIST_CYCLICAL:
+		case adsLIST_UNROLLED:
+		case adsLIST_ROPE:
+		case adsLIST_TIERED_VECTOR:
 			return adtLIST;
 
 		case adsQUEUE_ARRAY:
@@ -29,6 +34,7 @@ namespace structures {
 
 		case adsSTACK_ARRAY:
 		case adsSTACK_LIST:
+		case adsSTACK_SEGMENTED:
 			return adtSTACK;
 
 		case adsPRIORITY_QUEUE_ARRAY_LIST_SORTED:
@@ -37,6 +43,9 @@ namespace structures {
 		case adsPRIORITY_QUEUE_TWO_LISTS:
 		case adsPRIORITY_QUEUE_DOUBLE_LAYER:
 		case adsPRIORITY_QUEUE_HEAP:
+		case adsPRIORITY_QUEUE_PAIRING_HEAP:
+		case adsPRIORITY_QUEUE_RADIX_HEAP:
+		case adsPRIORITY_QUEUE_BUCKET_QUEUE:
 			return adtPRIORITY_QUEUE;
 
 		case adsTREE_MULTI_WAY:
@@ -63,31 +72,25 @@ namespace structures {
 		}
 	}
 
-	bool DSRoutines::rangeCheck(const int index, const size_t size)
+	void DSRoutines::throwOutOfRange(const int index, const int baseIndex, const size_t size, const char* exceptionMessage)
 	{
-		return DSRoutines::rangeCheck(index, 0, size);
+		throw std::out_of_range(std::string(exceptionMessage) +
+			" Index " + std::to_string(index) +
+			" is not in [" + std::to_string(baseIndex) + ", " + std::to_string(baseIndex + static_cast<int>(size)) + ").");
 	}
 
-	bool DSRoutines::rangeCheck(const int index, const int baseIndex, const size_t size)
-	{
-		return index >= baseIndex && index < baseIndex + static_cast<int>(size);
-	}
-
-	void DSRoutines::rangeCheckExcept(const int index, const size_t size, const std::string exceptionMessage)
+	double DSRoutines::getInfinity()
 	{
-		DSRoutines::rangeCheckExcept(index, 0, size, exceptionMessage);
+		return std::numeric_limits<double>::infinity();
 	}
 
-	void DSRoutines::rangeCheckExcept(const int index, const int baseIndex, const size_t size, const std::string exceptionMessage)
+	size_t DSRoutines::ceilPowerOfTwo(const size_t value)
 	{
-		if (!DSRoutines::rangeCheck(index, baseIndex, size))
+		size_t result = 1;
+		while (result < value)
 		{
-			throw std::out_of_range(exceptionMessage);
+			result <<= 1;
 		}
-	}
-
-	double DSRoutines::getInfinity()
-	{
-		return std::numeric_limits<double>::infinity();
+		return result;
 	}
 }
\ No newline at end of file
@@ -2,8 +2,21 @@
 
 #include <string>
 #include <vector>
+#include <utility>
 #include "ds_structure_types.h"
 
+/// <summary> Kontrola indexov sa vykonava vzdy. </summary>
+#define DS_RANGE_CHECK_ALWAYS 2
+/// <summary> Kontrola indexov sa vykonava iba v ladiacom preklade (ak nie je definovane NDEBUG). </summary>
+#define DS_RANGE_CHECK_DEBUG 1
+/// <summary> Kontrola indexov sa nevykonava nikdy. </summary>
+#define DS_RANGE_CHECK_NEVER 0
+
+/// <summary> Politika kontroly indexov v strukturach. Da sa zmenit definovanim makra pri preklade. </summary>
+#ifndef DS_RANGE_CHECK
+#define DS_RANGE_CHECK DS_RANGE_CHECK_ALWAYS
+#endif
+
 namespace structures
 {
 	/// <summary> 
@@ -36,7 +49,8 @@ namespace structures
 		/// <param name = "size"> Pocet prvkov v kolekcii. </param>
 		/// <param name = "exceptionMessage"> Text vynimky, ktora je vyhodena v pripade chyby. </param>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [0, size). </exception>  
-		static void rangeCheckExcept(const int index, const size_t size, const std::string exceptionMessage);
+		/// <remarks> Riadi sa politikou DS_RANGE_CHECK. Text vynimky sa sklada az v pripade chyby. </remarks>
+		static void rangeCheckExcept(const int index, const size_t size, const char* exceptionMessage);
 
 		/// <summary> Skontroluje, ci index patri do intervalu [baseIndex, baseIndex + size). Ak nie, vyhodi vynimku std::out_of_range. </summary>
 		/// <param name = "index"> Testovan index. </param>
@@ -44,9 +58,15 @@ namespace structures
 		/// <param name = "size"> Pocet prvkov v kolekcii. </param>
 		/// <param name = "exceptionMessage"> Text vynimky, ktora je vyhodena v pripade chyby. </param>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [baseIndex, baseIndex + size). </exception> 
-		static void rangeCheckExcept(const int index, const int baseIndex, const size_t size, const std::string exceptionMessage);
+		/// <remarks> Riadi sa politikou DS_RANGE_CHECK. Text vynimky sa sklada az v pripade chyby. </remarks>
+		static void rangeCheckExcept(const int index, const int baseIndex, const size_t size, const char* exceptionMessage);
+
+		/// <summary> Vrati, ci sa podla politiky DS_RANGE_CHECK v tomto preklade kontroluju indexy. </summary>
+		/// <returns> true, ak sa indexy kontroluju, false inak. </returns>
+		static constexpr bool isRangeCheckEnabled();
 		
 		/// <summary> Vymeni obsah dvoch premennych rovnakeho typu. </summary>
+		/// <remarks> Obsah premennych presuva, nekopiruje ho. </remarks>
 		/// <param name = "a"> Prva premenna. </param>
 		/// <param name = "b"> Druha premenna. </param>
 		template<typename T>
@@ -62,25 +82,74 @@ namespace structures
 		/// <summary> Vrati hodnotu predstavujucu kladne nekonecno. </summary>
 		/// <returns> Hodnota nekonecna. </returns>
 		static double getInfinity();
+
+		/// <summary> Vrati najmensiu mocninu 2, ktora nie je mensia ako hodnota. </summary>
+		/// <param name = "value"> Hodnota. </param>
+		/// <returns> Najmensia mocnina 2 vacsia alebo rovna hodnote, pre 0 vrati 1. </returns>
+		/// <remarks> Pouzivaju ju kruhove polia, ktore namiesto zvysku po deleni pocitaju poziciu maskou. </remarks>
+		static size_t ceilPowerOfTwo(const size_t value);
 	private:
 		/// <summary> Sukromny konstruktor znemoznuje vytvorenie instancie kniznicnej triedy. </summary>
 		DSRoutines();
 
+		/// <summary> Zlozi text vynimky a vyhodi vynimku std::out_of_range. </summary>
+		/// <param name = "index"> Chybny index. </param>
+		/// <param name = "baseIndex"> Najnizsi platny index. </param>
+		/// <param name = "size"> Pocet prvkov v kolekcii. </param>
+		/// <param name = "exceptionMessage"> Text vynimky. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena vzdy. </exception> 
+		/// <remarks> Je oddelena od kontroly, aby sa kontrola dala vlozit (inline) a text sa skladal iba pri chybe. </remarks>
+		[[noreturn]] static void throwOutOfRange(const int index, const int baseIndex, const size_t size, const char* exceptionMessage);
+
 	};
 
+	inline constexpr bool DSRoutines::isRangeCheckEnabled()
+	{
+#if DS_RANGE_CHECK == DS_RANGE_CHECK_ALWAYS
+		return true;
+#elif DS_RANGE_CHECK == DS_RANGE_CHECK_DEBUG && !defined(NDEBUG)
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	inline bool DSRoutines::rangeCheck(const int index, const size_t size)
+	{
+		return DSRoutines::rangeCheck(index, 0, size);
+	}
+
+	inline bool DSRoutines::rangeCheck(const int index, const int baseIndex, const size_t size)
+	{
+		return index >= baseIndex && index < baseIndex + static_cast<int>(size);
+	}
+
+	inline void DSRoutines::rangeCheckExcept(const int index, const size_t size, const char* exceptionMessage)
+	{
+		DSRoutines::rangeCheckExcept(index, 0, size, exceptionMessage);
+	}
+
+	inline void DSRoutines::rangeCheckExcept(const int index, const int baseIndex, const size_t size, const char* exceptionMessage)
+	{
+		if (DSRoutines::isRangeCheckEnabled() && !DSRoutines::rangeCheck(index, baseIndex, size))
+		{
+			DSRoutines::throwOutOfRange(index, baseIndex, size, exceptionMessage);
+		}
+	}
+
 	template<typename T>
 	void DSRoutines::swap(T& a, T& b)
 	{
-		T temp = a;
-		a = b;
-		b = temp;
+		T temp = std::move(a);
+		a = std::move(b);
+		b = std::move(temp);
 	}
 
 	template<typename T>
 	inline int DSRoutines::indexInVector(std::vector<T>& vector, const T & item)
 	{
 		int result = 0;
-		for (std::vector<T>::iterator it = vector.begin(); it != vector.end(); it++)
+		for (typename std::vector<T>::iterator it = vector.begin(); it != vector.end(); it++)
 		{
 			if (*it == item)
 			{
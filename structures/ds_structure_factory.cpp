@@ -175,7 +175,10 @@ namespace structures {
 
 	ADSFactory * ADTFactoryManager::getADSFactoryByIndex(const int index) const
 	{
-		DSRoutines::rangeCheckExcept(index, factoriesSize(), "Factory index out of range!");
+		if (!DSRoutines::rangeCheck(index, factoriesSize()))
+		{
+			throw std::out_of_range("Factory index out of range!");
+		}
 
 		return adsFactories_->at(index);
 	}
@@ -25,15 +25,20 @@ namespace structures {
 		adsARRAY,
 
 		adsLIST_ARRAY,
+		adsLIST_SMALL_ARRAY,
 		adsLIST_LINKED,
 		adsLIST_DOUBLE_LINKED,
 		adsLIST_CYCLICAL,
+		adsLIST_UNROLLED,
+		adsLIST_ROPE,
+		adsLIST_TIERED_VECTOR,
 
 		adsQUEUE_ARRAY,
 		adsQUEUE_LIST,
 
 		adsSTACK_ARRAY,
 		adsSTACK_LIST,
+		adsSTACK_SEGMENTED,
 
 		adsPRIORITY_QUEUE_ARRAY_LIST_UNSORTED,
 		adsPRIORITY_QUEUE_ARRAY_LIST_SORTED,
@@ -41,6 +46,9 @@ namespace structures {
 		adsPRIORITY_QUEUE_TWO_LISTS,
 		adsPRIORITY_QUEUE_DOUBLE_LAYER,
 		adsPRIORITY_QUEUE_HEAP,
+		adsPRIORITY_QUEUE_PAIRING_HEAP,
+		adsPRIORITY_QUEUE_RADIX_HEAP,
+		adsPRIORITY_QUEUE_BUCKET_QUEUE,
 
 		adsTREE_MULTI_WAY,
 		adsTREE_K_WAY,
@@ -0,0 +1,271 @@
+#pragma once
+
+#include "concurrency_routines.h"
+
+#include <functional>
+
+namespace structures
+{
+	/// <summary> Uvolnovanie pamate zdielanych uzlov podla epoch (epoch-based reclamation). </summary>
+	/// <typeparam name = "N"> Typ uzla, musi mat atribut N* retiredNext, ktory sa pouzije na zretazenie vyradenych uzlov. </typepram>
+	/// <remarks>
+	/// Vlakno pred pristupom k zdielanym uzlom obsadi slot a zapise do neho globalnu epochu (Guard).
+	/// Odpojeny uzol sa neuvolni hned, ale odlozi sa do zoznamu slotu pre aktualnu epochu. Globalna epocha sa posunie,
+	/// az ked su vsetky obsadene sloty v aktualnej epoche, uzly vyradene pred tromi epochami preto uz ziadne vlakno nevidi.
+	/// Kym je vlakno v slote, adresa ziadneho uzla, ktory mohlo vidiet, sa nepouzije znova, co zabranuje problemu ABA.
+	/// </remarks>
+	template<typename N>
+	class EpochReclamation
+	{
+	public:
+		/// <summary> Obsadenie slotu na dobu jednej operacie nad zdielanymi uzlami. </summary>
+		class Guard
+		{
+		public:
+			/// <summary> Konstruktor. Obsadi slot a zapise don globalnu epochu. </summary>
+			/// <param name = "reclamation"> Sprava epoch, v ktorej sa obsadzuje slot. </param>
+			Guard(EpochReclamation<N>& reclamation);
+
+			/// <summary> Destruktor. Uvolni slot. </summary>
+			~Guard();
+
+			/// <summary> Vyradi uzol, ktory uz nie je dosiahnutelny zo zdielanej struktury. </summary>
+			/// <param name = "node"> Vyradeny uzol, uvolni sa, ked ho uz ziadne vlakno nemoze vidiet. </param>
+			void retire(N* node);
+
+		private:
+			Guard(const Guard&) = delete;
+			Guard& operator=(const Guard&) = delete;
+
+			/// <summary> Sprava epoch. </summary>
+			EpochReclamation<N>& reclamation_;
+			/// <summary> Index obsadeneho slotu. </summary>
+			size_t slot_;
+		};
+
+		/// <summary> Konstruktor. </summary>
+		EpochReclamation();
+
+		/// <summary> Destruktor. Uvolni vsetky vyradene uzly, ziadne vlakno uz nesmie byt v slote. </summary>
+		~EpochReclamation();
+
+		/// <summary> Vrati pocet vyradenych, este neuvolnenych uzlov. </summary>
+		/// <returns> Pocet vyradenych, este neuvolnenych uzlov. </returns>
+		/// <remarks> Platny iba vtedy, ked ziadne vlakno nie je v slote. </remarks>
+		size_t retiredCount() const;
+
+		/// <summary> Vrati pseudonahodne cislo rozne pre rozne vlakna. </summary>
+		/// <returns> Pseudonahodne cislo. </returns>
+		static size_t threadRandom();
+
+	private:
+		/// <summary> Pocet slotov, teda najvacsi pocet vlakien sucasne pristupujucich k uzlom. </summary>
+		static const size_t SLOT_COUNT = 64;
+		/// <summary> Pocet vyradeni v slote, po ktorom sa skusi posunut globalna epocha. </summary>
+		static const unsigned ADVANCE_INTERVAL = 32;
+
+		/// <summary> Slot vlakna. </summary>
+		struct Slot
+		{
+			/// <summary> Epocha vlakna v slote, 0, ak je slot volny. </summary>
+			std::atomic<unsigned long long> epoch;
+			/// <summary> Zoznamy vyradenych uzlov pre tri posledne epochy, pouziva ich iba vlakno v slote. </summary>
+			N* limbo[3];
+			/// <summary> Epochy, v ktorych boli uzly v zoznamoch vyradene. </summary>
+			unsigned long long limboEpoch[3];
+			/// <summary> Pocet vyradeni od posledneho pokusu o posunutie epochy. </summary>
+			unsigned retireCount;
+			/// <summary> Oddeluje sloty roznych vlakien. </summary>
+			char padding[ConcurrencyRoutines::CACHE_LINE_SIZE];
+		};
+
+		/// <summary> Sloty vlakien. </summary>
+		Slot slots_[SLOT_COUNT];
+		/// <summary> Globalna epocha, zacina od 1. </summary>
+		std::atomic<unsigned long long> globalEpoch_;
+		/// <summary> Oddeluje globalnu epochu od nasledujucich objektov v pamati. </summary>
+		char paddingEnd_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+
+	private:
+		/// <summary> Obsadi volny slot a zapise don globalnu epochu. Ak su vsetky sloty obsadene, caka. </summary>
+		/// <returns> Index obsadeneho slotu. </returns>
+		size_t enter();
+
+		/// <summary> Uvolni slot. </summary>
+		/// <param name = "slot"> Index slotu. </param>
+		void leave(const size_t slot);
+
+		/// <summary> Vyradi uzol v slote. </summary>
+		/// <param name = "slot"> Index slotu. </param>
+		/// <param name = "node"> Vyradeny uzol. </param>
+		void retire(const size_t slot, N* node);
+
+		/// <summary> Posunie globalnu epochu, ak su vsetky obsadene sloty v danej epoche. </summary>
+		/// <param name = "epoch"> Epocha, z ktorej sa posuva. </param>
+		void tryAdvance(unsigned long long epoch);
+
+		/// <summary> Uvolni zoznam vyradenych uzlov. </summary>
+		/// <param name = "node"> Prvy uzol zoznamu. </param>
+		static void destroyList(N* node);
+	};
+
+	template<typename N>
+	inline EpochReclamation<N>::Guard::Guard(EpochReclamation<N>& reclamation) :
+		reclamation_(reclamation),
+		slot_(reclamation.enter())
+	{
+	}
+
+	template<typename N>
+	inline EpochReclamation<N>::Guard::~Guard()
+	{
+		reclamation_.leave(slot_);
+	}
+
+	template<typename N>
+	inline void EpochReclamation<N>::Guard::retire(N* node)
+	{
+		reclamation_.retire(slot_, node);
+	}
+
+	template<typename N>
+	inline EpochReclamation<N>::EpochReclamation() :
+		globalEpoch_(1)
+	{
+		for (Slot& slot : slots_)
+		{
+			slot.epoch.store(0, std::memory_order_relaxed);
+			for (int i = 0; i < 3; i++)
+			{
+				slot.limbo[i] = nullptr;
+				slot.limboEpoch[i] = 0;
+			}
+			slot.retireCount = 0;
+		}
+	}
+
+	template<typename N>
+	inline EpochReclamation<N>::~EpochReclamation()
+	{
+		for (Slot& slot : slots_)
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				destroyList(slot.limbo[i]);
+				slot.limbo[i] = nullptr;
+			}
+		}
+	}
+
+	template<typename N>
+	inline size_t EpochReclamation<N>::retiredCount() const
+	{
+		size_t result = 0;
+		for (const Slot& slot : slots_)
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				for (const N* node = slot.limbo[i]; node != nullptr; node = node->retiredNext)
+				{
+					result++;
+				}
+			}
+		}
+		return result;
+	}
+
+	template<typename N>
+	inline size_t EpochReclamation<N>::threadRandom()
+	{
+		static thread_local size_t state = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+		// xorshift
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+
+	template<typename N>
+	inline size_t EpochReclamation<N>::enter()
+	{
+		static thread_local size_t hint = std::hash<std::thread::id>()(std::this_thread::get_id());
+		Backoff backoff;
+		while (true)
+		{
+			for (size_t i = 0; i < SLOT_COUNT; i++)
+			{
+				const size_t index = (hint + i) % SLOT_COUNT;
+				Slot& slot = slots_[index];
+				unsigned long long expected = 0;
+				unsigned long long epoch = globalEpoch_.load(std::memory_order_seq_cst);
+				if (slot.epoch.load(std::memory_order_relaxed) == 0 && slot.epoch.compare_exchange_strong(expected, epoch, std::memory_order_seq_cst))
+				{
+					// Epocha sa mohla posunut medzi jej precitanim a zapisom do slotu, vtedy by slot nebranil posunutiu.
+					unsigned long long current = globalEpoch_.load(std::memory_order_seq_cst);
+					while (current != epoch)
+					{
+						epoch = current;
+						slot.epoch.store(epoch, std::memory_order_seq_cst);
+						current = globalEpoch_.load(std::memory_order_seq_cst);
+					}
+					hint = index;
+					return index;
+				}
+			}
+			backoff.pause();
+		}
+	}
+
+	template<typename N>
+	inline void EpochReclamation<N>::leave(const size_t slot)
+	{
+		slots_[slot].epoch.store(0, std::memory_order_release);
+	}
+
+	template<typename N>
+	inline void EpochReclamation<N>::retire(const size_t slot, N* node)
+	{
+		Slot& owner = slots_[slot];
+		const unsigned long long epoch = owner.epoch.load(std::memory_order_relaxed);
+		const int list = static_cast<int>(epoch % 3);
+		if (owner.limboEpoch[list] != epoch)
+		{
+			// Zoznam patri epoche najviac epoch - 3, vsetky vlakna su uz aspon v epoche - 1, uzly nikto nevidi.
+			destroyList(owner.limbo[list]);
+			owner.limbo[list] = nullptr;
+			owner.limboEpoch[list] = epoch;
+		}
+		node->retiredNext = owner.limbo[list];
+		owner.limbo[list] = node;
+		if (++owner.retireCount >= ADVANCE_INTERVAL)
+		{
+			owner.retireCount = 0;
+			tryAdvance(epoch);
+		}
+	}
+
+	template<typename N>
+	inline void EpochReclamation<N>::tryAdvance(unsigned long long epoch)
+	{
+		for (const Slot& slot : slots_)
+		{
+			const unsigned long long slotEpoch = slot.epoch.load(std::memory_order_seq_cst);
+			if (slotEpoch != 0 && slotEpoch != epoch)
+			{
+				return;
+			}
+		}
+		globalEpoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+	}
+
+	template<typename N>
+	inline void EpochReclamation<N>::destroyList(N* node)
+	{
+		while (node != nullptr)
+		{
+			N* next = node->retiredNext;
+			delete node;
+			node = next;
+		}
+	}
+}
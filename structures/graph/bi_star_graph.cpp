@@ -21,6 +21,14 @@ structures::GraphElement * structures::GraphVertexBiStar::clone(const Graph* gra
 	throw std::exception("GraphVertexBiStar::clone: Not implemented yet.");
 }
 
+structures::MemoryUsage structures::GraphVertexBiStar::memoryUsage() const
+{
+	MemoryUsage result = GraphVertexForwardStar::memoryUsage();
+	result.bytesOwned += sizeof(GraphVertexBiStar) - sizeof(GraphVertexForwardStar);
+	result.addAllocation(backwardEdges_->memoryUsage());
+	return result;
+}
+
 bool structures::GraphVertexBiStar::containsBackwardEdge(GraphVertex * beginVertex)
 {
 	//TODO 11: GraphVertexBiStar
@@ -31,6 +31,11 @@ namespace structures
 		/// <remarks> Nad obojsmernou hviezdou nie je mozne definovat operator priradenia. </remarks>
 		GraphVertexBiStar & operator=(const GraphVertexBiStar & other) = delete;
 
+		/// <summary> Vrati udaje o pamati, ktoru obojsmerna hviezda obsadzuje. </summary>
+		/// <returns> Udaje o pamati obsadenej vrcholom hviezdy a hranami, ktore z neho vychadzaju. </returns>
+		/// <remarks> Hrany vstupujuce do vrchola sa nezapocitavaju, patria hviezde svojho pociatocneho vrchola. </remarks>
+		virtual MemoryUsage memoryUsage() const override;
+
 		/// <summary> Zisti, ci do vrchola hviezdy vstupuje hrana zacinajuca v danom vrchole. </summary>
 		/// <param name = "beginVertex"> Smernik na zaciatocny vrchol hrany. </param>
 		/// <returns> true, ak do vrchola hviezdy vstupuje hrana zacinajuca v danom vrchole, false inak. </returns>
@@ -28,6 +28,19 @@ structures::GraphVertex & structures::GraphVertexForwardStar::operator=(const Gr
 	throw std::logic_error("Assignment operator is not defined for forward star.");
 }
 
+structures::MemoryUsage structures::GraphVertexForwardStar::memoryUsage() const
+{
+	MemoryUsage result;
+	result.addAllocations(sizeof(GraphVertexForwardStar));
+	result += memoryUsageOfData();
+	result.addAllocation(forwardEdges_->memoryUsage());
+	for (TableItem<GraphVertex*, GraphEdge*>* item : *forwardEdges_)
+	{
+		result += item->accessData()->memoryUsage();
+	}
+	return result;
+}
+
 bool structures::GraphVertexForwardStar::containsForwardEdge(GraphVertex * endVertex)
 {
 	//TODO 11: GraphVertexForwardStar
@@ -121,6 +134,18 @@ size_t structures::ForwardStarGraph::size() const
 	throw std::exception("ForwardStarGraph::size: Not implemented yet.");
 }
 
+structures::MemoryUsage structures::ForwardStarGraph::memoryUsage() const
+{
+	MemoryUsage result = GraphWithRegistration::memoryUsage();
+	result.bytesOwned += sizeof(ForwardStarGraph) - sizeof(GraphWithRegistration);
+	result.addAllocation(vertices_->memoryUsage());
+	for (TableItem<int, GraphVertexForwardStar*>* item : *vertices_)
+	{
+		result += item->accessData()->memoryUsage();
+	}
+	return result;
+}
+
 void structures::ForwardStarGraph::clear()
 {
 	//TODO 11: ForwardStarGraph
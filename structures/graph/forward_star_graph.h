@@ -36,6 +36,10 @@ namespace structures
 		/// <remarks> Nad doprednou hviezdou nie je mozne definovat operator priradenia. </remarks>
 		GraphVertexForwardStar & operator=(const GraphVertexForwardStar & other) = delete;
 
+		/// <summary> Vrati udaje o pamati, ktoru dopredna hviezda obsadzuje. </summary>
+		/// <returns> Udaje o pamati obsadenej vrcholom hviezdy a hranami, ktore z neho vychadzaju. </returns>
+		virtual MemoryUsage memoryUsage() const override;
+
 		/// <summary> Zisti, ci z vrchola hviezdy vychadza hrana konciaca v danom vrchole. </summary>
 		/// <param name = "endVertex"> Smernik na koncovy vrchol hrany. </param>
 		/// <returns> true, ak z vrchola hviezdy vychadza hrana konciaca v danom vrchole, false inak. </returns>
@@ -139,6 +143,10 @@ namespace structures
 		/// <returns> Pocet vrcholov v grafe. </returns>
 		virtual size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru graf obsadzuje. </summary>
+		/// <returns> Udaje o pamati obsadenej grafom, vratane vsetkych hviezd a hran. </returns>
+		virtual MemoryUsage memoryUsage() const override;
+
 		/// <summary> Vymaze obsah grafu, t.j. vrcholy a hrany. Neodstrani zaregistrovane typy dat. </summary>
 		virtual void clear() override;
 
@@ -146,6 +146,13 @@ void structures::GraphElement::setGraph(const Graph * graph)
 	throw std::exception("GraphElement::setGraph: Not implemented yet.");
 }
 
+structures::MemoryUsage structures::GraphElement::memoryUsageOfData() const
+{
+	MemoryUsage result;
+	result.addAllocation(dataTable_->memoryUsage());
+	return result;
+}
+
 #pragma endregion
 
 
@@ -185,6 +192,14 @@ int structures::GraphVertex::getId() const
 	return id_;
 }
 
+structures::MemoryUsage structures::GraphVertex::memoryUsage() const
+{
+	MemoryUsage result;
+	result.addAllocations(sizeof(GraphVertex));
+	result += memoryUsageOfData();
+	return result;
+}
+
 #pragma endregion
 
 
@@ -245,6 +260,14 @@ const structures::GraphVertex * structures::GraphEdge::getEndVertex() const
 	return endVertex_;
 }
 
+structures::MemoryUsage structures::GraphEdge::memoryUsage() const
+{
+	MemoryUsage result;
+	result.addAllocations(sizeof(GraphEdge));
+	result += memoryUsageOfData();
+	return result;
+}
+
 structures::Structure & structures::Graph::operator=(const Structure & other)
 {
 	return *this = dynamic_cast<const Graph&>(other);
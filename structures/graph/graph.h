@@ -155,11 +155,20 @@ namespace structures
 		/// <returns> Smernik na graf, v ktorom sa nachadza tento element grafu. </returns>
 		const Graph* getGraph() const;
 
+		/// <summary> Vrati udaje o pamati, ktoru element grafu obsadzuje. </summary>
+		/// <returns> Udaje o pamati obsadenej elementom grafu, vratane alokacie samotneho elementu. </returns>
+		virtual MemoryUsage memoryUsage() const = 0;
+
 	protected:
 		/// <summary> Setter nastavujuci smernik na graf, v ktorom sa nachadza tento element grafu. </summary>
 		/// <remarks> V ramci metody sa odstrania z tohto elementu grafu vsetky data, ktore nie su registrovane v grafe, na ktory ukazuje prameter graph. </remarks>
 		void setGraph(const Graph* graph);
 
+		/// <summary> Vrati udaje o pamati, ktoru obsadzuje tabulka s datami elementu grafu. </summary>
+		/// <returns> Udaje o pamati, ktoru obsadzuje tabulka s datami elementu grafu. </returns>
+		/// <remarks> Samotne instancie dat sa nezapocitavaju, v tabulke su ulozene iba smerniky na ne. </remarks>
+		MemoryUsage memoryUsageOfData() const;
+
 	private:
 		/// <summary> Smernik na graf, v ktorom sa nachadza tento element grafu. </summary>
 		const Graph* graph_;
@@ -209,6 +218,10 @@ namespace structures
 		/// <returns> Id daneho vrcholu. </returns>
 		int getId() const;
 
+		/// <summary> Vrati udaje o pamati, ktoru vrchol grafu obsadzuje. </summary>
+		/// <returns> Udaje o pamati obsadenej vrcholom grafu, vratane alokacie samotneho vrcholu. </returns>
+		virtual MemoryUsage memoryUsage() const override;
+
 	private:
 		/// <summary> Id daneho vrcholu. </summary>
 		int id_;
@@ -265,6 +278,10 @@ namespace structures
 		/// <returns> Smernik na koncovy vrchol hrany. </returns>
 		const GraphVertex* getEndVertex() const;
 
+		/// <summary> Vrati udaje o pamati, ktoru hrana grafu obsadzuje. </summary>
+		/// <returns> Udaje o pamati obsadenej hranou grafu, vratane alokacie samotnej hrany. </returns>
+		virtual MemoryUsage memoryUsage() const override;
+
 	protected:
 		/// <summary> Smernik na pociatocny vrchol. </summary>
 		GraphVertex* beginVertex_;
@@ -27,6 +27,14 @@ structures::GraphWithRegistration & structures::GraphWithRegistration::operator=
 	return *this;
 }
 
+structures::MemoryUsage structures::GraphWithRegistration::memoryUsage() const
+{
+	MemoryUsage result(sizeof(GraphWithRegistration));
+	result.addAllocation(registeredVertexData_->memoryUsage());
+	result.addAllocation(registeredEdgeData_->memoryUsage());
+	return result;
+}
+
 structures::GraphWithRegistration::GraphWithRegistration(Table<const GraphData*, const GraphData*>* tableForVertexDataRegistration, Table<const GraphData*, const GraphData*>* tableForEdgeDataRegistration) :
 	registeredVertexData_(tableForVertexDataRegistration),
 	registeredEdgeData_(tableForEdgeDataRegistration)
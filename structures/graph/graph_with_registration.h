@@ -23,6 +23,11 @@ namespace structures
 		/// <returns> Adresa, na ktorej sa tento graf nachadza po priradeni. </returns>
 		virtual GraphWithRegistration & operator=(const GraphWithRegistration & other);
 
+		/// <summary> Vrati udaje o pamati, ktoru graf obsadzuje. </summary>
+		/// <returns> Udaje o pamati obsadenej grafom, zapocitava iba tabulky registrovanych dat. </returns>
+		/// <remarks> Potomkovia k nej pripocitaju pamat svojich vrcholov a hran. </remarks>
+		virtual MemoryUsage memoryUsage() const override;
+
 		/// <summary> Zisti, ci v grafe su registrovane data daneho typu s danym klucom. </summary>
 		/// <param name = "dataType"> Typ dat - data vrcholu alebo data hrany. </param>
 		/// <param name = "key"> Jedinecny identifikator dat. Jedna sa u adresu triedy, z ktorej vznikla instancia dat. </param>
@@ -1,9 +1,18 @@
 #pragma once
 
+#ifdef _MSC_VER
+
 #define _CRTDBG_MAP_ALLOC  
 #include <stdlib.h>  
 #include <crtdbg.h>
 
 #define new new ( _NORMAL_BLOCK , __FILE__ , __LINE__ )
 
-#define initHeapMonitor() _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF)
\ No newline at end of file
+#define initHeapMonitor() _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF)
+
+#else
+
+// Ladiaca halda je iba v MSVC, inde sa monitor vypne.
+#define initHeapMonitor()
+
+#endif
@@ -3,6 +3,9 @@
 #include "list.h"
 #include "../structure_iterator.h"
 #include "../array/array.h"
+#include "../search_routines.h"
+#include <algorithm>
+#include <memory>
 
 namespace structures
 {
@@ -10,7 +13,7 @@ namespace structures
 	/// <summary> Zoznam implementovany polom. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v zozname. </typepram>
 	template<typename T>
-	class ArrayList : public List<T>
+	class ArrayList final : public List<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -20,6 +23,8 @@ namespace structures
 		/// <param name = "other"> ArrayList, z ktoreho sa prevezmu vlastnosti. </param>
 		ArrayList(const ArrayList<T>& other);
 
+		/// <summary> Presuvaci konstruktor. </summary>
+		/// <param name = "other"> ArrayList, z ktoreho sa prevezme obsah. </param>
 		ArrayList(ArrayList<T>&& other);
 
 		/// <summary> Destruktor. </summary>
@@ -33,6 +38,10 @@ namespace structures
 		/// <returns> Pocet prvkov v zozname. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru zoznam obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zoznam obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
@@ -43,6 +52,9 @@ namespace structures
 		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
 		ArrayList<T>& operator=(const ArrayList<T>& other);
 
+		/// <summary> Presuvaci operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho sa prevezme obsah. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
 		ArrayList<T>& operator=(ArrayList<T>&& other);
 
 		/// <summary> Vrati adresou prvok na indexe. </summary>
@@ -61,6 +73,16 @@ namespace structures
 		/// <param name = "data"> Pridavany prvok. </param>
 		void add(const T& data) override;
 
+		/// <summary> Prida prvok do zoznamu. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(T&& data) override;
+
+		/// <summary> Vytvori prvok z argumentov priamo vo volnom mieste pola a prida ho na koniec zoznamu. </summary>
+		/// <param name = "args"> Argumenty konstruktora pridavaneho prvku. </param>
+		/// <remarks> Prvok sa vytvara cez std::allocator_traits, nie cez new, ktore v MSVC predefinuje heap_monitor.h. </remarks>
+		template<typename... Args>
+		void emplace(Args&&... args);
+
 		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
 		/// <param name = "data"> Pridavany prvok. </param>
 		/// <param name = "index"> Index prvku. </param>
@@ -68,6 +90,21 @@ namespace structures
 		/// <remarks> Ak je ako index zadana hodnota poctu prvkov (teda prvy neplatny index), metoda insert sa sprava ako metoda add. </remarks>
 		void insert(const T& data, const int index) override;
 
+		/// <summary> Vlozi prvok do zoznamu na dany index. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
+		void insert(T&& data, const int index) override;
+
+		/// <summary> Vlozi do zoznamu prvky z rozsahu [first, last) tak, ze prvy z nich bude na danom indexe. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku. </param>
+		/// <param name = "first"> Iterator na prvy vkladany prvok. </param>
+		/// <param name = "last"> Iterator za posledny vkladany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [0, size]. </exception>
+		/// <remarks> Prvky prida na koniec a jednym otocenim ich presunie na miesto, zvysok zoznamu sa posuva iba raz. </remarks>
+		template<typename InputIterator>
+		void insertRange(const int index, InputIterator first, InputIterator last);
+
 		/// <summary> Odstrani prvy vyskyt prvku zo zoznamu. </summary>
 		/// <param name = "data"> Odstranovany prvok. </param>
 		/// <returns> true, ak sa podarilo prvok zo zoznamu odobrat, false inak. </returns>
@@ -79,11 +116,31 @@ namespace structures
 		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
 		T removeAt(const int index) override;
 
+		/// <summary> Odstrani zo zoznamu prvky na indexoch z intervalu [from, to). </summary>
+		/// <param name = "from"> Index prveho odstranovaneho prvku. </param>
+		/// <param name = "to"> Index za poslednym odstranovanym prvkom. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak neplati 0 <= from <= to <= size. </exception>
+		/// <remarks> Zvysok zoznamu posunie iba raz. </remarks>
+		void removeRange(const int from, const int to) override;
+
+		/// <summary> Odstrani zo zoznamu vsetky prvky, pre ktore predikat vrati true. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		/// <remarks> Jednym prechodom zoznam zhusti, kazdy ponechany prvok sa presunie najviac raz. </remarks>
+		template<typename Predicate>
+		size_t removeIf(Predicate predicate);
+
 		/// <summary> Vrati index prveho vyskytu prvku v zozname. </summary>
 		/// <param name = "data"> Prvok, ktoreho index sa hlada. </param>
 		/// <returns> Index prveho vyskytu prvku v zozname, ak sa prvok v zozname nenachadza, vrati -1. </returns>
 		int getIndexOf(const T& data) override;
 
+		/// <summary> Vrati pocet vyskytov prvku v zozname. </summary>
+		/// <param name = "data"> Hladany prvok. </param>
+		/// <returns> Pocet vyskytov prvku v zozname. </returns>
+		/// <remarks> Pre aritmeticke typy porovnava vektorovo, pozri SearchRoutines. </remarks>
+		size_t count(const T& data) override;
+
 		/// <summary> Vymaze zoznam. </summary>
 		void clear() override;
 
@@ -96,6 +153,26 @@ namespace structures
 		/// <returns> Iterator na koniec struktury. </returns>
 		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
 		Iterator<T>* getEndIterator() const override;
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function);
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane konstantnu adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function) const;
+	protected:
+		/// <summary> Vlozi do zoznamu prvky pola naraz, pouzije insertRange. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku, uz overeny. </param>
+		/// <param name = "items"> Vkladane prvky. </param>
+		void insertRangeImpl(const int index, const Array<T>& items) override;
+
+		/// <summary> Odstrani prvky jednym prechodom, pouzije removeIf. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		size_t removeIfImpl(const std::function<bool(const T&)>& predicate) override;
 	private:
 		/// <summary> Pole s datami. </summary>
 		Array<T>* array_;
@@ -161,11 +238,10 @@ namespace structures
 
 	template<typename T>
 	inline ArrayList<T>::ArrayList(ArrayList<T>&& other) :
-		array_(other.array_),
-		size_(other.size_)
+		List<T>(),
+		array_(std::exchange(other.array_, nullptr)),
+		size_(std::exchange(other.size_, 0))
 	{
-		other.array_ = nullptr;
-		other.size_ = nullptr;
 	}
 
 	template<typename T>
@@ -188,6 +264,18 @@ namespace structures
 		return size_;
 	}
 
+	template<typename T>
+	inline MemoryUsage ArrayList<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(ArrayList<T>));
+		if (this->array_ != nullptr)
+		{
+			result.addAllocation(this->array_->memoryUsage());
+			result.bytesWasted += (this->array_->size() - this->size_) * sizeof(T);
+		}
+		return result;
+	}
+
 	template<typename T>
 	inline List<T>& ArrayList<T>::operator=(const List<T>& other)
 	{
@@ -226,6 +314,7 @@ namespace structures
 			array_ = std::exchange(other.array_, nullptr);
 			size_ = std::exchange(other.size_, 0);
 		}
+		return *this;
 	}
 
 	template<typename T>
@@ -253,6 +342,30 @@ namespace structures
 		this->size_++;
 	}
 
+	template<typename T>
+	inline void ArrayList<T>::add(T&& data)
+	{
+		if (this->array_->size() <= this->size_)
+		{
+			this->enlarge();
+		}
+		(*this->array_)[static_cast<int>(this->size_)] = std::move(data);
+		this->size_++;
+	}
+
+	template<typename T>
+	template<typename... Args>
+	inline void ArrayList<T>::emplace(Args&&... args)
+	{
+		if (this->array_->size() <= this->size_)
+		{
+			this->enlarge();
+		}
+		std::allocator<T> allocator;
+		std::allocator_traits<std::allocator<T>>::construct(allocator, this->array_->data() + this->size_, std::forward<Args>(args)...);
+		this->size_++;
+	}
+
 	template<typename T>
 	inline void ArrayList<T>::insert(const T& data, const int index)
 	{
@@ -273,6 +386,26 @@ namespace structures
 		}
 	}
 
+	template<typename T>
+	inline void ArrayList<T>::insert(T&& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_ + 1, "ArrayList<T>::insert: Invalid index.");
+		if (this->array_->size() <= this->size_)
+		{
+			this->enlarge();
+		}
+		if (index == this->size_)
+		{
+			this->add(std::move(data));
+		}
+		else
+		{
+			Array<T>::copy(*this->array_, index, *this->array_, index + 1, static_cast<int>(this->size_) - index);
+			(*this)[index] = std::move(data);
+			this->size_++;
+		}
+	}
+
 	template<typename T>
 	inline bool ArrayList<T>::tryRemove(const T& data)
 	{
@@ -292,23 +425,85 @@ namespace structures
 	inline T ArrayList<T>::removeAt(const int index)
 	{
 		DSRoutines::rangeCheckExcept(index, this->size_, "ArrayList<T>::removeAt: Invalid index.");
-		T tmp = (*this->array_)[index];
+		T tmp = std::move((*this->array_)[index]);
 		Array<T>::copy(*this->array_, index + 1, *this->array_, index, static_cast<int>(this->size_) - index - 1);
 		this->size_--;
 		return tmp;
 	}
 
 	template<typename T>
-	inline int ArrayList<T>::getIndexOf(const T& data)
+	template<typename InputIterator>
+	inline void ArrayList<T>::insertRange(const int index, InputIterator first, InputIterator last)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_ + 1, "ArrayList<T>::insertRange: Invalid index.");
+		const int oldSize = static_cast<int>(this->size_);
+		for (; first != last; ++first)
+		{
+			this->add(*first);
+		}
+		T* items = this->array_->data();
+		if (items != nullptr)
+		{
+			std::rotate(items + index, items + oldSize, items + this->size_);
+		}
+	}
+
+	template<typename T>
+	inline void ArrayList<T>::removeRange(const int from, const int to)
 	{
-		for (int i = 0; i < static_cast<int>(this->size_); i++)
+		DSRoutines::rangeCheckExcept(to, this->size_ + 1, "ArrayList<T>::removeRange: Invalid index.");
+		DSRoutines::rangeCheckExcept(from, to + 1, "ArrayList<T>::removeRange: Invalid index.");
+		if (from < to)
 		{
-			if ((*this->array_)[i] == data)
+			Array<T>::copy(*this->array_, to, *this->array_, from, static_cast<int>(this->size_) - to);
+			this->size_ -= to - from;
+		}
+	}
+
+	template<typename T>
+	template<typename Predicate>
+	inline size_t ArrayList<T>::removeIf(Predicate predicate)
+	{
+		T* items = this->array_->data();
+		size_t kept = 0;
+		for (size_t i = 0; i < this->size_; i++)
+		{
+			if (!predicate(static_cast<const T&>(items[i])))
 			{
-				return i;
+				if (kept != i)
+				{
+					items[kept] = std::move(items[i]);
+				}
+				kept++;
 			}
 		}
-		return -1;
+		size_t removed = this->size_ - kept;
+		this->size_ = kept;
+		return removed;
+	}
+
+	template<typename T>
+	inline void ArrayList<T>::insertRangeImpl(const int index, const Array<T>& items)
+	{
+		this->insertRange(index, items.data(), items.data() + items.size());
+	}
+
+	template<typename T>
+	inline size_t ArrayList<T>::removeIfImpl(const std::function<bool(const T&)>& predicate)
+	{
+		return this->removeIf(predicate);
+	}
+
+	template<typename T>
+	inline int ArrayList<T>::getIndexOf(const T& data)
+	{
+		return SearchRoutines::indexOf(this->array_->data(), static_cast<int>(this->size_), data);
+	}
+
+	template<typename T>
+	inline size_t ArrayList<T>::count(const T& data)
+	{
+		return static_cast<size_t>(SearchRoutines::count(this->array_->data(), static_cast<int>(this->size_), data));
 	}
 
 	template<typename T>
@@ -329,6 +524,30 @@ namespace structures
 		return new ArrayListIterator(this, static_cast<int>(this->size_));
 	}
 
+	template<typename T>
+	template<typename Function>
+	inline void ArrayList<T>::forEach(Function function)
+	{
+		T* item = this->array_->data();
+		T* end = item + this->size_;
+		for (; item != end; ++item)
+		{
+			function(*item);
+		}
+	}
+
+	template<typename T>
+	template<typename Function>
+	inline void ArrayList<T>::forEach(Function function) const
+	{
+		const T* item = this->array_->data();
+		const T* end = item + this->size_;
+		for (; item != end; ++item)
+		{
+			function(*item);
+		}
+	}
+
 	template<typename T>
 	inline void ArrayList<T>::enlarge()
 	{
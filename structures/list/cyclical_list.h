@@ -0,0 +1,632 @@
+#pragma once
+
+#include "list.h"
+#include "doubly_linked_list.h"
+#include "../structure_iterator.h"
+#include "../ds_routines.h"
+#include <stdexcept>
+
+namespace structures
+{
+
+	/// <summary> Cyklicky obojstranne zretazeny zoznam. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v zozname. </typepram>
+	/// <remarks>
+	/// Posledny prvok ukazuje na prvy a prvy na posledny, zoznam si pamata iba prvy prvok.
+	/// Rotacia, spajanie a delenie zoznamov iba prepajaju prvky, data sa nekopiruju.
+	/// </remarks>
+	template<typename T>
+	class CyclicalList final : public List<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		CyclicalList();
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> CyclicalList, z ktoreho sa prevezmu vlastnosti. </param>
+		CyclicalList(const CyclicalList<T>& other);
+
+		/// <summary> Presuvaci konstruktor. </summary>
+		/// <param name = "other"> CyclicalList, z ktoreho sa prevezme obsah. </param>
+		CyclicalList(CyclicalList<T>&& other);
+
+		/// <summary> Destruktor. </summary>
+		~CyclicalList();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat zoznamu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov v zozname. </summary>
+		/// <returns> Pocet prvkov v zozname. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru zoznam obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zoznam obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		List<T>& operator=(const List<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		CyclicalList<T>& operator=(const CyclicalList<T>& other);
+
+		/// <summary> Presuvaci operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho sa prevezme obsah. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		CyclicalList<T>& operator=(CyclicalList<T>&& other);
+
+		/// <summary> Vrati adresou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Adresa prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T& operator[](const int index) override;
+
+		/// <summary> Vrati hodnotou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Hodnota prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		const T operator[](const int index) const override;
+
+		/// <summary> Prida prvok do zoznamu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(const T& data) override;
+
+		/// <summary> Prida prvok do zoznamu. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(T&& data) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		/// <remarks> Ak je ako index zadana hodnota poctu prvkov (teda prvy neplatny index), metoda insert sa sprava ako metoda add. </remarks>
+		void insert(const T& data, const int index) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		void insert(T&& data, const int index) override;
+
+		/// <summary> Odstrani prvy vyskyt prvku zo zoznamu. </summary>
+		/// <param name = "data"> Odstranovany prvok. </param>
+		/// <returns> true, ak sa podarilo prvok zo zoznamu odobrat, false inak. </returns>
+		bool tryRemove(const T& data) override;
+
+		/// <summary> Odstrani zo zoznamu prvok na danom indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Odstraneny prvok. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T removeAt(const int index) override;
+
+		/// <summary> Vrati index prveho vyskytu prvku v zozname. </summary>
+		/// <param name = "data"> Prvok, ktoreho index sa hlada. </param>
+		/// <returns> Index prveho vyskytu prvku v zozname, ak sa prvok v zozname nenachadza, vrati -1. </returns>
+		int getIndexOf(const T& data) override;
+
+		/// <summary> Vymaze zoznam. </summary>
+		void clear() override;
+
+		/// <summary> Otoci zoznam o k pozicii, prvok na indexe k sa stane prvym prvkom. </summary>
+		/// <param name = "k"> Pocet pozicii, zaporna hodnota otaca opacnym smerom. </param>
+		/// <remarks> Iba posunie zaciatok zoznamu, prejde najviac min(k, size - k) prvkov. </remarks>
+		void rotate(int k);
+
+		/// <summary> Presunie vsetky prvky zoznamu other do tohto zoznamu pred dany index. Zoznam other zostane prazdny. </summary>
+		/// <param name = "other"> Zoznam, ktoreho prvky sa presunu. </param>
+		/// <param name = "index"> Index, na ktorom bude prvy presunuty prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [0, size]. </exception>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je other tento zoznam. </exception>
+		/// <remarks> Prvky sa iba prepoja. Pre index 0 a size je operacia O(1), inak sa hlada prvok na indexe. </remarks>
+		void splice(CyclicalList<T>& other, const int index);
+
+		/// <summary> Odpoji od zoznamu prvky od daneho indexu az po koniec a vrati ich ako novy zoznam. </summary>
+		/// <param name = "index"> Index prveho odpojeneho prvku. </param>
+		/// <returns> Zoznam odpojenych prvkov. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [0, size]. </exception>
+		/// <remarks> Prvky sa iba prepoja, hlada sa iba prvok na indexe. </remarks>
+		CyclicalList<T> split(const int index);
+
+		/// <summary> Vrati skutocny iterator na zaciatok struktury </summary>
+		/// <returns> Iterator na zaciatok struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getBeginIterator() const override;
+
+		/// <summary> Vrati skutocny iterator na koniec struktury </summary>
+		/// <returns> Iterator na koniec struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getEndIterator() const override;
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function);
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane konstantnu adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function) const;
+	private:
+		/// <summary> Pocet prvkov v zozname. </summary>
+		size_t size_;
+		/// <summary> Prvy prvok zoznamu, jeho predchodca je posledny prvok. </summary>
+		DoublyLinkedListItem<T>* first_;
+	private:
+		/// <summary> Vrati prvok zoznamu na danom indexe. </summary>
+		/// <param name = "index"> Pozadovany index, musi patrit do zoznamu. </param>
+		/// <returns> Prvok zoznamu na danom indexe. </returns>
+		/// <remarks> Prechadza od blizsieho konca zoznamu. </remarks>
+		DoublyLinkedListItem<T>* getItemAtIndex(int index) const;
+
+		/// <summary> Zaradi prvok do zoznamu pred dany prvok. </summary>
+		/// <param name = "item"> Zaradovany prvok. </param>
+		/// <param name = "successor"> Prvok, pred ktory sa zaradi, alebo nullptr, ak je zoznam prazdny. </param>
+		void linkBefore(DoublyLinkedListItem<T>* item, DoublyLinkedListItem<T>* successor);
+
+		/// <summary> Zaradi prvok do zoznamu na dany index. </summary>
+		/// <param name = "item"> Zaradovany prvok. </param>
+		/// <param name = "index"> Index prvku, musi patrit do intervalu [0, size]. </param>
+		void linkAt(DoublyLinkedListItem<T>* item, const int index);
+
+		/// <summary> Prepoji dva prvky, prvy bude predchodcom druheho. </summary>
+		/// <param name = "previous"> Predchadzajuci prvok. </param>
+		/// <param name = "next"> Nasledujuci prvok. </param>
+		static void connect(DoublyLinkedListItem<T>* previous, DoublyLinkedListItem<T>* next);
+	private:
+		/// <summary> Iterator pre CyclicalList. </summary>
+		class CyclicalListIterator : public Iterator<T>
+		{
+		public:
+			/// <summary> Konstruktor. </summary>
+			/// <param name = "position"> Pozicia v zozname, na ktorej zacina. </param>
+			/// <param name = "remaining"> Pocet prvkov, ktore iterator este prejde. </param>
+			CyclicalListIterator(DoublyLinkedListItem<T>* position, size_t remaining);
+
+			/// <summary> Destruktor. </summary>
+			~CyclicalListIterator();
+
+			/// <summary> Operator priradenia. Priradi do seba hodnotu druheho iteratora. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> Vrati seba po priradeni. </returns>
+			Iterator<T>& operator= (const Iterator<T>& other) override;
+
+			/// <summary> Porovna sa s druhym iteratorom na nerovnost. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> True, ak sa iteratory nerovnaju, false inak. </returns>
+			bool operator!=(const Iterator<T>& other) override;
+
+			/// <summary> Vrati data, na ktore aktualne ukazuje iterator. </summary>
+			/// <returns> Data, na ktore aktualne ukazuje iterator. </returns>
+			const T operator*() override;
+
+			/// <summary> Posunie iterator na dalsi prvok v strukture. </summary>
+			/// <returns> Iterator na dalsi prvok v strukture. </returns>
+			/// <remarks> Zvycajne vrati seba. Ak vrati iny iterator, povodny bude automaticky zruseny. </remarks>
+			Iterator<T>& operator++() override;
+		private:
+			/// <summary> Aktualna pozicia v zozname, po prejdeni vsetkych prvkov nullptr. </summary>
+			DoublyLinkedListItem<T>* position_;
+			/// <summary> Pocet prvkov, ktore iterator este prejde. </summary>
+			size_t remaining_;
+		};
+	};
+
+	template<typename T>
+	inline CyclicalList<T>::CyclicalList() :
+		List<T>(),
+		size_(0),
+		first_(nullptr)
+	{
+	}
+
+	template<typename T>
+	inline CyclicalList<T>::CyclicalList(const CyclicalList<T>& other) :
+		CyclicalList()
+	{
+		*this = other;
+	}
+
+	template<typename T>
+	inline CyclicalList<T>::CyclicalList(CyclicalList<T>&& other) :
+		List<T>(),
+		size_(std::exchange(other.size_, 0)),
+		first_(std::exchange(other.first_, nullptr))
+	{
+	}
+
+	template<typename T>
+	inline CyclicalList<T>::~CyclicalList()
+	{
+		this->clear();
+	}
+
+	template<typename T>
+	inline Structure* CyclicalList<T>::clone() const
+	{
+		return new CyclicalList<T>(*this);
+	}
+
+	template<typename T>
+	inline size_t CyclicalList<T>::size() const
+	{
+		return size_;
+	}
+
+	template<typename T>
+	inline MemoryUsage CyclicalList<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(CyclicalList<T>));
+		result.addAllocations(sizeof(DoublyLinkedListItem<T>), size_);
+		return result;
+	}
+
+	template<typename T>
+	inline List<T>& CyclicalList<T>::operator=(const List<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const CyclicalList<T>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline CyclicalList<T>& CyclicalList<T>::operator=(const CyclicalList<T>& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+			other.forEach([this](const T& data) { this->add(data); });
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline CyclicalList<T>& CyclicalList<T>::operator=(CyclicalList<T>&& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+			size_ = std::exchange(other.size_, 0);
+			first_ = std::exchange(other.first_, nullptr);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline T& CyclicalList<T>::operator[](const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_, "CyclicalList<T>::operator[]: Invalid index.");
+		return this->getItemAtIndex(index)->accessData();
+	}
+
+	template<typename T>
+	inline const T CyclicalList<T>::operator[](const int index) const
+	{
+		DSRoutines::rangeCheckExcept(index, size_, "CyclicalList<T>::operator[]: Invalid index.");
+		return this->getItemAtIndex(index)->accessData();
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::add(const T& data)
+	{
+		this->linkBefore(new DoublyLinkedListItem<T>(data), first_);
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::add(T&& data)
+	{
+		this->linkBefore(new DoublyLinkedListItem<T>(std::move(data)), first_);
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::insert(const T& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "CyclicalList<T>::insert: Invalid index.");
+		this->linkAt(new DoublyLinkedListItem<T>(data), index);
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::insert(T&& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "CyclicalList<T>::insert: Invalid index.");
+		this->linkAt(new DoublyLinkedListItem<T>(std::move(data)), index);
+	}
+
+	template<typename T>
+	inline bool CyclicalList<T>::tryRemove(const T& data)
+	{
+		int index = this->getIndexOf(data);
+		if (index >= 0)
+		{
+			this->removeAt(index);
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template<typename T>
+	inline T CyclicalList<T>::removeAt(const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_, "CyclicalList<T>::removeAt: Invalid index.");
+		DoublyLinkedListItem<T>* item = this->getItemAtIndex(index);
+		if (size_ == 1)
+		{
+			first_ = nullptr;
+		}
+		else
+		{
+			connect(item->getPrevious(), item->getNext());
+			if (item == first_)
+			{
+				first_ = item->getNext();
+			}
+		}
+		size_--;
+		T data = std::move(item->accessData());
+		delete item;
+		return data;
+	}
+
+	template<typename T>
+	inline int CyclicalList<T>::getIndexOf(const T& data)
+	{
+		DoublyLinkedListItem<T>* item = first_;
+		for (int index = 0; index < static_cast<int>(size_); index++)
+		{
+			if (item->accessData() == data)
+			{
+				return index;
+			}
+			item = item->getNext();
+		}
+		return -1;
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::clear()
+	{
+		DoublyLinkedListItem<T>* item = first_;
+		for (size_t i = 0; i < size_; i++)
+		{
+			DoublyLinkedListItem<T>* next = item->getNext();
+			delete item;
+			item = next;
+		}
+		first_ = nullptr;
+		size_ = 0;
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::rotate(int k)
+	{
+		if (size_ < 2)
+		{
+			return;
+		}
+		const int count = static_cast<int>(size_);
+		k %= count;
+		if (k < 0)
+		{
+			k += count;
+		}
+		if (k <= count / 2)
+		{
+			for (int i = 0; i < k; i++)
+			{
+				first_ = first_->getNext();
+			}
+		}
+		else
+		{
+			for (int i = k; i < count; i++)
+			{
+				first_ = first_->getPrevious();
+			}
+		}
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::splice(CyclicalList<T>& other, const int index)
+	{
+		if (this == &other)
+		{
+			throw std::logic_error("CyclicalList<T>::splice: Cannot splice list into itself.");
+		}
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "CyclicalList<T>::splice: Invalid index.");
+		if (other.size_ == 0)
+		{
+			return;
+		}
+		DoublyLinkedListItem<T>* otherFirst = std::exchange(other.first_, nullptr);
+		DoublyLinkedListItem<T>* otherLast = otherFirst->getPrevious();
+		if (size_ == 0)
+		{
+			first_ = otherFirst;
+		}
+		else
+		{
+			DoublyLinkedListItem<T>* successor = index == static_cast<int>(size_) ? first_ : this->getItemAtIndex(index);
+			connect(successor->getPrevious(), otherFirst);
+			connect(otherLast, successor);
+			if (index == 0)
+			{
+				first_ = otherFirst;
+			}
+		}
+		size_ += std::exchange(other.size_, 0);
+	}
+
+	template<typename T>
+	inline CyclicalList<T> CyclicalList<T>::split(const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "CyclicalList<T>::split: Invalid index.");
+		CyclicalList<T> result;
+		if (index == 0)
+		{
+			result = std::move(*this);
+		}
+		else if (index < static_cast<int>(size_))
+		{
+			DoublyLinkedListItem<T>* newFirst = this->getItemAtIndex(index);
+			DoublyLinkedListItem<T>* newLast = first_->getPrevious();
+			connect(newFirst->getPrevious(), first_);
+			connect(newLast, newFirst);
+			result.first_ = newFirst;
+			result.size_ = size_ - index;
+			size_ = index;
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline Iterator<T>* CyclicalList<T>::getBeginIterator() const
+	{
+		return new CyclicalListIterator(first_, size_);
+	}
+
+	template<typename T>
+	inline Iterator<T>* CyclicalList<T>::getEndIterator() const
+	{
+		return new CyclicalListIterator(nullptr, 0);
+	}
+
+	template<typename T>
+	template<typename Function>
+	inline void CyclicalList<T>::forEach(Function function)
+	{
+		DoublyLinkedListItem<T>* item = first_;
+		for (size_t i = 0; i < size_; i++)
+		{
+			function(item->accessData());
+			item = item->getNext();
+		}
+	}
+
+	template<typename T>
+	template<typename Function>
+	inline void CyclicalList<T>::forEach(Function function) const
+	{
+		const DoublyLinkedListItem<T>* item = first_;
+		for (size_t i = 0; i < size_; i++)
+		{
+			function(item->accessData());
+			item = item->getNext();
+		}
+	}
+
+	template<typename T>
+	inline DoublyLinkedListItem<T>* CyclicalList<T>::getItemAtIndex(int index) const
+	{
+		DoublyLinkedListItem<T>* item = first_;
+		if (index <= static_cast<int>(size_) / 2)
+		{
+			for (int i = 0; i < index; i++)
+			{
+				item = item->getNext();
+			}
+		}
+		else
+		{
+			for (int i = static_cast<int>(size_); i > index; i--)
+			{
+				item = item->getPrevious();
+			}
+		}
+		return item;
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::linkBefore(DoublyLinkedListItem<T>* item, DoublyLinkedListItem<T>* successor)
+	{
+		if (successor == nullptr)
+		{
+			connect(item, item);
+			first_ = item;
+		}
+		else
+		{
+			connect(successor->getPrevious(), item);
+			connect(item, successor);
+		}
+		size_++;
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::linkAt(DoublyLinkedListItem<T>* item, const int index)
+	{
+		if (index == static_cast<int>(size_))
+		{
+			this->linkBefore(item, first_);
+		}
+		else
+		{
+			this->linkBefore(item, this->getItemAtIndex(index));
+			if (index == 0)
+			{
+				first_ = item;
+			}
+		}
+	}
+
+	template<typename T>
+	inline void CyclicalList<T>::connect(DoublyLinkedListItem<T>* previous, DoublyLinkedListItem<T>* next)
+	{
+		previous->setNext(next);
+		next->setPrevious(previous);
+	}
+
+	template<typename T>
+	inline CyclicalList<T>::CyclicalListIterator::CyclicalListIterator(DoublyLinkedListItem<T>* position, size_t remaining) :
+		position_(remaining > 0 ? position : nullptr),
+		remaining_(remaining)
+	{
+	}
+
+	template<typename T>
+	inline CyclicalList<T>::CyclicalListIterator::~CyclicalListIterator()
+	{
+		position_ = nullptr;
+	}
+
+	template<typename T>
+	inline Iterator<T>& CyclicalList<T>::CyclicalListIterator::operator=(const Iterator<T>& other)
+	{
+		if (this != &other)
+		{
+			const CyclicalListIterator& otherIterator = dynamic_cast<const CyclicalList<T>::CyclicalListIterator&>(other);
+			position_ = otherIterator.position_;
+			remaining_ = otherIterator.remaining_;
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline bool CyclicalList<T>::CyclicalListIterator::operator!=(const Iterator<T>& other)
+	{
+		const CyclicalListIterator& otherIterator = dynamic_cast<const CyclicalList<T>::CyclicalListIterator&>(other);
+		return position_ != otherIterator.position_ || remaining_ != otherIterator.remaining_;
+	}
+
+	template<typename T>
+	inline const T CyclicalList<T>::CyclicalListIterator::operator*()
+	{
+		return position_->accessData();
+	}
+
+	template<typename T>
+	inline Iterator<T>& CyclicalList<T>::CyclicalListIterator::operator++()
+	{
+		remaining_--;
+		position_ = remaining_ > 0 ? position_->getNext() : nullptr;
+		return *this;
+	}
+}
@@ -3,6 +3,7 @@
 #include "list.h"
 #include "../structure_iterator.h"
 #include "../ds_routines.h"
+#include <cstdlib>
 
 namespace structures
 {
@@ -15,7 +16,16 @@ namespace structures
 	public:
 		/// <summary> Konstruktor. </summary>
 		/// <param name = "data"> Data, ktore uchovava. </param>
-		DoublyLinkedListItem(T data);
+		DoublyLinkedListItem(const T& data);
+
+		/// <summary> Konstruktor. Data do prvku presunie. </summary>
+		/// <param name = "data"> Data, ktore uchovava. </param>
+		DoublyLinkedListItem(T&& data);
+
+		/// <summary> Konstruktor. Data vytvori priamo v prvku. </summary>
+		/// <param name = "args"> Argumenty konstruktora dat. </param>
+		template<typename... Args>
+		DoublyLinkedListItem(InPlace, Args&&... args);
 
 		/// <summary> Kopirovaci konstruktor. </summary>
 		/// <param name = "other"> Prvok jednstranne zretazeneho zoznamu, z ktoreho sa prevezmu vlastnosti.. </param>
@@ -26,11 +36,11 @@ namespace structures
 
 		/// <summary> Getter nasledujuceho prvku zretazeneho zoznamu. </summary>
 		/// <returns> Nasledujuci prvok zretazeneho zoznamu. </returns>
-		DoublyLinkedListItem<T>* getNext();
+		DoublyLinkedListItem<T>* getNext() const;
 
 		/// <summary> Getter predchadzajuceho prvku zretazeneho zoznamu. </summary>
 		/// <returns> Predchadzajuci prvok zretazeneho zoznamu. </returns>
-		DoublyLinkedListItem<T>* getPrevious();
+		DoublyLinkedListItem<T>* getPrevious() const;
 
 		/// <summary> Setter nasledujuceho prvku zretazeneho zoznamu. </summary>
 		/// <param name�= "next"> Novy nasledujuci prvok zretazeneho zoznamu. </param>
@@ -48,7 +58,7 @@ namespace structures
 	/// <summary> Jednostranne zretazeny zoznam. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v zozname. </typepram>
 	template<typename T>
-	class DoublyLinkedList : public List<T>
+	class DoublyLinkedList final : public List<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -58,6 +68,8 @@ namespace structures
 		/// <param name = "other"> DoublyLinkedList, z ktoreho sa prevezmu vlastnosti. </param>
 		DoublyLinkedList(const DoublyLinkedList<T>& other);
 
+		/// <summary> Presuvaci konstruktor. </summary>
+		/// <param name = "other"> DoublyLinkedList, z ktoreho sa prevezme obsah. </param>
 		DoublyLinkedList(DoublyLinkedList<T>&& other);
 
 		/// <summary> Destruktor. </summary>
@@ -71,6 +83,10 @@ namespace structures
 		/// <returns> Pocet prvkov v zozname. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru zoznam obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zoznam obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
@@ -81,6 +97,9 @@ namespace structures
 		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
 		DoublyLinkedList<T>& operator=(const DoublyLinkedList<T>& other);
 
+		/// <summary> Presuvaci operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho sa prevezme obsah. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
 		DoublyLinkedList<T>& operator=(DoublyLinkedList<T>&& other);
 
 		/// <summary> Vrati adresou prvok na indexe. </summary>
@@ -99,6 +118,15 @@ namespace structures
 		/// <param name = "data"> Pridavany prvok. </param>
 		void add(const T& data) override;
 
+		/// <summary> Prida prvok do zoznamu. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(T&& data) override;
+
+		/// <summary> Vytvori prvok z argumentov priamo v novom uzle zoznamu a prida ho na koniec. </summary>
+		/// <param name = "args"> Argumenty konstruktora pridavaneho prvku. </param>
+		template<typename... Args>
+		void emplace(Args&&... args);
+
 		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
 		/// <param name = "data"> Pridavany prvok. </param>
 		/// <param name = "index"> Index prvku. </param>
@@ -106,6 +134,21 @@ namespace structures
 		/// <remarks> Ak je ako index zadana hodnota poctu prvkov (teda prvy neplatny index), metoda insert sa sprava ako metoda add. </remarks>
 		void insert(const T& data, const int index) override;
 
+		/// <summary> Vlozi prvok do zoznamu na dany index. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
+		void insert(T&& data, const int index) override;
+
+		/// <summary> Vlozi do zoznamu prvky z rozsahu [first, last) tak, ze prvy z nich bude na danom indexe. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku. </param>
+		/// <param name = "first"> Iterator na prvy vkladany prvok. </param>
+		/// <param name = "last"> Iterator za posledny vkladany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [0, size]. </exception>
+		/// <remarks> Z prvkov vytvori retaz a do zoznamu ju zapoji naraz, index sa hlada iba raz. </remarks>
+		template<typename InputIterator>
+		void insertRange(const int index, InputIterator first, InputIterator last);
+
 		/// <summary> Odstrani prvy vyskyt prvku zo zoznamu. </summary>
 		/// <param name = "data"> Odstranovany prvok. </param>
 		/// <returns> true, ak sa podarilo prvok zo zoznamu odobrat, false inak. </returns>
@@ -117,6 +160,20 @@ namespace structures
 		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
 		T removeAt(const int index) override;
 
+		/// <summary> Odstrani zo zoznamu prvky na indexoch z intervalu [from, to). </summary>
+		/// <param name = "from"> Index prveho odstranovaneho prvku. </param>
+		/// <param name = "to"> Index za poslednym odstranovanym prvkom. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak neplati 0 <= from <= to <= size. </exception>
+		/// <remarks> Index sa hlada iba raz, prvky sa odpoja jednym prechodom. </remarks>
+		void removeRange(const int from, const int to) override;
+
+		/// <summary> Odstrani zo zoznamu vsetky prvky, pre ktore predikat vrati true. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		/// <remarks> Jednym prechodom zoznamu. </remarks>
+		template<typename Predicate>
+		size_t removeIf(Predicate predicate);
+
 		/// <summary> Vrati index prveho vyskytu prvku v zozname. </summary>
 		/// <param name = "data"> Prvok, ktoreho index sa hlada. </param>
 		/// <returns> Index prveho vyskytu prvku v zozname, ak sa prvok v zozname nenachadza, vrati -1. </returns>
@@ -134,6 +191,26 @@ namespace structures
 		/// <returns> Iterator na koniec struktury. </returns>
 		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
 		Iterator<T>* getEndIterator() const override;
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function);
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane konstantnu adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function) const;
+	protected:
+		/// <summary> Vlozi do zoznamu prvky pola naraz, pouzije insertRange. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku, uz overeny. </param>
+		/// <param name = "items"> Vkladane prvky. </param>
+		void insertRangeImpl(const int index, const Array<T>& items) override;
+
+		/// <summary> Odstrani prvky jednym prechodom, pouzije removeIf. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		size_t removeIfImpl(const std::function<bool(const T&)>& predicate) override;
 	private:
 		/// <summary> Pocet prvkov v zozname. </summary>
 		size_t size_;
@@ -141,12 +218,29 @@ namespace structures
 		DoublyLinkedListItem<T>* first_;
 		/// <summary> Posledny prvok zoznamu. </summary>
 		DoublyLinkedListItem<T>* last_;
+		/// <summary> Naposledy spristupneny prvok zoznamu (prst), alebo nullptr, ak nie je platny. </summary>
+		/// <remarks> Prechod na index zacina od najblizsieho z prvkov first_, last_ a finger_. </remarks>
+		mutable DoublyLinkedListItem<T>* finger_;
+		/// <summary> Index prvku, na ktory ukazuje prst. </summary>
+		mutable int fingerIndex_;
 	private:
 		/// <summary> Vrati prvok zoznamu na danom indexe. </summary>
 		/// <param name = "index"> Pozadovany index. </summary>
 		/// <returns> Prvok zoznamu na danom indexe. </param>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
 		DoublyLinkedListItem<T>* getItemAtIndex(int index) const;
+
+		/// <summary> Zneplatni prst. </summary>
+		void resetFinger() const;
+
+		/// <summary> Zaradi prvok na koniec zoznamu. </summary>
+		/// <param name = "item"> Zaradovany prvok. </param>
+		void linkLast(DoublyLinkedListItem<T>* item);
+
+		/// <summary> Zaradi prvok do zoznamu na dany index. </summary>
+		/// <param name = "item"> Zaradovany prvok. </param>
+		/// <param name = "index"> Index prvku, musi patrit do intervalu [0, size]. </param>
+		void linkAt(DoublyLinkedListItem<T>* item, const int index);
 	private:
 		/// <summary> Iterator pre DoublyLinkedList. </summary>
 		class LinkedListIterator : public Iterator<T>
@@ -184,13 +278,30 @@ namespace structures
 	};
 
 	template<typename T>
-	inline DoublyLinkedListItem<T>::DoublyLinkedListItem(T data) :
+	inline DoublyLinkedListItem<T>::DoublyLinkedListItem(const T& data) :
 		DataItem<T>(data),
 		next_(nullptr),
 		previous_(nullptr)
 	{
 	}
 
+	template<typename T>
+	inline DoublyLinkedListItem<T>::DoublyLinkedListItem(T&& data) :
+		DataItem<T>(std::move(data)),
+		next_(nullptr),
+		previous_(nullptr)
+	{
+	}
+
+	template<typename T>
+	template<typename... Args>
+	inline DoublyLinkedListItem<T>::DoublyLinkedListItem(InPlace, Args&&... args) :
+		DataItem<T>(InPlace(), std::forward<Args>(args)...),
+		next_(nullptr),
+		previous_(nullptr)
+	{
+	}
+
 	template<typename T>
 	inline DoublyLinkedListItem<T>::DoublyLinkedListItem(const DoublyLinkedListItem<T>& other) :
 		DataItem<T>(other),
@@ -207,13 +318,13 @@ namespace structures
 	}
 
 	template<typename T>
-	inline DoublyLinkedListItem<T>* DoublyLinkedListItem<T>::getNext()
+	inline DoublyLinkedListItem<T>* DoublyLinkedListItem<T>::getNext() const
 	{
 		return next_;
 	}
 
 	template<typename T>
-	inline DoublyLinkedListItem<T>* DoublyLinkedListItem<T>::getPrevious()
+	inline DoublyLinkedListItem<T>* DoublyLinkedListItem<T>::getPrevious() const
 	{
 		return previous_;
 	}
@@ -235,7 +346,9 @@ namespace structures
 		List<T>(),
 		size_(0),
 		first_(nullptr),
-		last_(nullptr)
+		last_(nullptr),
+		finger_(nullptr),
+		fingerIndex_(0)
 	{
 	}
 
@@ -248,13 +361,17 @@ namespace structures
 
 	template<typename T>
 	inline DoublyLinkedList<T>::DoublyLinkedList(DoublyLinkedList<T>&& other) :
+		List<T>(),
 		size_(other.size_),
 		first_(other.first_),
-		last_(other.last_)
+		last_(other.last_),
+		finger_(nullptr),
+		fingerIndex_(0)
 	{
 		other.size_ = 0;
 		other.first_ = nullptr;
 		other.last_ = nullptr;
+		other.resetFinger();
 	}
 
 	template<typename T>
@@ -275,6 +392,14 @@ namespace structures
 		return size_;
 	}
 
+	template<typename T>
+	inline MemoryUsage DoublyLinkedList<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(DoublyLinkedList<T>));
+		result.addAllocations(sizeof(DoublyLinkedListItem<T>), this->size_);
+		return result;
+	}
+
 	template<typename T>
 	inline List<T>& DoublyLinkedList<T>::operator=(const List<T>& other)
 	{
@@ -310,7 +435,9 @@ namespace structures
 			size_ = std::exchange(other.size_, 0);
 			first_ = std::exchange(other.first_, nullptr);
 			last_ = std::exchange(other.last_, nullptr);
+			other.resetFinger();
 		}
+		return *this;
 	}
 
 	template<typename T>
@@ -330,65 +457,34 @@ namespace structures
 	template<typename T>
 	inline void DoublyLinkedList<T>::add(const T& data)
 	{
-		DoublyLinkedListItem<T>* item = new DoublyLinkedListItem<T>(data);
-		if (size_ == 0)
-		{
-			first_ = item;
-		}
-		else
-		{
-			last_->setNext(item);
-			item->setPrevious(last_);
-		}
-		last_ = item;
-		size_++;
+		this->linkLast(new DoublyLinkedListItem<T>(data));
+	}
+
+	template<typename T>
+	inline void DoublyLinkedList<T>::add(T&& data)
+	{
+		this->linkLast(new DoublyLinkedListItem<T>(std::move(data)));
+	}
+
+	template<typename T>
+	template<typename... Args>
+	inline void DoublyLinkedList<T>::emplace(Args&&... args)
+	{
+		this->linkLast(new DoublyLinkedListItem<T>(InPlace(), std::forward<Args>(args)...));
 	}
 
 	template<typename T>
 	inline void DoublyLinkedList<T>::insert(const T& data, const int index)
 	{
 		DSRoutines::rangeCheckExcept(index, size_ + 1, "DoubleLinkedList<T>::insert: Invalid index.");
-		DoublyLinkedListItem<T>* item = new DoublyLinkedListItem<T>(data);
-		if (size_ == 0)
-		{
-			first_ = item;
-			last_ = item;
-		}
-		else
-		{
-			if (index == 0)
-			{
-				item->setNext(first_);
-				first_->setPrevious(item);
-				first_ = item;
-			}
-			else if (index == size_)
-			{
-				last_->setNext(item);
-				item->setPrevious(last_);
-				last_ = item;
-			}
-			else
-			{
-				DoublyLinkedListItem<T>* beforeItem;
-				DoublyLinkedListItem<T>* afterItem;
-				if (index < static_cast<int>(size_) / 2)
-				{
-					beforeItem = this->getItemAtIndex(index - 1);
-					afterItem = beforeItem->getNext();
-				}
-				else
-				{
-					afterItem = this->getItemAtIndex(index);
-					beforeItem = afterItem->getPrevious();
-				}
-				beforeItem->setNext(item);
-				item->setNext(afterItem);
-				afterItem->setPrevious(item);
-				item->setPrevious(beforeItem);
-			}
-		}
-		size_++;
+		this->linkAt(new DoublyLinkedListItem<T>(data), index);
+	}
+
+	template<typename T>
+	inline void DoublyLinkedList<T>::insert(T&& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "DoubleLinkedList<T>::insert: Invalid index.");
+		this->linkAt(new DoublyLinkedListItem<T>(std::move(data)), index);
 	}
 
 	template<typename T>
@@ -418,31 +514,33 @@ namespace structures
 				item = first_;
 				first_ = item->getNext();
 				first_->setPrevious(nullptr);
+				if (finger_ == item)
+				{
+					this->resetFinger();
+				}
+				else if (finger_ != nullptr)
+				{
+					fingerIndex_--;
+				}
 			}
 			else if (index == size_ - 1)
 			{
 				item = last_;
 				last_ = item->getPrevious();
 				last_->setNext(nullptr);
+				if (finger_ == item)
+				{
+					this->resetFinger();
+				}
 			}
 			else
 			{
-				DoublyLinkedListItem<T>* beforeItem;
-				DoublyLinkedListItem<T>* afterItem;
-				if (index < static_cast<int>(size_) / 2)
-				{
-					beforeItem = this->getItemAtIndex(index - 1);
-					item = beforeItem->getNext();
-					afterItem = item->getNext();
-				}
-				else
-				{
-					afterItem = this->getItemAtIndex(index + 1);
-					item = afterItem->getPrevious();
-					beforeItem = item->getPrevious();
-				}
+				item = this->getItemAtIndex(index);
+				DoublyLinkedListItem<T>* beforeItem = item->getPrevious();
+				DoublyLinkedListItem<T>* afterItem = item->getNext();
 				beforeItem->setNext(afterItem);
 				afterItem->setPrevious(beforeItem);
+				finger_ = afterItem;
 			}
 		}
 		else
@@ -450,13 +548,145 @@ namespace structures
 			item = first_;
 			first_ = nullptr;
 			last_ = nullptr;
+			this->resetFinger();
 		}
 		size_--;
-		T data = item->accessData();
+		T data = std::move(item->accessData());
 		delete item;
 		return data;
 	}
 
+	template<typename T>
+	template<typename InputIterator>
+	inline void DoublyLinkedList<T>::insertRange(const int index, InputIterator first, InputIterator last)
+	{
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "DoubleLinkedList<T>::insertRange: Invalid index.");
+		if (first == last)
+		{
+			return;
+		}
+		DoublyLinkedListItem<T>* head = new DoublyLinkedListItem<T>(*first);
+		DoublyLinkedListItem<T>* tail = head;
+		size_t count = 1;
+		for (++first; first != last; ++first)
+		{
+			DoublyLinkedListItem<T>* item = new DoublyLinkedListItem<T>(*first);
+			tail->setNext(item);
+			item->setPrevious(tail);
+			tail = item;
+			count++;
+		}
+		DoublyLinkedListItem<T>* afterItem = index < static_cast<int>(size_) ? this->getItemAtIndex(index) : nullptr;
+		DoublyLinkedListItem<T>* beforeItem = afterItem != nullptr ? afterItem->getPrevious() : last_;
+		head->setPrevious(beforeItem);
+		tail->setNext(afterItem);
+		if (beforeItem != nullptr)
+		{
+			beforeItem->setNext(head);
+		}
+		else
+		{
+			first_ = head;
+		}
+		if (afterItem != nullptr)
+		{
+			afterItem->setPrevious(tail);
+		}
+		else
+		{
+			last_ = tail;
+		}
+		size_ += count;
+		this->resetFinger();
+	}
+
+	template<typename T>
+	inline void DoublyLinkedList<T>::removeRange(const int from, const int to)
+	{
+		DSRoutines::rangeCheckExcept(to, size_ + 1, "DoubleLinkedList<T>::removeRange: Invalid index.");
+		DSRoutines::rangeCheckExcept(from, to + 1, "DoubleLinkedList<T>::removeRange: Invalid index.");
+		if (from == to)
+		{
+			return;
+		}
+		DoublyLinkedListItem<T>* item = this->getItemAtIndex(from);
+		DoublyLinkedListItem<T>* beforeItem = item->getPrevious();
+		for (int i = from; i < to; i++)
+		{
+			DoublyLinkedListItem<T>* next = item->getNext();
+			delete item;
+			item = next;
+		}
+		if (beforeItem != nullptr)
+		{
+			beforeItem->setNext(item);
+		}
+		else
+		{
+			first_ = item;
+		}
+		if (item != nullptr)
+		{
+			item->setPrevious(beforeItem);
+		}
+		else
+		{
+			last_ = beforeItem;
+		}
+		size_ -= to - from;
+		this->resetFinger();
+	}
+
+	template<typename T>
+	template<typename Predicate>
+	inline size_t DoublyLinkedList<T>::removeIf(Predicate predicate)
+	{
+		size_t removed = 0;
+		DoublyLinkedListItem<T>* item = first_;
+		while (item != nullptr)
+		{
+			DoublyLinkedListItem<T>* next = item->getNext();
+			if (predicate(static_cast<const T&>(item->accessData())))
+			{
+				DoublyLinkedListItem<T>* beforeItem = item->getPrevious();
+				if (beforeItem != nullptr)
+				{
+					beforeItem->setNext(next);
+				}
+				else
+				{
+					first_ = next;
+				}
+				if (next != nullptr)
+				{
+					next->setPrevious(beforeItem);
+				}
+				else
+				{
+					last_ = beforeItem;
+				}
+				delete item;
+				removed++;
+			}
+			item = next;
+		}
+		size_ -= removed;
+		this->resetFinger();
+		return removed;
+	}
+
+	template<typename T>
+	inline void DoublyLinkedList<T>::insertRangeImpl(const int index, const Array<T>& items)
+	{
+		this->insertRange(index, items.data(), items.data() + items.size());
+	}
+
+	template<typename T>
+	inline size_t DoublyLinkedList<T>::removeIfImpl(const std::function<bool(const T&)>& predicate)
+	{
+		return this->removeIf(predicate);
+	}
+
 	template<typename T>
 	inline int DoublyLinkedList<T>::getIndexOf(const T& data)
 	{
@@ -495,6 +725,7 @@ namespace structures
 		first_ = nullptr;
 		last_ = nullptr;
 		size_ = 0;
+		this->resetFinger();
 	}
 
 	template<typename T>
@@ -509,29 +740,116 @@ namespace structures
 		return new LinkedListIterator(nullptr);
 	}
 
+	template<typename T>
+	template<typename Function>
+	inline void DoublyLinkedList<T>::forEach(Function function)
+	{
+		for (DoublyLinkedListItem<T>* item = first_; item != nullptr; item = item->getNext())
+		{
+			function(item->accessData());
+		}
+	}
+
+	template<typename T>
+	template<typename Function>
+	inline void DoublyLinkedList<T>::forEach(Function function) const
+	{
+		for (const DoublyLinkedListItem<T>* item = first_; item != nullptr; item = item->getNext())
+		{
+			function(item->accessData());
+		}
+	}
+
 	template<typename T>
 	inline DoublyLinkedListItem<T>* DoublyLinkedList<T>::getItemAtIndex(int index) const
 	{
 		DSRoutines::rangeCheckExcept(index, size_, "DoubleLinkedList<T>::getItemAtIndex: Invalid index.");
-		
-		if (index < static_cast<int>(size_) / 2)
+
+		DoublyLinkedListItem<T>* item = first_;
+		int position = 0;
+		int distance = index;
+		if (static_cast<int>(size_) - 1 - index < distance)
 		{
-			DoublyLinkedListItem<T>* item = first_;
-			for (int i = 0; i < index; i++)
-			{
-				item = item->getNext();
-			}
-			return item;
+			item = last_;
+			position = static_cast<int>(size_) - 1;
+			distance = position - index;
+		}
+		if (finger_ != nullptr && std::abs(fingerIndex_ - index) < distance)
+		{
+			item = finger_;
+			position = fingerIndex_;
+		}
+		for (; position < index; position++)
+		{
+			item = item->getNext();
+		}
+		for (; position > index; position--)
+		{
+			item = item->getPrevious();
+		}
+		finger_ = item;
+		fingerIndex_ = index;
+		return item;
+	}
+
+	template<typename T>
+	inline void DoublyLinkedList<T>::resetFinger() const
+	{
+		finger_ = nullptr;
+		fingerIndex_ = 0;
+	}
+
+	template<typename T>
+	inline void DoublyLinkedList<T>::linkLast(DoublyLinkedListItem<T>* item)
+	{
+		if (size_ == 0)
+		{
+			first_ = item;
+		}
+		else
+		{
+			last_->setNext(item);
+			item->setPrevious(last_);
+		}
+		last_ = item;
+		size_++;
+	}
+
+	template<typename T>
+	inline void DoublyLinkedList<T>::linkAt(DoublyLinkedListItem<T>* item, const int index)
+	{
+		if (size_ == 0)
+		{
+			first_ = item;
+			last_ = item;
 		}
 		else
 		{
-			DoublyLinkedListItem<T>* item = last_;
-			for (size_t i = 0; i < size_ - 1 - index; i++)
+			if (index == 0)
+			{
+				item->setNext(first_);
+				first_->setPrevious(item);
+				first_ = item;
+			}
+			else if (index == size_)
 			{
-				item = item->getPrevious();
+				last_->setNext(item);
+				item->setPrevious(last_);
+				last_ = item;
+			}
+			else
+			{
+				DoublyLinkedListItem<T>* afterItem = this->getItemAtIndex(index);
+				DoublyLinkedListItem<T>* beforeItem = afterItem->getPrevious();
+				beforeItem->setNext(item);
+				item->setNext(afterItem);
+				afterItem->setPrevious(item);
+				item->setPrevious(beforeItem);
 			}
-			return item;
 		}
+		size_++;
+		finger_ = item;
+		fingerIndex_ = index;
 	}
 
 	template<typename T>
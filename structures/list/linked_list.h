@@ -15,7 +15,16 @@ namespace structures
 	public:
 		/// <summary> Konstruktor. </summary>
 		/// <param name = "data"> Data, ktore uchovava. </param>
-		LinkedListItem(T data);
+		LinkedListItem(const T& data);
+
+		/// <summary> Konstruktor. Data do prvku presunie. </summary>
+		/// <param name = "data"> Data, ktore uchovava. </param>
+		LinkedListItem(T&& data);
+
+		/// <summary> Konstruktor. Data vytvori priamo v prvku. </summary>
+		/// <param name = "args"> Argumenty konstruktora dat. </param>
+		template<typename... Args>
+		LinkedListItem(InPlace, Args&&... args);
 
 		/// <summary> Kopirovaci konstruktor. </summary>
 		/// <param name = "other"> Prvok jednstranne zretazeneho zoznamu, z ktoreho sa prevezmu vlastnosti.. </param>
@@ -26,7 +35,7 @@ namespace structures
 
 		/// <summary> Getter nasledujuceho prvku zretazeneho zoznamu. </summary>
 		/// <returns> Nasledujuci prvok zretazeneho zoznamu. </returns>
-		LinkedListItem<T>* getNext();
+		LinkedListItem<T>* getNext() const;
 
 		/// <summary> Setter nasledujuceho prvku zretazeneho zoznamu. </summary>
 		/// <param name�= "next"> Novy nasledujuci prvok zretazeneho zoznamu. </param>
@@ -39,7 +48,7 @@ namespace structures
 	/// <summary> Jednostranne zretazeny zoznam. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v zozname. </typepram>
 	template<typename T>
-	class LinkedList : public List<T>
+	class LinkedList final : public List<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -49,6 +58,8 @@ namespace structures
 		/// <param name = "other"> LinkedList, z ktoreho sa prevezmu vlastnosti. </param>
 		LinkedList(const LinkedList<T>& other);
 
+		/// <summary> Presuvaci konstruktor. </summary>
+		/// <param name = "other"> LinkedList, z ktoreho sa prevezme obsah. </param>
 		LinkedList(LinkedList<T>&& other);
 
 		/// <summary> Destruktor. </summary>
@@ -62,18 +73,25 @@ namespace structures
 		/// <returns> Pocet prvkov v zozname. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru zoznam obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zoznam obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
 		List<T>& operator=(const List<T>& other) override;
 
-		List<T>& operator=(List<T>&& other);
-
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
 		LinkedList<T>& operator=(const LinkedList<T>& other);
 
+		/// <summary> Presuvaci operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho sa prevezme obsah. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		LinkedList<T>& operator=(LinkedList<T>&& other);
+
 		/// <summary> Vrati adresou prvok na indexe. </summary>
 		/// <param name = "index"> Index prvku. </param>
 		/// <returns> Adresa prvku na danom indexe. </returns>
@@ -90,6 +108,15 @@ namespace structures
 		/// <param name = "data"> Pridavany prvok. </param>
 		void add(const T& data) override;
 
+		/// <summary> Prida prvok do zoznamu. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(T&& data) override;
+
+		/// <summary> Vytvori prvok z argumentov priamo v novom uzle zoznamu a prida ho na koniec. </summary>
+		/// <param name = "args"> Argumenty konstruktora pridavaneho prvku. </param>
+		template<typename... Args>
+		void emplace(Args&&... args);
+
 		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
 		/// <param name = "data"> Pridavany prvok. </param>
 		/// <param name = "index"> Index prvku. </param>
@@ -97,6 +124,21 @@ namespace structures
 		/// <remarks> Ak je ako index zadana hodnota poctu prvkov (teda prvy neplatny index), metoda insert sa sprava ako metoda add. </remarks>
 		void insert(const T& data, const int index) override;
 
+		/// <summary> Vlozi prvok do zoznamu na dany index. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
+		void insert(T&& data, const int index) override;
+
+		/// <summary> Vlozi do zoznamu prvky z rozsahu [first, last) tak, ze prvy z nich bude na danom indexe. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku. </param>
+		/// <param name = "first"> Iterator na prvy vkladany prvok. </param>
+		/// <param name = "last"> Iterator za posledny vkladany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [0, size]. </exception>
+		/// <remarks> Z prvkov vytvori retaz a do zoznamu ju zapoji naraz, index sa hlada iba raz. </remarks>
+		template<typename InputIterator>
+		void insertRange(const int index, InputIterator first, InputIterator last);
+
 		/// <summary> Odstrani prvy vyskyt prvku zo zoznamu. </summary>
 		/// <param name = "data"> Odstranovany prvok. </param>
 		/// <returns> true, ak sa podarilo prvok zo zoznamu odobrat, false inak. </returns>
@@ -108,6 +150,20 @@ namespace structures
 		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
 		T removeAt(const int index) override;
 
+		/// <summary> Odstrani zo zoznamu prvky na indexoch z intervalu [from, to). </summary>
+		/// <param name = "from"> Index prveho odstranovaneho prvku. </param>
+		/// <param name = "to"> Index za poslednym odstranovanym prvkom. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak neplati 0 <= from <= to <= size. </exception>
+		/// <remarks> Index sa hlada iba raz, prvky sa odpoja jednym prechodom. </remarks>
+		void removeRange(const int from, const int to) override;
+
+		/// <summary> Odstrani zo zoznamu vsetky prvky, pre ktore predikat vrati true. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		/// <remarks> Jednym prechodom zoznamu. </remarks>
+		template<typename Predicate>
+		size_t removeIf(Predicate predicate);
+
 		/// <summary> Vrati index prveho vyskytu prvku v zozname. </summary>
 		/// <param name = "data"> Prvok, ktoreho index sa hlada. </param>
 		/// <returns> Index prveho vyskytu prvku v zozname, ak sa prvok v zozname nenachadza, vrati -1. </returns>
@@ -125,6 +181,26 @@ namespace structures
 		/// <returns> Iterator na koniec struktury. </returns>
 		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
 		Iterator<T>* getEndIterator() const override;
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function);
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane konstantnu adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function) const;
+	protected:
+		/// <summary> Vlozi do zoznamu prvky pola naraz, pouzije insertRange. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku, uz overeny. </param>
+		/// <param name = "items"> Vkladane prvky. </param>
+		void insertRangeImpl(const int index, const Array<T>& items) override;
+
+		/// <summary> Odstrani prvky jednym prechodom, pouzije removeIf. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		size_t removeIfImpl(const std::function<bool(const T&)>& predicate) override;
 	private:
 		/// <summary> Pocet prvkov v zozname. </summary>
 		size_t size_;
@@ -132,12 +208,29 @@ namespace structures
 		LinkedListItem<T>* first_;
 		/// <summary> Posledny prvok zoznamu. </summary>
 		LinkedListItem<T>* last_;
+		/// <summary> Naposledy spristupneny prvok zoznamu (prst), alebo nullptr, ak nie je platny. </summary>
+		/// <remarks> Sekvencny pristup cez index pokracuje od prsta, takze prechod zoznamom cez indexy je amortizovane O(n). </remarks>
+		mutable LinkedListItem<T>* finger_;
+		/// <summary> Index prvku, na ktory ukazuje prst. </summary>
+		mutable int fingerIndex_;
 	private:
 		/// <summary> Vrati prvok zoznamu na danom indexe. </summary>
 		/// <param name = "index"> Pozadovany index. </summary>
 		/// <returns> Prvok zoznamu na danom indexe. </param>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
 		LinkedListItem<T>* getItemAtIndex(int index) const;
+
+		/// <summary> Zneplatni prst. </summary>
+		void resetFinger() const;
+
+		/// <summary> Zaradi prvok na koniec zoznamu. </summary>
+		/// <param name = "item"> Zaradovany prvok. </param>
+		void linkLast(LinkedListItem<T>* item);
+
+		/// <summary> Zaradi prvok do zoznamu na dany index. </summary>
+		/// <param name = "item"> Zaradovany prvok. </param>
+		/// <param name = "index"> Index prvku, musi patrit do intervalu [0, size]. </param>
+		void linkAt(LinkedListItem<T>* item, const int index);
 	private:
 		/// <summary> Iterator pre LinkedList. </summary>
 		class LinkedListIterator : public Iterator<T>
@@ -175,12 +268,27 @@ namespace structures
 	};
 
 	template<typename T>
-	inline LinkedListItem<T>::LinkedListItem(T data) :
+	inline LinkedListItem<T>::LinkedListItem(const T& data) :
 		DataItem<T>(data),
 		next_(nullptr)
 	{
 	}
 
+	template<typename T>
+	inline LinkedListItem<T>::LinkedListItem(T&& data) :
+		DataItem<T>(std::move(data)),
+		next_(nullptr)
+	{
+	}
+
+	template<typename T>
+	template<typename... Args>
+	inline LinkedListItem<T>::LinkedListItem(InPlace, Args&&... args) :
+		DataItem<T>(InPlace(), std::forward<Args>(args)...),
+		next_(nullptr)
+	{
+	}
+
 	template<typename T>
 	inline LinkedListItem<T>::LinkedListItem(const LinkedListItem<T>& other) :
 		DataItem<T>(other),
@@ -195,7 +303,7 @@ namespace structures
 	}
 
 	template<typename T>
-	inline LinkedListItem<T>* LinkedListItem<T>::getNext()
+	inline LinkedListItem<T>* LinkedListItem<T>::getNext() const
 	{
 		return next_;
 	}
@@ -211,7 +319,9 @@ namespace structures
 		List<T>(),
 		size_(0),
 		first_(nullptr),
-		last_(nullptr)
+		last_(nullptr),
+		finger_(nullptr),
+		fingerIndex_(0)
 	{
 	}
 
@@ -224,10 +334,14 @@ namespace structures
 
 	template<typename T>
 	inline LinkedList<T>::LinkedList(LinkedList<T>&& other) :
+		List<T>(),
 		size_(std::exchange(other.size_, 0)),
 		first_(std::exchange(other.first_, nullptr)),
-		last_(std::exchange(other.last_, nullptr))
+		last_(std::exchange(other.last_, nullptr)),
+		finger_(nullptr),
+		fingerIndex_(0)
 	{
+		other.resetFinger();
 	}
 
 	template<typename T>
@@ -249,25 +363,21 @@ namespace structures
 	}
 
 	template<typename T>
-	inline List<T>& LinkedList<T>::operator=(const List<T>& other)
+	inline MemoryUsage LinkedList<T>::memoryUsage() const
 	{
-		if (this != &other)
-		{
-			*this = dynamic_cast<const LinkedList<T>&>(other);
-		}
-		return *this;
+		MemoryUsage result(sizeof(LinkedList<T>));
+		result.addAllocations(sizeof(LinkedListItem<T>), this->size_);
+		return result;
 	}
 
 	template<typename T>
-	inline List<T>& LinkedList<T>::operator=(List<T>&& other)
+	inline List<T>& LinkedList<T>::operator=(const List<T>& other)
 	{
 		if (this != &other)
 		{
-			clear();
-			size_ = std::exchange(other.size_, 0);
-			first_ = std::exchange(other.first_, nullptr);
-			last_ = std::exchange(other.last_, nullptr);
+			*this = dynamic_cast<const LinkedList<T>&>(other);
 		}
+		return *this;
 	}
 
 	template<typename T>
@@ -286,6 +396,20 @@ namespace structures
 		return *this;
 	}
 
+	template<typename T>
+	inline LinkedList<T>& LinkedList<T>::operator=(LinkedList<T>&& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+			size_ = std::exchange(other.size_, 0);
+			first_ = std::exchange(other.first_, nullptr);
+			last_ = std::exchange(other.last_, nullptr);
+			other.resetFinger();
+		}
+		return *this;
+	}
+
 	template<typename T>
 	inline T& LinkedList<T>::operator[](const int index)
 	{
@@ -303,50 +427,34 @@ namespace structures
 	template<typename T>
 	inline void LinkedList<T>::add(const T& data)
 	{
-		LinkedListItem<T>* item = new LinkedListItem<T>(data);
-		if (size_ == 0)
-		{
-			first_ = item;
-		}
-		else
-		{
-			last_->setNext(item);
-		}
-		last_ = item;
-		size_++;
+		this->linkLast(new LinkedListItem<T>(data));
+	}
+
+	template<typename T>
+	inline void LinkedList<T>::add(T&& data)
+	{
+		this->linkLast(new LinkedListItem<T>(std::move(data)));
+	}
+
+	template<typename T>
+	template<typename... Args>
+	inline void LinkedList<T>::emplace(Args&&... args)
+	{
+		this->linkLast(new LinkedListItem<T>(InPlace(), std::forward<Args>(args)...));
 	}
 
 	template<typename T>
 	inline void LinkedList<T>::insert(const T& data, const int index)
 	{
 		DSRoutines::rangeCheckExcept(index, size_ + 1, "LinkedList<T>::insert: Invalid index.");
-		LinkedListItem<T>* item = new LinkedListItem<T>(data);
-		if (size_ == 0)
-		{
-			first_ = item;
-			last_ = item;
-		}
-		else
-		{
-			if (index == 0)
-			{
-				item->setNext(first_);
-				first_ = item;
-			}
-			else if (index == size_)
-			{
-				last_->setNext(item);
-				last_ = item;
-			}
-			else
-			{
-				LinkedListItem<T>* beforeItem = this->getItemAtIndex(index - 1);
-				LinkedListItem<T>* afterItem = beforeItem->getNext();
-				beforeItem->setNext(item);
-				item->setNext(afterItem);
-			}
-		}
-		size_++;
+		this->linkAt(new LinkedListItem<T>(data), index);
+	}
+
+	template<typename T>
+	inline void LinkedList<T>::insert(T&& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "LinkedList<T>::insert: Invalid index.");
+		this->linkAt(new LinkedListItem<T>(std::move(data)), index);
 	}
 
 	template<typename T>
@@ -375,6 +483,14 @@ namespace structures
 			{
 				item = first_;
 				first_ = item->getNext();
+				if (finger_ == item)
+				{
+					this->resetFinger();
+				}
+				else if (finger_ != nullptr)
+				{
+					fingerIndex_--;
+				}
 			}
 			else if (index == size_ - 1)
 			{
@@ -396,13 +512,132 @@ namespace structures
 			item = first_;
 			first_ = nullptr;
 			last_ = nullptr;
+			this->resetFinger();
 		}
 		size_--;
-		T data = item->accessData();
+		T data = std::move(item->accessData());
 		delete item;
 		return data;
 	}
 
+	template<typename T>
+	template<typename InputIterator>
+	inline void LinkedList<T>::insertRange(const int index, InputIterator first, InputIterator last)
+	{
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "LinkedList<T>::insertRange: Invalid index.");
+		if (first == last)
+		{
+			return;
+		}
+		LinkedListItem<T>* head = new LinkedListItem<T>(*first);
+		LinkedListItem<T>* tail = head;
+		size_t count = 1;
+		for (++first; first != last; ++first)
+		{
+			LinkedListItem<T>* item = new LinkedListItem<T>(*first);
+			tail->setNext(item);
+			tail = item;
+			count++;
+		}
+		if (index == 0)
+		{
+			tail->setNext(first_);
+			first_ = head;
+		}
+		else
+		{
+			LinkedListItem<T>* beforeItem = this->getItemAtIndex(index - 1);
+			tail->setNext(beforeItem->getNext());
+			beforeItem->setNext(head);
+		}
+		if (tail->getNext() == nullptr)
+		{
+			last_ = tail;
+		}
+		size_ += count;
+		this->resetFinger();
+	}
+
+	template<typename T>
+	inline void LinkedList<T>::removeRange(const int from, const int to)
+	{
+		DSRoutines::rangeCheckExcept(to, size_ + 1, "LinkedList<T>::removeRange: Invalid index.");
+		DSRoutines::rangeCheckExcept(from, to + 1, "LinkedList<T>::removeRange: Invalid index.");
+		if (from == to)
+		{
+			return;
+		}
+		LinkedListItem<T>* beforeItem = from > 0 ? this->getItemAtIndex(from - 1) : nullptr;
+		LinkedListItem<T>* item = beforeItem != nullptr ? beforeItem->getNext() : first_;
+		for (int i = from; i < to; i++)
+		{
+			LinkedListItem<T>* next = item->getNext();
+			delete item;
+			item = next;
+		}
+		if (beforeItem != nullptr)
+		{
+			beforeItem->setNext(item);
+		}
+		else
+		{
+			first_ = item;
+		}
+		if (item == nullptr)
+		{
+			last_ = beforeItem;
+		}
+		size_ -= to - from;
+		this->resetFinger();
+	}
+
+	template<typename T>
+	template<typename Predicate>
+	inline size_t LinkedList<T>::removeIf(Predicate predicate)
+	{
+		size_t removed = 0;
+		LinkedListItem<T>* beforeItem = nullptr;
+		LinkedListItem<T>* item = first_;
+		while (item != nullptr)
+		{
+			LinkedListItem<T>* next = item->getNext();
+			if (predicate(static_cast<const T&>(item->accessData())))
+			{
+				if (beforeItem != nullptr)
+				{
+					beforeItem->setNext(next);
+				}
+				else
+				{
+					first_ = next;
+				}
+				delete item;
+				removed++;
+			}
+			else
+			{
+				beforeItem = item;
+			}
+			item = next;
+		}
+		last_ = beforeItem;
+		size_ -= removed;
+		this->resetFinger();
+		return removed;
+	}
+
+	template<typename T>
+	inline void LinkedList<T>::insertRangeImpl(const int index, const Array<T>& items)
+	{
+		this->insertRange(index, items.data(), items.data() + items.size());
+	}
+
+	template<typename T>
+	inline size_t LinkedList<T>::removeIfImpl(const std::function<bool(const T&)>& predicate)
+	{
+		return this->removeIf(predicate);
+	}
+
 	template<typename T>
 	inline int LinkedList<T>::getIndexOf(const T& data)
 	{
@@ -441,6 +676,7 @@ namespace structures
 		first_ = nullptr;
 		last_ = nullptr;
 		size_ = 0;
+		this->resetFinger();
 	}
 
 	template<typename T>
@@ -455,18 +691,105 @@ namespace structures
 		return new LinkedListIterator(nullptr);
 	}
 
+	template<typename T>
+	template<typename Function>
+	inline void LinkedList<T>::forEach(Function function)
+	{
+		for (LinkedListItem<T>* item = first_; item != nullptr; item = item->getNext())
+		{
+			function(item->accessData());
+		}
+	}
+
+	template<typename T>
+	template<typename Function>
+	inline void LinkedList<T>::forEach(Function function) const
+	{
+		for (const LinkedListItem<T>* item = first_; item != nullptr; item = item->getNext())
+		{
+			function(item->accessData());
+		}
+	}
+
 	template<typename T>
 	inline LinkedListItem<T>* LinkedList<T>::getItemAtIndex(int index) const
 	{
 		DSRoutines::rangeCheckExcept(index, size_, "LinkedList<T>::getItemAtIndex: Invalid index.");
+		if (index == static_cast<int>(size_) - 1)
+		{
+			return last_;
+		}
 		LinkedListItem<T>* item = first_;
-		for (int i = 0; i < index; i++)
+		int i = 0;
+		if (finger_ != nullptr && fingerIndex_ <= index)
+		{
+			item = finger_;
+			i = fingerIndex_;
+		}
+		for (; i < index; i++)
 		{
 			item = item->getNext();
 		}
+		finger_ = item;
+		fingerIndex_ = index;
 		return item;
 	}
 
+	template<typename T>
+	inline void LinkedList<T>::resetFinger() const
+	{
+		finger_ = nullptr;
+		fingerIndex_ = 0;
+	}
+
+	template<typename T>
+	inline void LinkedList<T>::linkLast(LinkedListItem<T>* item)
+	{
+		if (size_ == 0)
+		{
+			first_ = item;
+		}
+		else
+		{
+			last_->setNext(item);
+		}
+		last_ = item;
+		size_++;
+	}
+
+	template<typename T>
+	inline void LinkedList<T>::linkAt(LinkedListItem<T>* item, const int index)
+	{
+		if (size_ == 0)
+		{
+			first_ = item;
+			last_ = item;
+		}
+		else
+		{
+			if (index == 0)
+			{
+				item->setNext(first_);
+				first_ = item;
+			}
+			else if (index == size_)
+			{
+				last_->setNext(item);
+				last_ = item;
+			}
+			else
+			{
+				LinkedListItem<T>* beforeItem = this->getItemAtIndex(index - 1);
+				LinkedListItem<T>* afterItem = beforeItem->getNext();
+				beforeItem->setNext(item);
+				item->setNext(afterItem);
+			}
+		}
+		size_++;
+		finger_ = item;
+		fingerIndex_ = index;
+	}
+
 	template<typename T>
 	inline LinkedList<T>::LinkedListIterator::LinkedListIterator(LinkedListItem<T>* position) :
 		position_(position)
@@ -4,6 +4,11 @@
 #include "../structure.h"
 #include "../structure_iterator.h"
 #include "../ds_structure_types.h"
+#include "../ds_routines.h"
+#include "../array/array.h"
+
+#include <functional>
+#include <iterator>
 
 namespace structures
 {
@@ -50,12 +55,40 @@ namespace structures
 		/// <param name = "data"> Pridavany prvok. </param>
 		virtual void add(const T& data) = 0;
 
+		/// <summary> Prida prvok do zoznamu. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		virtual void add(T&& data) = 0;
+
+		/// <summary> Vytvori prvok z argumentov a prida ho do zoznamu. </summary>
+		/// <param name = "args"> Argumenty konstruktora pridavaneho prvku. </param>
+		/// <remarks>
+		/// Cez odkaz na List sa prvok vytvori raz a do zoznamu sa presunie metodou add, nekopiruje sa.
+		/// ArrayList, LinkedList a DoublyLinkedList maju vlastnu metodu, ktora prvok vytvori priamo na mieste.
+		/// </remarks>
+		template<typename... Args>
+		void emplace(Args&&... args);
+
 		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
 		/// <param name = "data"> Pridavany prvok. </param>
 		/// <param name = "index"> Index prvku. </param>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
 		/// <remarks> Ak je ako index zadana hodnota poctu prvkov (teda prvy neplatny index), metoda insert sa sprava ako metoda add. </remarks>
 		virtual void insert(const T& data, const int index) = 0;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
+		virtual void insert(T&& data, const int index) = 0;
+
+		/// <summary> Vlozi do zoznamu prvky z rozsahu [first, last) tak, ze prvy z nich bude na danom indexe. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku. </param>
+		/// <param name = "first"> Iterator na prvy vkladany prvok. </param>
+		/// <param name = "last"> Iterator za posledny vkladany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [0, size]. </exception>
+		/// <remarks> Prvky skopiruje do pola a vlozi ich virtualnou metodou insertRangeImpl, potomkovia tak vkladaju naraz aj cez odkaz na List. </remarks>
+		template<typename ForwardIterator>
+		void insertRange(const int index, ForwardIterator first, ForwardIterator last);
 		
 		/// <summary> Odstrani prvy vyskyt prvku zo zoznamu. </summary>
 		/// <param name = "data"> Odstranovany prvok. </param>
@@ -67,11 +100,36 @@ namespace structures
 		/// <returns> Odstraneny prvok. </returns>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>  
 		virtual T removeAt(const int index) = 0;
+
+		/// <summary> Odstrani zo zoznamu prvky na indexoch z intervalu [from, to). </summary>
+		/// <param name = "from"> Index prveho odstranovaneho prvku. </param>
+		/// <param name = "to"> Index za poslednym odstranovanym prvkom. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak neplati 0 <= from <= to <= size. </exception>
+		/// <remarks> Implicitne odstranuje prvky po jednom, potomkovia to robia jednym prechodom. </remarks>
+		virtual void removeRange(const int from, const int to);
+
+		/// <summary> Odstrani zo zoznamu vsetky prvky, pre ktore predikat vrati true. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		/// <remarks> Vola virtualnu metodu removeIfImpl, potomkovia tak odstranuju jednym prechodom aj cez odkaz na List. </remarks>
+		template<typename Predicate>
+		size_t removeIf(Predicate predicate);
 		
 		/// <summary> Vrati index prveho vyskytu prvku v zozname. </summary>
 		/// <param name = "data"> Prvok, ktoreho index sa hlada. </param>
 		/// <returns> Index prveho vyskytu prvku v zozname, ak sa prvok v zozname nenachadza, vrati -1. </returns>
 		virtual int getIndexOf(const T& data) = 0;
+
+		/// <summary> Zisti, ci sa prvok nachadza v zozname. </summary>
+		/// <param name = "data"> Hladany prvok. </param>
+		/// <returns> true, ak sa prvok v zozname nachadza, false inak. </returns>
+		bool contains(const T& data);
+
+		/// <summary> Vrati pocet vyskytov prvku v zozname. </summary>
+		/// <param name = "data"> Hladany prvok. </param>
+		/// <returns> Pocet vyskytov prvku v zozname. </returns>
+		/// <remarks> Implicitne prechadza zoznam iteratorom. </remarks>
+		virtual size_t count(const T& data);
 		
 		/// <summary> Vymaze zoznam. </summary>
 		virtual void clear() = 0;
@@ -88,6 +146,18 @@ namespace structures
 	protected:
 		/// <summary> Konstruktor. </summary>
 		List();
+
+		/// <summary> Vlozi do zoznamu prvky pola tak, ze prvy z nich bude na danom indexe. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku, uz overeny. </param>
+		/// <param name = "items"> Vkladane prvky. </param>
+		/// <remarks> Vklada prvky po jednom. Potomkovia, ktore to vedia rychlejsie, metodu prekryvaju. </remarks>
+		virtual void insertRangeImpl(const int index, const Array<T>& items);
+
+		/// <summary> Odstrani zo zoznamu vsetky prvky, pre ktore predikat vrati true. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		/// <remarks> Odstranuje prvky po jednom. Potomkovia, ktore to vedia jednym prechodom, metodu prekryvaju. </remarks>
+		virtual size_t removeIfImpl(const std::function<bool(const T&)>& predicate);
 	};
 
 	template<typename T>
@@ -100,6 +170,64 @@ namespace structures
 		return *this;
 	}
 
+	template<typename T>
+	template<typename... Args>
+	inline void List<T>::emplace(Args&&... args)
+	{
+		this->add(T(std::forward<Args>(args)...));
+	}
+
+	template<typename T>
+	template<typename ForwardIterator>
+	inline void List<T>::insertRange(const int index, ForwardIterator first, ForwardIterator last)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size() + 1, "List<T>::insertRange: Invalid index.");
+		Array<T> items(static_cast<size_t>(std::distance(first, last)));
+		for (int i = 0; first != last; ++first, ++i)
+		{
+			items[i] = *first;
+		}
+		this->insertRangeImpl(index, items);
+	}
+
+	template<typename T>
+	inline void List<T>::removeRange(const int from, const int to)
+	{
+		DSRoutines::rangeCheckExcept(to, this->size() + 1, "List<T>::removeRange: Invalid index.");
+		DSRoutines::rangeCheckExcept(from, to + 1, "List<T>::removeRange: Invalid index.");
+		for (int i = from; i < to; i++)
+		{
+			this->removeAt(from);
+		}
+	}
+
+	template<typename T>
+	template<typename Predicate>
+	inline size_t List<T>::removeIf(Predicate predicate)
+	{
+		return this->removeIfImpl(std::function<bool(const T&)>(predicate));
+	}
+
+	template<typename T>
+	inline bool List<T>::contains(const T& data)
+	{
+		return this->getIndexOf(data) >= 0;
+	}
+
+	template<typename T>
+	inline size_t List<T>::count(const T& data)
+	{
+		size_t result = 0;
+		for (T item : *this)
+		{
+			if (item == data)
+			{
+				result++;
+			}
+		}
+		return result;
+	}
+
 	template<typename T>
 	inline List<T>::List() :
 		Structure(),
@@ -107,4 +235,33 @@ namespace structures
 	{
 	}
 
+	template<typename T>
+	inline void List<T>::insertRangeImpl(const int index, const Array<T>& items)
+	{
+		for (int i = 0; i < static_cast<int>(items.size()); i++)
+		{
+			this->insert(items[i], index + i);
+		}
+	}
+
+	template<typename T>
+	inline size_t List<T>::removeIfImpl(const std::function<bool(const T&)>& predicate)
+	{
+		size_t removed = 0;
+		int index = 0;
+		while (index < static_cast<int>(this->size()))
+		{
+			const T& data = (*this)[index];
+			if (predicate(data))
+			{
+				this->removeAt(index);
+				removed++;
+			}
+			else
+			{
+				index++;
+			}
+		}
+		return removed;
+	}
 }
\ No newline at end of file
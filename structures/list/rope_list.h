@@ -0,0 +1,864 @@
+#pragma once
+
+#include "list.h"
+#include "../structure_iterator.h"
+#include "../ds_routines.h"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace structures
+{
+
+	/// <summary> Zoznam implementovany lanom (rope) - vyvazenym stromom usekov. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v zozname. Musi mat implicitny konstruktor. </typepram>
+	/// <typeparam name = "K"> Kapacita jedneho useku. </typepram>
+	/// <remarks>
+	/// Kazdy vrchol stromu uchovava usek najviac K prvkov v poli a pocet prvkov vo svojom podstrome.
+	/// Poradie usekov urcuje inorder prechod, strom je vyvazeny nahodnymi prioritami ako Treap.
+	/// Pristup na index, vkladanie, odoberanie, spajanie aj delenie zoznamov su v ocakavanom case O(log n).
+	/// </remarks>
+	template<typename T, int K = 64>
+	class RopeList final : public List<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		RopeList();
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> RopeList, z ktoreho sa prevezmu vlastnosti. </param>
+		RopeList(const RopeList<T, K>& other);
+
+		/// <summary> Presuvaci konstruktor. </summary>
+		/// <param name = "other"> RopeList, z ktoreho sa prevezme obsah. </param>
+		RopeList(RopeList<T, K>&& other);
+
+		/// <summary> Destruktor. </summary>
+		~RopeList();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat zoznamu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov v zozname. </summary>
+		/// <returns> Pocet prvkov v zozname. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru zoznam obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zoznam obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		List<T>& operator=(const List<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		RopeList<T, K>& operator=(const RopeList<T, K>& other);
+
+		/// <summary> Presuvaci operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho sa prevezme obsah. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		RopeList<T, K>& operator=(RopeList<T, K>&& other);
+
+		/// <summary> Vrati adresou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Adresa prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T& operator[](const int index) override;
+
+		/// <summary> Vrati hodnotou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Hodnota prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		const T operator[](const int index) const override;
+
+		/// <summary> Prida prvok do zoznamu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(const T& data) override;
+
+		/// <summary> Prida prvok do zoznamu. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(T&& data) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		/// <remarks> Ak je ako index zadana hodnota poctu prvkov (teda prvy neplatny index), metoda insert sa sprava ako metoda add. </remarks>
+		void insert(const T& data, const int index) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		void insert(T&& data, const int index) override;
+
+		/// <summary> Odstrani prvy vyskyt prvku zo zoznamu. </summary>
+		/// <param name = "data"> Odstranovany prvok. </param>
+		/// <returns> true, ak sa podarilo prvok zo zoznamu odobrat, false inak. </returns>
+		bool tryRemove(const T& data) override;
+
+		/// <summary> Odstrani zo zoznamu prvok na danom indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Odstraneny prvok. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T removeAt(const int index) override;
+
+		/// <summary> Vrati index prveho vyskytu prvku v zozname. </summary>
+		/// <param name = "data"> Prvok, ktoreho index sa hlada. </param>
+		/// <returns> Index prveho vyskytu prvku v zozname, ak sa prvok v zozname nenachadza, vrati -1. </returns>
+		int getIndexOf(const T& data) override;
+
+		/// <summary> Vymaze zoznam. </summary>
+		void clear() override;
+
+		/// <summary> Presunie vsetky prvky zoznamu other na koniec tohto zoznamu. Zoznam other zostane prazdny. </summary>
+		/// <param name = "other"> Zoznam, ktoreho prvky sa presunu. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je other tento zoznam. </exception>
+		/// <remarks> Stromy sa iba spoja, v ocakavanom case O(log n). </remarks>
+		void concatenate(RopeList<T, K>& other);
+
+		/// <summary> Odpoji od zoznamu prvky od daneho indexu az po koniec a vrati ich ako novy zoznam. </summary>
+		/// <param name = "index"> Index prveho odpojeneho prvku. </param>
+		/// <returns> Zoznam odpojenych prvkov. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [0, size]. </exception>
+		/// <remarks> Strom sa iba rozdeli, kopiruje sa najviac jeden usek. Ocakavany cas O(log n). </remarks>
+		RopeList<T, K> split(const int index);
+
+		/// <summary> Vrati skutocny iterator na zaciatok struktury </summary>
+		/// <returns> Iterator na zaciatok struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getBeginIterator() const override;
+
+		/// <summary> Vrati skutocny iterator na koniec struktury </summary>
+		/// <returns> Iterator na koniec struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getEndIterator() const override;
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function);
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane konstantnu adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function) const;
+	private:
+		/// <summary> Vrchol stromu, uchovava jeden usek zoznamu. </summary>
+		struct RopeNode
+		{
+			/// <summary> Prvky useku, platnych je prvych count. </summary>
+			T items[K];
+			/// <summary> Pocet prvkov v useku. </summary>
+			int count;
+			/// <summary> Pocet prvkov v celom podstrome vratane tohto useku. </summary>
+			size_t weight;
+			/// <summary> Priorita vrcholu, otec ma vzdy priority aspon taku ako synovia. </summary>
+			unsigned int priority;
+			/// <summary> Lavy syn, obsahuje prvky pred usekom. </summary>
+			RopeNode* left;
+			/// <summary> Pravy syn, obsahuje prvky za usekom. </summary>
+			RopeNode* right;
+		};
+	private:
+		/// <summary> Koren stromu. </summary>
+		RopeNode* root_;
+		/// <summary> Generator nahodnej priority. </summary>
+		std::default_random_engine generator_;
+	private:
+		/// <summary> Vytvori novy prazdny vrchol s nahodnou prioritou. </summary>
+		/// <returns> Novy vrchol. </returns>
+		RopeNode* createNode();
+
+		/// <summary> Zrusi cely podstrom. </summary>
+		/// <param name = "node"> Koren ruseneho podstromu. </param>
+		static void destroySubtree(RopeNode* node);
+
+		/// <summary> Najde vrchol, v ktorom sa nachadza prvok na danom indexe. </summary>
+		/// <param name = "index"> Index prvku, musi patrit do zoznamu. </param>
+		/// <param name = "offset"> Vystupny parameter, pozicia prvku v useku najdeneho vrcholu. </param>
+		/// <returns> Vrchol, v ktorom sa prvok nachadza. </returns>
+		RopeNode* findNode(size_t index, int& offset) const;
+
+		/// <summary> Vlozi prvok na index v podstrome. </summary>
+		/// <param name = "node"> Koren podstromu, nesmie byt nullptr. </param>
+		/// <param name = "index"> Index v ramci podstromu, z intervalu [0, weight]. </param>
+		/// <param name = "data"> Vkladany prvok, do zoznamu sa presunie. </param>
+		/// <returns> Novy koren podstromu. </returns>
+		RopeNode* insertIntoSubtree(RopeNode* node, size_t index, T&& data);
+
+		/// <summary> Zaradi vrchol ako prvy (najlavejsi) do podstromu. </summary>
+		/// <param name = "node"> Koren podstromu. </param>
+		/// <param name = "first"> Zaradovany vrchol bez synov. </param>
+		/// <returns> Novy koren podstromu. </returns>
+		static RopeNode* insertFirst(RopeNode* node, RopeNode* first);
+
+		/// <summary> Odstrani prvok na indexe v podstrome. </summary>
+		/// <param name = "node"> Koren podstromu, nesmie byt nullptr. </param>
+		/// <param name = "index"> Index v ramci podstromu, musi do neho patrit. </param>
+		/// <param name = "data"> Vystupny parameter, odstraneny prvok. </param>
+		/// <returns> Novy koren podstromu. </returns>
+		RopeNode* removeFromSubtree(RopeNode* node, size_t index, T& data);
+
+		/// <summary> Rozdeli podstrom na prvych index prvkov a zvysok. </summary>
+		/// <param name = "node"> Koren deleneho podstromu. </param>
+		/// <param name = "index"> Pocet prvkov, ktore pripadnu lavej casti. </param>
+		/// <param name = "left"> Vystupny parameter, koren lavej casti. </param>
+		/// <param name = "right"> Vystupny parameter, koren pravej casti. </param>
+		void splitSubtree(RopeNode* node, size_t index, RopeNode*& left, RopeNode*& right);
+
+		/// <summary> Spoji dva podstromy, vsetky prvky laveho su pred prvkami praveho. </summary>
+		/// <param name = "left"> Koren laveho podstromu. </param>
+		/// <param name = "right"> Koren praveho podstromu. </param>
+		/// <returns> Koren spojeneho podstromu. </returns>
+		static RopeNode* merge(RopeNode* left, RopeNode* right);
+
+		/// <summary> Otoci vrchol doprava, jeho lavy syn sa stane korenom podstromu. </summary>
+		/// <param name = "node"> Otacany vrchol. </param>
+		/// <returns> Novy koren podstromu. </returns>
+		static RopeNode* rotateRight(RopeNode* node);
+
+		/// <summary> Otoci vrchol dolava, jeho pravy syn sa stane korenom podstromu. </summary>
+		/// <param name = "node"> Otacany vrchol. </param>
+		/// <returns> Novy koren podstromu. </returns>
+		static RopeNode* rotateLeft(RopeNode* node);
+
+		/// <summary> Prepocita pocet prvkov v podstrome vrcholu zo synov. </summary>
+		/// <param name = "node"> Vrchol. </param>
+		static void updateWeight(RopeNode* node);
+
+		/// <summary> Vrati pocet prvkov v podstrome. </summary>
+		/// <param name = "node"> Koren podstromu, alebo nullptr. </param>
+		/// <returns> Pocet prvkov v podstrome. </returns>
+		static size_t weightOf(const RopeNode* node);
+
+		/// <summary> Zavola funkciu postupne na kazdy usek podstromu v poradi zoznamu. </summary>
+		/// <param name = "node"> Koren podstromu, alebo nullptr. </param>
+		/// <param name = "function"> Volana funkcia, dostane vrchol. </param>
+		template<typename Node, typename Function>
+		static void forEachNode(Node* node, Function& function);
+	private:
+		/// <summary> Iterator pre RopeList. </summary>
+		/// <remarks> Prechadza useky postupne, na dalsi usek sa presuva zostupom od korena. </remarks>
+		class RopeListIterator : public Iterator<T>
+		{
+		public:
+			/// <summary> Konstruktor. </summary>
+			/// <param name = "list"> Prechadzany zoznam. </param>
+			/// <param name = "index"> Index prvku, na ktorom iterator zacina, size znamena koniec. </param>
+			RopeListIterator(const RopeList<T, K>* list, size_t index);
+
+			/// <summary> Destruktor. </summary>
+			~RopeListIterator();
+
+			/// <summary> Operator priradenia. Priradi do seba hodnotu druheho iteratora. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> Vrati seba po priradeni. </returns>
+			Iterator<T>& operator= (const Iterator<T>& other) override;
+
+			/// <summary> Porovna sa s druhym iteratorom na nerovnost. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> True, ak sa iteratory nerovnaju, false inak. </returns>
+			bool operator!=(const Iterator<T>& other) override;
+
+			/// <summary> Vrati data, na ktore aktualne ukazuje iterator. </summary>
+			/// <returns> Data, na ktore aktualne ukazuje iterator. </returns>
+			const T operator*() override;
+
+			/// <summary> Posunie iterator na dalsi prvok v strukture. </summary>
+			/// <returns> Iterator na dalsi prvok v strukture. </returns>
+			/// <remarks> Zvycajne vrati seba. Ak vrati iny iterator, povodny bude automaticky zruseny. </remarks>
+			Iterator<T>& operator++() override;
+		private:
+			/// <summary> Prechadzany zoznam. </summary>
+			const RopeList<T, K>* list_;
+			/// <summary> Index aktualneho prvku v zozname. </summary>
+			size_t index_;
+			/// <summary> Aktualny vrchol, na konci nullptr. </summary>
+			RopeNode* node_;
+			/// <summary> Pozicia aktualneho prvku v useku vrcholu. </summary>
+			int offset_;
+		};
+	};
+
+	template<typename T, int K>
+	inline RopeList<T, K>::RopeList() :
+		List<T>(),
+		root_(nullptr),
+		generator_()
+	{
+	}
+
+	template<typename T, int K>
+	inline RopeList<T, K>::RopeList(const RopeList<T, K>& other) :
+		RopeList()
+	{
+		*this = other;
+	}
+
+	template<typename T, int K>
+	inline RopeList<T, K>::RopeList(RopeList<T, K>&& other) :
+		List<T>(),
+		root_(std::exchange(other.root_, nullptr)),
+		generator_(other.generator_)
+	{
+	}
+
+	template<typename T, int K>
+	inline RopeList<T, K>::~RopeList()
+	{
+		this->clear();
+	}
+
+	template<typename T, int K>
+	inline Structure* RopeList<T, K>::clone() const
+	{
+		return new RopeList<T, K>(*this);
+	}
+
+	template<typename T, int K>
+	inline size_t RopeList<T, K>::size() const
+	{
+		return weightOf(root_);
+	}
+
+	template<typename T, int K>
+	inline MemoryUsage RopeList<T, K>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(RopeList<T, K>));
+		auto visit = [&result](const RopeNode* node)
+		{
+			result.addAllocations(sizeof(RopeNode), 1, (K - node->count) * sizeof(T));
+		};
+		forEachNode(static_cast<const RopeNode*>(root_), visit);
+		return result;
+	}
+
+	template<typename T, int K>
+	inline List<T>& RopeList<T, K>::operator=(const List<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const RopeList<T, K>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline RopeList<T, K>& RopeList<T, K>::operator=(const RopeList<T, K>& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+			other.forEach([this](const T& data) { this->add(data); });
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline RopeList<T, K>& RopeList<T, K>::operator=(RopeList<T, K>&& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+			root_ = std::exchange(other.root_, nullptr);
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline T& RopeList<T, K>::operator[](const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size(), "RopeList<T, K>::operator[]: Invalid index.");
+		int offset;
+		return this->findNode(index, offset)->items[offset];
+	}
+
+	template<typename T, int K>
+	inline const T RopeList<T, K>::operator[](const int index) const
+	{
+		DSRoutines::rangeCheckExcept(index, this->size(), "RopeList<T, K>::operator[]: Invalid index.");
+		int offset;
+		return this->findNode(index, offset)->items[offset];
+	}
+
+	template<typename T, int K>
+	inline void RopeList<T, K>::add(const T& data)
+	{
+		this->insert(T(data), static_cast<int>(this->size()));
+	}
+
+	template<typename T, int K>
+	inline void RopeList<T, K>::add(T&& data)
+	{
+		this->insert(std::move(data), static_cast<int>(this->size()));
+	}
+
+	template<typename T, int K>
+	inline void RopeList<T, K>::insert(const T& data, const int index)
+	{
+		this->insert(T(data), index);
+	}
+
+	template<typename T, int K>
+	inline void RopeList<T, K>::insert(T&& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size() + 1, "RopeList<T, K>::insert: Invalid index.");
+		if (root_ == nullptr)
+		{
+			root_ = this->createNode();
+		}
+		root_ = this->insertIntoSubtree(root_, index, std::move(data));
+	}
+
+	template<typename T, int K>
+	inline bool RopeList<T, K>::tryRemove(const T& data)
+	{
+		int index = this->getIndexOf(data);
+		if (index >= 0)
+		{
+			this->removeAt(index);
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template<typename T, int K>
+	inline T RopeList<T, K>::removeAt(const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size(), "RopeList<T, K>::removeAt: Invalid index.");
+		T data = T();
+		root_ = this->removeFromSubtree(root_, index, data);
+		return data;
+	}
+
+	template<typename T, int K>
+	inline int RopeList<T, K>::getIndexOf(const T& data)
+	{
+		RopeNode* node = root_;
+		std::vector<RopeNode*> path;
+		int index = 0;
+		while (node != nullptr || !path.empty())
+		{
+			while (node != nullptr)
+			{
+				path.push_back(node);
+				node = node->left;
+			}
+			node = path.back();
+			path.pop_back();
+			for (int i = 0; i < node->count; i++)
+			{
+				if (node->items[i] == data)
+				{
+					return index + i;
+				}
+			}
+			index += node->count;
+			node = node->right;
+		}
+		return -1;
+	}
+
+	template<typename T, int K>
+	inline void RopeList<T, K>::clear()
+	{
+		destroySubtree(root_);
+		root_ = nullptr;
+	}
+
+	template<typename T, int K>
+	inline void RopeList<T, K>::concatenate(RopeList<T, K>& other)
+	{
+		if (this == &other)
+		{
+			throw std::logic_error("RopeList<T, K>::concatenate: Cannot concatenate list with itself.");
+		}
+		root_ = merge(root_, std::exchange(other.root_, nullptr));
+	}
+
+	template<typename T, int K>
+	inline RopeList<T, K> RopeList<T, K>::split(const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size() + 1, "RopeList<T, K>::split: Invalid index.");
+		RopeList<T, K> result;
+		RopeNode* left;
+		RopeNode* right;
+		this->splitSubtree(root_, index, left, right);
+		root_ = left;
+		result.root_ = right;
+		return result;
+	}
+
+	template<typename T, int K>
+	inline Iterator<T>* RopeList<T, K>::getBeginIterator() const
+	{
+		return new RopeListIterator(this, 0);
+	}
+
+	template<typename T, int K>
+	inline Iterator<T>* RopeList<T, K>::getEndIterator() const
+	{
+		return new RopeListIterator(this, this->size());
+	}
+
+	template<typename T, int K>
+	template<typename Function>
+	inline void RopeList<T, K>::forEach(Function function)
+	{
+		auto visit = [&function](RopeNode* node)
+		{
+			for (int i = 0; i < node->count; i++)
+			{
+				function(node->items[i]);
+			}
+		};
+		forEachNode(root_, visit);
+	}
+
+	template<typename T, int K>
+	template<typename Function>
+	inline void RopeList<T, K>::forEach(Function function) const
+	{
+		auto visit = [&function](const RopeNode* node)
+		{
+			for (int i = 0; i < node->count; i++)
+			{
+				function(node->items[i]);
+			}
+		};
+		forEachNode(static_cast<const RopeNode*>(root_), visit);
+	}
+
+	template<typename T, int K>
+	inline typename RopeList<T, K>::RopeNode* RopeList<T, K>::createNode()
+	{
+		RopeNode* node = new RopeNode();
+		node->count = 0;
+		node->weight = 0;
+		node->priority = static_cast<unsigned int>(generator_());
+		node->left = nullptr;
+		node->right = nullptr;
+		return node;
+	}
+
+	template<typename T, int K>
+	inline void RopeList<T, K>::destroySubtree(RopeNode* node)
+	{
+		if (node != nullptr)
+		{
+			destroySubtree(node->left);
+			destroySubtree(node->right);
+			delete node;
+		}
+	}
+
+	template<typename T, int K>
+	inline typename RopeList<T, K>::RopeNode* RopeList<T, K>::findNode(size_t index, int& offset) const
+	{
+		RopeNode* node = root_;
+		while (true)
+		{
+			size_t leftWeight = weightOf(node->left);
+			if (index < leftWeight)
+			{
+				node = node->left;
+			}
+			else if (index < leftWeight + node->count)
+			{
+				offset = static_cast<int>(index - leftWeight);
+				return node;
+			}
+			else
+			{
+				index -= leftWeight + node->count;
+				node = node->right;
+			}
+		}
+	}
+
+	template<typename T, int K>
+	inline typename RopeList<T, K>::RopeNode* RopeList<T, K>::insertIntoSubtree(RopeNode* node, size_t index, T&& data)
+	{
+		size_t leftWeight = weightOf(node->left);
+		if (index < leftWeight)
+		{
+			node->left = this->insertIntoSubtree(node->left, index, std::move(data));
+			if (node->left->priority > node->priority)
+			{
+				node = rotateRight(node);
+			}
+		}
+		else if (index <= leftWeight + node->count)
+		{
+			RopeNode* target = node;
+			RopeNode* tail = nullptr;
+			int offset = static_cast<int>(index - leftWeight);
+			if (node->count == K)
+			{
+				tail = this->createNode();
+				for (int i = K / 2; i < K; i++)
+				{
+					tail->items[tail->count++] = std::move(node->items[i]);
+					node->items[i] = T();
+				}
+				node->count = K / 2;
+				if (offset > K / 2)
+				{
+					target = tail;
+					offset -= K / 2;
+				}
+			}
+			for (int i = target->count; i > offset; i--)
+			{
+				target->items[i] = std::move(target->items[i - 1]);
+			}
+			target->items[offset] = std::move(data);
+			target->count++;
+			if (tail != nullptr)
+			{
+				tail->weight = tail->count;
+				node->right = insertFirst(node->right, tail);
+				if (node->right->priority > node->priority)
+				{
+					node = rotateLeft(node);
+				}
+			}
+		}
+		else
+		{
+			node->right = this->insertIntoSubtree(node->right, index - leftWeight - node->count, std::move(data));
+			if (node->right->priority > node->priority)
+			{
+				node = rotateLeft(node);
+			}
+		}
+		updateWeight(node);
+		return node;
+	}
+
+	template<typename T, int K>
+	inline typename RopeList<T, K>::RopeNode* RopeList<T, K>::insertFirst(RopeNode* node, RopeNode* first)
+	{
+		if (node == nullptr)
+		{
+			return first;
+		}
+		node->left = insertFirst(node->left, first);
+		if (node->left->priority > node->priority)
+		{
+			node = rotateRight(node);
+		}
+		updateWeight(node);
+		return node;
+	}
+
+	template<typename T, int K>
+	inline typename RopeList<T, K>::RopeNode* RopeList<T, K>::removeFromSubtree(RopeNode* node, size_t index, T& data)
+	{
+		size_t leftWeight = weightOf(node->left);
+		if (index < leftWeight)
+		{
+			node->left = this->removeFromSubtree(node->left, index, data);
+		}
+		else if (index < leftWeight + node->count)
+		{
+			int offset = static_cast<int>(index - leftWeight);
+			data = std::move(node->items[offset]);
+			node->count--;
+			for (int i = offset; i < node->count; i++)
+			{
+				node->items[i] = std::move(node->items[i + 1]);
+			}
+			node->items[node->count] = T();
+			if (node->count == 0)
+			{
+				RopeNode* result = merge(node->left, node->right);
+				delete node;
+				return result;
+			}
+		}
+		else
+		{
+			node->right = this->removeFromSubtree(node->right, index - leftWeight - node->count, data);
+		}
+		updateWeight(node);
+		return node;
+	}
+
+	template<typename T, int K>
+	inline void RopeList<T, K>::splitSubtree(RopeNode* node, size_t index, RopeNode*& left, RopeNode*& right)
+	{
+		if (node == nullptr)
+		{
+			left = nullptr;
+			right = nullptr;
+			return;
+		}
+		size_t leftWeight = weightOf(node->left);
+		if (index <= leftWeight)
+		{
+			this->splitSubtree(node->left, index, left, node->left);
+			updateWeight(node);
+			right = node;
+		}
+		else if (index >= leftWeight + node->count)
+		{
+			this->splitSubtree(node->right, index - leftWeight - node->count, node->right, right);
+			updateWeight(node);
+			left = node;
+		}
+		else
+		{
+			int offset = static_cast<int>(index - leftWeight);
+			RopeNode* tail = this->createNode();
+			for (int i = offset; i < node->count; i++)
+			{
+				tail->items[tail->count++] = std::move(node->items[i]);
+				node->items[i] = T();
+			}
+			node->count = offset;
+			tail->weight = tail->count;
+			right = merge(tail, node->right);
+			node->right = nullptr;
+			updateWeight(node);
+			left = node;
+		}
+	}
+
+	template<typename T, int K>
+	inline typename RopeList<T, K>::RopeNode* RopeList<T, K>::merge(RopeNode* left, RopeNode* right)
+	{
+		if (left == nullptr)
+		{
+			return right;
+		}
+		if (right == nullptr)
+		{
+			return left;
+		}
+		if (left->priority > right->priority)
+		{
+			left->right = merge(left->right, right);
+			updateWeight(left);
+			return left;
+		}
+		else
+		{
+			right->left = merge(left, right->left);
+			updateWeight(right);
+			return right;
+		}
+	}
+
+	template<typename T, int K>
+	inline typename RopeList<T, K>::RopeNode* RopeList<T, K>::rotateRight(RopeNode* node)
+	{
+		RopeNode* son = node->left;
+		node->left = son->right;
+		son->right = node;
+		updateWeight(node);
+		updateWeight(son);
+		return son;
+	}
+
+	template<typename T, int K>
+	inline typename RopeList<T, K>::RopeNode* RopeList<T, K>::rotateLeft(RopeNode* node)
+	{
+		RopeNode* son = node->right;
+		node->right = son->left;
+		son->left = node;
+		updateWeight(node);
+		updateWeight(son);
+		return son;
+	}
+
+	template<typename T, int K>
+	inline void RopeList<T, K>::updateWeight(RopeNode* node)
+	{
+		node->weight = weightOf(node->left) + node->count + weightOf(node->right);
+	}
+
+	template<typename T, int K>
+	inline size_t RopeList<T, K>::weightOf(const RopeNode* node)
+	{
+		return node != nullptr ? node->weight : 0;
+	}
+
+	template<typename T, int K>
+	template<typename Node, typename Function>
+	inline void RopeList<T, K>::forEachNode(Node* node, Function& function)
+	{
+		if (node != nullptr)
+		{
+			forEachNode(node->left, function);
+			function(node);
+			forEachNode(node->right, function);
+		}
+	}
+
+	template<typename T, int K>
+	inline RopeList<T, K>::RopeListIterator::RopeListIterator(const RopeList<T, K>* list, size_t index) :
+		list_(list),
+		index_(index),
+		node_(nullptr),
+		offset_(0)
+	{
+		if (index_ < list_->size())
+		{
+			node_ = list_->findNode(index_, offset_);
+		}
+	}
+
+	template<typename T, int K>
+	inline RopeList<T, K>::RopeListIterator::~RopeListIterator()
+	{
+		list_ = nullptr;
+		node_ = nullptr;
+	}
+
+	template<typename T, int K>
+	inline Iterator<T>& RopeList<T, K>::RopeListIterator::operator=(const Iterator<T>& other)
+	{
+		if (this != &other)
+		{
+			const RopeListIterator& otherIterator = dynamic_cast<const RopeList<T, K>::RopeListIterator&>(other);
+			list_ = otherIterator.list_;
+			index_ = otherIterator.index_;
+			node_ = otherIterator.node_;
+			offset_ = otherIterator.offset_;
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline bool RopeList<T, K>::RopeListIterator::operator!=(const Iterator<T>& other)
+	{
+		return index_ != dynamic_cast<const RopeList<T, K>::RopeListIterator&>(other).index_;
+	}
+
+	template<typename T, int K>
+	inline const T RopeList<T, K>::RopeListIterator::operator*()
+	{
+		return node_->items[offset_];
+	}
+
+	template<typename T, int K>
+	inline Iterator<T>& RopeList<T, K>::RopeListIterator::operator++()
+	{
+		index_++;
+		offset_++;
+		if (offset_ == node_->count)
+		{
+			node_ = index_ < list_->size() ? list_->findNode(index_, offset_) : nullptr;
+		}
+		return *this;
+	}
+}
@@ -0,0 +1,599 @@
+#pragma once
+
+#include "list.h"
+#include "../structure_iterator.h"
+#include "../array/array.h"
+#include "../search_routines.h"
+#include <algorithm>
+
+namespace structures
+{
+
+	/// <summary> Zoznam implementovany polom s vnorenou kapacitou. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v zozname. </typepram>
+	/// <typeparam name = "N"> Pocet prvkov, ktore sa ulozia priamo v objekte zoznamu. </typepram>
+	/// <remarks>
+	/// Kym pocet prvkov nepresiahne N, zoznam nealokuje ziadnu pamat. Az potom prvky presunie do pola na halde,
+	/// ktore dalej rastie ako v ArrayList. Hodi sa pre male zoznamy (susedia vrcholu, synovia vrchola stromu).
+	/// </remarks>
+	template<typename T, size_t N = 8>
+	class SmallArrayList final : public List<T>
+	{
+		static_assert(N > 0, "SmallArrayList<T, N>: N must be positive.");
+	public:
+		/// <summary> Konstruktor. </summary>
+		SmallArrayList();
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> SmallArrayList, z ktoreho sa prevezmu vlastnosti. </param>
+		SmallArrayList(const SmallArrayList<T, N>& other);
+
+		/// <summary> Presuvaci konstruktor. </summary>
+		/// <param name = "other"> SmallArrayList, z ktoreho sa prevezme obsah. </param>
+		/// <remarks> Pole na halde sa prevezme, prvky ulozene v objekte sa musia presunut po jednom. </remarks>
+		SmallArrayList(SmallArrayList<T, N>&& other);
+
+		/// <summary> Destruktor. </summary>
+		~SmallArrayList();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat zoznamu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov v zozname. </summary>
+		/// <returns> Pocet prvkov v zozname. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati pocet prvkov, ktore sa do zoznamu zmestia bez dalsej alokacie. </summary>
+		/// <returns> Kapacita zoznamu. </returns>
+		size_t capacity() const;
+
+		/// <summary> Zisti, ci su prvky ulozene priamo v objekte zoznamu. </summary>
+		/// <returns> true, ak zoznam este nealokoval pole na halde, false inak. </returns>
+		bool isInline() const;
+
+		/// <summary> Vrati udaje o pamati, ktoru zoznam obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zoznam obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		List<T>& operator=(const List<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		SmallArrayList<T, N>& operator=(const SmallArrayList<T, N>& other);
+
+		/// <summary> Presuvaci operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho sa prevezme obsah. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		SmallArrayList<T, N>& operator=(SmallArrayList<T, N>&& other);
+
+		/// <summary> Vrati adresou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Adresa prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T& operator[](const int index) override;
+
+		/// <summary> Vrati hodnotou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Hodnota prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		const T operator[](const int index) const override;
+
+		/// <summary> Prida prvok do zoznamu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(const T& data) override;
+
+		/// <summary> Prida prvok do zoznamu. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(T&& data) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		/// <remarks> Ak je ako index zadana hodnota poctu prvkov (teda prvy neplatny index), metoda insert sa sprava ako metoda add. </remarks>
+		void insert(const T& data, const int index) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		void insert(T&& data, const int index) override;
+
+		/// <summary> Vlozi do zoznamu prvky z rozsahu [first, last) tak, ze prvy z nich bude na danom indexe. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku. </param>
+		/// <param name = "first"> Iterator na prvy vkladany prvok. </param>
+		/// <param name = "last"> Iterator za posledny vkladany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do intervalu [0, size]. </exception>
+		/// <remarks> Prvky prida na koniec a jednym otocenim ich presunie na miesto. </remarks>
+		template<typename InputIterator>
+		void insertRange(const int index, InputIterator first, InputIterator last);
+
+		/// <summary> Odstrani prvy vyskyt prvku zo zoznamu. </summary>
+		/// <param name = "data"> Odstranovany prvok. </param>
+		/// <returns> true, ak sa podarilo prvok zo zoznamu odobrat, false inak. </returns>
+		bool tryRemove(const T& data) override;
+
+		/// <summary> Odstrani zo zoznamu prvok na danom indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Odstraneny prvok. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T removeAt(const int index) override;
+
+		/// <summary> Odstrani zo zoznamu prvky na indexoch z intervalu [from, to). </summary>
+		/// <param name = "from"> Index prveho odstranovaneho prvku. </param>
+		/// <param name = "to"> Index za poslednym odstranovanym prvkom. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak neplati 0 <= from <= to <= size. </exception>
+		void removeRange(const int from, const int to) override;
+
+		/// <summary> Odstrani zo zoznamu vsetky prvky, pre ktore predikat vrati true. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		template<typename Predicate>
+		size_t removeIf(Predicate predicate);
+
+		/// <summary> Vrati index prveho vyskytu prvku v zozname. </summary>
+		/// <param name = "data"> Prvok, ktoreho index sa hlada. </param>
+		/// <returns> Index prveho vyskytu prvku v zozname, ak sa prvok v zozname nenachadza, vrati -1. </returns>
+		int getIndexOf(const T& data) override;
+
+		/// <summary> Vrati pocet vyskytov prvku v zozname. </summary>
+		/// <param name = "data"> Hladany prvok. </param>
+		/// <returns> Pocet vyskytov prvku v zozname. </returns>
+		size_t count(const T& data) override;
+
+		/// <summary> Vymaze zoznam. </summary>
+		/// <remarks> Pole na halde, ak uz bolo alokovane, si ponecha. </remarks>
+		void clear() override;
+
+		/// <summary> Vrati skutocny iterator na zaciatok struktury </summary>
+		/// <returns> Iterator na zaciatok struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getBeginIterator() const override;
+
+		/// <summary> Vrati skutocny iterator na koniec struktury </summary>
+		/// <returns> Iterator na koniec struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getEndIterator() const override;
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function);
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane konstantnu adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function) const;
+	protected:
+		/// <summary> Vlozi do zoznamu prvky pola naraz, pouzije insertRange. </summary>
+		/// <param name = "index"> Index prveho vkladaneho prvku, uz overeny. </param>
+		/// <param name = "items"> Vkladane prvky. </param>
+		void insertRangeImpl(const int index, const Array<T>& items) override;
+
+		/// <summary> Odstrani prvky jednym prechodom, pouzije removeIf. </summary>
+		/// <param name = "predicate"> Predikat, dostane konstantnu adresu prvku. </param>
+		/// <returns> Pocet odstranenych prvkov. </returns>
+		size_t removeIfImpl(const std::function<bool(const T&)>& predicate) override;
+	private:
+		/// <summary> Prvky ulozene priamo v objekte zoznamu. </summary>
+		T inline_[N];
+		/// <summary> Pole s datami na halde, nullptr, kym sa prvky zmestia do inline_. </summary>
+		Array<T>* heap_;
+		/// <summary> Aktualne pouzivana pamat, bud inline_, alebo data pola heap_. </summary>
+		T* items_;
+		/// <summary> Kapacita aktualne pouzivanej pamate. </summary>
+		size_t capacity_;
+		/// <summary> Pocet prvkov v zozname. </summary>
+		size_t size_;
+	private:
+		/// <summary> Rozsiri kapacitu zoznamu. Pri prvom rozsireni presunie prvky z objektu na haldu. </summary>
+		void enlarge();
+
+		/// <summary> Iterator pre SmallArrayList. </summary>
+		class SmallArrayListIterator : public Iterator<T>
+		{
+		public:
+			/// <summary> Konstruktor. </summary>
+			/// <param name = "list"> Zoznam, cez ktory iteruje. </param>
+			/// <param name = "position"> Pozicia, na ktorej zacina. </param>
+			SmallArrayListIterator(const SmallArrayList<T, N>* list, int position);
+
+			/// <summary> Destruktor. </summary>
+			~SmallArrayListIterator();
+
+			/// <summary> Operator priradenia. Priradi do seba hodnotu druheho iteratora. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> Vrati seba po priradeni. </returns>
+			Iterator<T>& operator= (const Iterator<T>& other) override;
+
+			/// <summary> Porovna sa s druhym iteratorom na nerovnost. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> True, ak sa iteratory nerovnaju, false inak. </returns>
+			bool operator!=(const Iterator<T>& other) override;
+
+			/// <summary> Vrati data, na ktore aktualne ukazuje iterator. </summary>
+			/// <returns> Data, na ktore aktualne ukazuje iterator. </returns>
+			const T operator*() override;
+
+			/// <summary> Posunie iterator na dalsi prvok v strukture. </summary>
+			/// <returns> Iterator na dalsi prvok v strukture. </returns>
+			/// <remarks> Zvycajne vrati seba. Ak vrati iny iterator, povodny bude automaticky zruseny. </remarks>
+			Iterator<T>& operator++() override;
+		private:
+			/// <summary> Zoznam, cez ktory iteruje. </summary>
+			const SmallArrayList<T, N>* list_;
+			/// <summary> Aktualna pozicia v zozname. </summary>
+			int position_;
+		};
+	};
+
+	template<typename T, size_t N>
+	inline SmallArrayList<T, N>::SmallArrayList() :
+		List<T>(),
+		inline_(),
+		heap_(nullptr),
+		items_(inline_),
+		capacity_(N),
+		size_(0)
+	{
+	}
+
+	template<typename T, size_t N>
+	inline SmallArrayList<T, N>::SmallArrayList(const SmallArrayList<T, N>& other) :
+		SmallArrayList<T, N>()
+	{
+		*this = other;
+	}
+
+	template<typename T, size_t N>
+	inline SmallArrayList<T, N>::SmallArrayList(SmallArrayList<T, N>&& other) :
+		SmallArrayList<T, N>()
+	{
+		*this = std::move(other);
+	}
+
+	template<typename T, size_t N>
+	inline SmallArrayList<T, N>::~SmallArrayList()
+	{
+		delete this->heap_;
+		this->heap_ = nullptr;
+		this->items_ = nullptr;
+		this->capacity_ = 0;
+		this->size_ = 0;
+	}
+
+	template<typename T, size_t N>
+	inline Structure* SmallArrayList<T, N>::clone() const
+	{
+		return new SmallArrayList<T, N>(*this);
+	}
+
+	template<typename T, size_t N>
+	inline size_t SmallArrayList<T, N>::size() const
+	{
+		return size_;
+	}
+
+	template<typename T, size_t N>
+	inline size_t SmallArrayList<T, N>::capacity() const
+	{
+		return capacity_;
+	}
+
+	template<typename T, size_t N>
+	inline bool SmallArrayList<T, N>::isInline() const
+	{
+		return heap_ == nullptr;
+	}
+
+	template<typename T, size_t N>
+	inline MemoryUsage SmallArrayList<T, N>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(SmallArrayList<T, N>));
+		if (this->heap_ != nullptr)
+		{
+			result.addAllocation(this->heap_->memoryUsage());
+			// Vnorene pole sa po presune na haldu uz nepouziva.
+			result.bytesWasted += sizeof(this->inline_);
+		}
+		result.bytesWasted += (this->capacity_ - this->size_) * sizeof(T);
+		return result;
+	}
+
+	template<typename T, size_t N>
+	inline List<T>& SmallArrayList<T, N>::operator=(const List<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const SmallArrayList<T, N>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T, size_t N>
+	inline SmallArrayList<T, N>& SmallArrayList<T, N>::operator=(const SmallArrayList<T, N>& other)
+	{
+		if (this != &other)
+		{
+			if (this->capacity_ < other.size_)
+			{
+				delete this->heap_;
+				this->heap_ = new Array<T>(other.size_);
+				this->items_ = this->heap_->data();
+				this->capacity_ = other.size_;
+			}
+			std::copy(other.items_, other.items_ + other.size_, this->items_);
+			this->size_ = other.size_;
+		}
+		return *this;
+	}
+
+	template<typename T, size_t N>
+	inline SmallArrayList<T, N>& SmallArrayList<T, N>::operator=(SmallArrayList<T, N>&& other)
+	{
+		if (this != &other)
+		{
+			if (other.heap_ != nullptr)
+			{
+				delete this->heap_;
+				this->heap_ = std::exchange(other.heap_, nullptr);
+				this->items_ = this->heap_->data();
+				this->capacity_ = this->heap_->size();
+				other.items_ = other.inline_;
+				other.capacity_ = N;
+			}
+			else
+			{
+				std::move(other.items_, other.items_ + other.size_, this->items_);
+			}
+			this->size_ = std::exchange(other.size_, 0);
+		}
+		return *this;
+	}
+
+	template<typename T, size_t N>
+	inline T& SmallArrayList<T, N>::operator[](const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_, "SmallArrayList<T, N>::operator[]: Invalid index.");
+		return this->items_[index];
+	}
+
+	template<typename T, size_t N>
+	inline const T SmallArrayList<T, N>::operator[](const int index) const
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_, "SmallArrayList<T, N>::operator[]: Invalid index.");
+		return this->items_[index];
+	}
+
+	template<typename T, size_t N>
+	inline void SmallArrayList<T, N>::add(const T& data)
+	{
+		// Kopia vznikne skor, ako sa pri rozsireni presunu prvky, data mozu byt prvkom tohto zoznamu.
+		this->add(T(data));
+	}
+
+	template<typename T, size_t N>
+	inline void SmallArrayList<T, N>::add(T&& data)
+	{
+		if (this->capacity_ <= this->size_)
+		{
+			this->enlarge();
+		}
+		this->items_[this->size_] = std::move(data);
+		this->size_++;
+	}
+
+	template<typename T, size_t N>
+	inline void SmallArrayList<T, N>::insert(const T& data, const int index)
+	{
+		this->insert(T(data), index);
+	}
+
+	template<typename T, size_t N>
+	inline void SmallArrayList<T, N>::insert(T&& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_ + 1, "SmallArrayList<T, N>::insert: Invalid index.");
+		if (this->capacity_ <= this->size_)
+		{
+			this->enlarge();
+		}
+		std::move_backward(this->items_ + index, this->items_ + this->size_, this->items_ + this->size_ + 1);
+		this->items_[index] = std::move(data);
+		this->size_++;
+	}
+
+	template<typename T, size_t N>
+	template<typename InputIterator>
+	inline void SmallArrayList<T, N>::insertRange(const int index, InputIterator first, InputIterator last)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_ + 1, "SmallArrayList<T, N>::insertRange: Invalid index.");
+		const size_t oldSize = this->size_;
+		for (; first != last; ++first)
+		{
+			this->add(*first);
+		}
+		std::rotate(this->items_ + index, this->items_ + oldSize, this->items_ + this->size_);
+	}
+
+	template<typename T, size_t N>
+	inline bool SmallArrayList<T, N>::tryRemove(const T& data)
+	{
+		int index = this->getIndexOf(data);
+		if (index >= 0)
+		{
+			this->removeAt(index);
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template<typename T, size_t N>
+	inline T SmallArrayList<T, N>::removeAt(const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_, "SmallArrayList<T, N>::removeAt: Invalid index.");
+		T tmp = std::move(this->items_[index]);
+		std::move(this->items_ + index + 1, this->items_ + this->size_, this->items_ + index);
+		this->size_--;
+		return tmp;
+	}
+
+	template<typename T, size_t N>
+	inline void SmallArrayList<T, N>::removeRange(const int from, const int to)
+	{
+		DSRoutines::rangeCheckExcept(to, this->size_ + 1, "SmallArrayList<T, N>::removeRange: Invalid index.");
+		DSRoutines::rangeCheckExcept(from, to + 1, "SmallArrayList<T, N>::removeRange: Invalid index.");
+		std::move(this->items_ + to, this->items_ + this->size_, this->items_ + from);
+		this->size_ -= to - from;
+	}
+
+	template<typename T, size_t N>
+	template<typename Predicate>
+	inline size_t SmallArrayList<T, N>::removeIf(Predicate predicate)
+	{
+		size_t kept = 0;
+		for (size_t i = 0; i < this->size_; i++)
+		{
+			if (!predicate(static_cast<const T&>(this->items_[i])))
+			{
+				if (kept != i)
+				{
+					this->items_[kept] = std::move(this->items_[i]);
+				}
+				kept++;
+			}
+		}
+		size_t removed = this->size_ - kept;
+		this->size_ = kept;
+		return removed;
+	}
+
+	template<typename T, size_t N>
+	inline void SmallArrayList<T, N>::insertRangeImpl(const int index, const Array<T>& items)
+	{
+		this->insertRange(index, items.data(), items.data() + items.size());
+	}
+
+	template<typename T, size_t N>
+	inline size_t SmallArrayList<T, N>::removeIfImpl(const std::function<bool(const T&)>& predicate)
+	{
+		return this->removeIf(predicate);
+	}
+
+	template<typename T, size_t N>
+	inline int SmallArrayList<T, N>::getIndexOf(const T& data)
+	{
+		return SearchRoutines::indexOf(this->items_, static_cast<int>(this->size_), data);
+	}
+
+	template<typename T, size_t N>
+	inline size_t SmallArrayList<T, N>::count(const T& data)
+	{
+		return static_cast<size_t>(SearchRoutines::count(this->items_, static_cast<int>(this->size_), data));
+	}
+
+	template<typename T, size_t N>
+	inline void SmallArrayList<T, N>::clear()
+	{
+		this->size_ = 0;
+	}
+
+	template<typename T, size_t N>
+	inline Iterator<T>* SmallArrayList<T, N>::getBeginIterator() const
+	{
+		return new SmallArrayListIterator(this, 0);
+	}
+
+	template<typename T, size_t N>
+	inline Iterator<T>* SmallArrayList<T, N>::getEndIterator() const
+	{
+		return new SmallArrayListIterator(this, static_cast<int>(this->size_));
+	}
+
+	template<typename T, size_t N>
+	template<typename Function>
+	inline void SmallArrayList<T, N>::forEach(Function function)
+	{
+		T* end = this->items_ + this->size_;
+		for (T* item = this->items_; item != end; ++item)
+		{
+			function(*item);
+		}
+	}
+
+	template<typename T, size_t N>
+	template<typename Function>
+	inline void SmallArrayList<T, N>::forEach(Function function) const
+	{
+		const T* end = this->items_ + this->size_;
+		for (const T* item = this->items_; item != end; ++item)
+		{
+			function(*item);
+		}
+	}
+
+	template<typename T, size_t N>
+	inline void SmallArrayList<T, N>::enlarge()
+	{
+		Array<T>* tmp = new Array<T>(2 * this->capacity_);
+		std::move(this->items_, this->items_ + this->size_, tmp->data());
+		delete this->heap_;
+		this->heap_ = tmp;
+		this->items_ = tmp->data();
+		this->capacity_ = tmp->size();
+	}
+
+	template<typename T, size_t N>
+	inline SmallArrayList<T, N>::SmallArrayListIterator::SmallArrayListIterator(const SmallArrayList<T, N>* list, int position) :
+		list_(list),
+		position_(position)
+	{
+	}
+
+	template<typename T, size_t N>
+	inline SmallArrayList<T, N>::SmallArrayListIterator::~SmallArrayListIterator()
+	{
+		this->position_ = 0;
+		this->list_ = nullptr;
+	}
+
+	template<typename T, size_t N>
+	inline Iterator<T>& SmallArrayList<T, N>::SmallArrayListIterator::operator=(const Iterator<T>& other)
+	{
+		if (this != &other)
+		{
+			this->position_ = dynamic_cast<const SmallArrayListIterator&>(other).position_;
+			this->list_ = dynamic_cast<const SmallArrayListIterator&>(other).list_;
+		}
+		return *this;
+	}
+
+	template<typename T, size_t N>
+	inline bool SmallArrayList<T, N>::SmallArrayListIterator::operator!=(const Iterator<T>& other)
+	{
+		return
+			this->position_ != dynamic_cast<const SmallArrayListIterator&>(other).position_ ||
+			this->list_ != dynamic_cast<const SmallArrayListIterator&>(other).list_;
+	}
+
+	template<typename T, size_t N>
+	inline const T SmallArrayList<T, N>::SmallArrayListIterator::operator*()
+	{
+		return this->list_->items_[this->position_];
+	}
+
+	template<typename T, size_t N>
+	inline Iterator<T>& SmallArrayList<T, N>::SmallArrayListIterator::operator++()
+	{
+		++this->position_;
+		return *this;
+	}
+
+}
@@ -0,0 +1,626 @@
+#pragma once
+
+#include "list.h"
+#include "../structure_iterator.h"
+#include "../array/array.h"
+#include "../ds_routines.h"
+
+namespace structures
+{
+
+	/// <summary> Zoznam implementovany stupnovitym vektorom (tiered vector). </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v zozname. </typepram>
+	/// <remarks>
+	/// Prvky su ulozene v stupnoch, kruhovych poliach s kapacitou L (mocnina 2, priblizne odmocnina z poctu prvkov).
+	/// Vsetky stupne okrem posledneho su plne, preto sa prvok na indexe najde v case O(1).
+	/// Pri vkladani a odstranovani sa posuvaju prvky iba v jednom stupni, z ostatnych sa presunie po jednom prvku
+	/// medzi koncom a zaciatkom susednych stupnov. Obe operacie tak trvaju O(odmocnina z n).
+	/// Vsetky stupne lezia za sebou v jednom poli.
+	/// </remarks>
+	template<typename T>
+	class TieredVectorList final : public List<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		TieredVectorList();
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> TieredVectorList, z ktoreho sa prevezmu vlastnosti. </param>
+		TieredVectorList(const TieredVectorList<T>& other);
+
+		/// <summary> Presuvaci konstruktor. </summary>
+		/// <param name = "other"> TieredVectorList, z ktoreho sa prevezme obsah. </param>
+		TieredVectorList(TieredVectorList<T>&& other);
+
+		/// <summary> Destruktor. </summary>
+		~TieredVectorList();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat zoznamu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov v zozname. </summary>
+		/// <returns> Pocet prvkov v zozname. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru zoznam obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zoznam obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		List<T>& operator=(const List<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		TieredVectorList<T>& operator=(const TieredVectorList<T>& other);
+
+		/// <summary> Presuvaci operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho sa prevezme obsah. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		TieredVectorList<T>& operator=(TieredVectorList<T>&& other);
+
+		/// <summary> Vrati adresou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Adresa prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T& operator[](const int index) override;
+
+		/// <summary> Vrati hodnotou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Hodnota prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		const T operator[](const int index) const override;
+
+		/// <summary> Prida prvok do zoznamu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(const T& data) override;
+
+		/// <summary> Prida prvok do zoznamu. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(T&& data) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		/// <remarks> Ak je ako index zadana hodnota poctu prvkov (teda prvy neplatny index), metoda insert sa sprava ako metoda add. </remarks>
+		void insert(const T& data, const int index) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		void insert(T&& data, const int index) override;
+
+		/// <summary> Odstrani prvy vyskyt prvku zo zoznamu. </summary>
+		/// <param name = "data"> Odstranovany prvok. </param>
+		/// <returns> true, ak sa podarilo prvok zo zoznamu odobrat, false inak. </returns>
+		bool tryRemove(const T& data) override;
+
+		/// <summary> Odstrani zo zoznamu prvok na danom indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Odstraneny prvok. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T removeAt(const int index) override;
+
+		/// <summary> Vrati index prveho vyskytu prvku v zozname. </summary>
+		/// <param name = "data"> Prvok, ktoreho index sa hlada. </param>
+		/// <returns> Index prveho vyskytu prvku v zozname, ak sa prvok v zozname nenachadza, vrati -1. </returns>
+		int getIndexOf(const T& data) override;
+
+		/// <summary> Vymaze zoznam. </summary>
+		void clear() override;
+
+		/// <summary> Vrati skutocny iterator na zaciatok struktury </summary>
+		/// <returns> Iterator na zaciatok struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getBeginIterator() const override;
+
+		/// <summary> Vrati skutocny iterator na koniec struktury </summary>
+		/// <returns> Iterator na koniec struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getEndIterator() const override;
+	private:
+		/// <summary> Najmensia kapacita stupna. </summary>
+		static const int MIN_TIER_CAPACITY = 4;
+
+		/// <summary> Stupne ulozene za sebou, stupen t zabera pozicie [t * L, (t + 1) * L). </summary>
+		Array<T>* items_;
+		/// <summary> Pozicia prveho prvku v kazdom stupni (relativne k zaciatku stupna). </summary>
+		Array<int>* heads_;
+		/// <summary> Kapacita stupna L. </summary>
+		int tierCapacity_;
+		/// <summary> Log2 kapacity stupna. </summary>
+		int tierShift_;
+		/// <summary> Pocet prvkov v zozname. </summary>
+		size_t size_;
+	private:
+		/// <summary> Vrati adresu prvku na pozicii v ramci stupna. </summary>
+		/// <param name = "tier"> Index stupna. </param>
+		/// <param name = "offset"> Logicka pozicia prvku v stupni. </param>
+		/// <returns> Adresa prvku. </returns>
+		T& slot(const int tier, const int offset) const;
+
+		/// <summary> Vlozi prvok do stupna, ktory nie je plny. Posunie kratsiu cast stupna. </summary>
+		/// <param name = "tier"> Index stupna. </param>
+		/// <param name = "count"> Pocet prvkov v stupni pred vlozenim. </param>
+		/// <param name = "offset"> Logicka pozicia vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		void insertIntoTier(const int tier, const int count, const int offset, T&& data);
+
+		/// <summary> Odstrani prvok zo stupna. Posunie kratsiu cast stupna. </summary>
+		/// <param name = "tier"> Index stupna. </param>
+		/// <param name = "count"> Pocet prvkov v stupni pred odstranenim. </param>
+		/// <param name = "offset"> Logicka pozicia odstranovaneho prvku. </param>
+		/// <returns> Odstraneny prvok. </returns>
+		T removeFromTier(const int tier, const int count, const int offset);
+
+		/// <summary> Zabezpeci miesto pre dalsi prvok. Ak by stupnov bolo viac ako L, zdvojnasobi L. </summary>
+		void ensureCapacity();
+
+		/// <summary> Preusporiada prvky do stupnov s novou kapacitou. </summary>
+		/// <param name = "tierCapacity"> Nova kapacita stupna, mocnina 2. </param>
+		/// <param name = "tierCount"> Pocet stupnov, pre ktore sa alokuje miesto. </param>
+		void rebuild(const int tierCapacity, const int tierCount);
+
+		/// <summary> Iterator pre TieredVectorList. </summary>
+		class TieredVectorListIterator : public Iterator<T>
+		{
+		public:
+			/// <summary> Konstruktor. </summary>
+			/// <param name = "list"> Zoznam, cez ktory iteruje. </param>
+			/// <param name = "position"> Pozicia, na ktorej zacina. </param>
+			TieredVectorListIterator(const TieredVectorList<T>* list, int position);
+
+			/// <summary> Destruktor. </summary>
+			~TieredVectorListIterator();
+
+			/// <summary> Operator priradenia. Priradi do seba hodnotu druheho iteratora. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> Vrati seba po priradeni. </returns>
+			Iterator<T>& operator= (const Iterator<T>& other) override;
+
+			/// <summary> Porovna sa s druhym iteratorom na nerovnost. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> True, ak sa iteratory nerovnaju, false inak. </returns>
+			bool operator!=(const Iterator<T>& other) override;
+
+			/// <summary> Vrati data, na ktore aktualne ukazuje iterator. </summary>
+			/// <returns> Data, na ktore aktualne ukazuje iterator. </returns>
+			const T operator*() override;
+
+			/// <summary> Posunie iterator na dalsi prvok v strukture. </summary>
+			/// <returns> Iterator na dalsi prvok v strukture. </returns>
+			/// <remarks> Zvycajne vrati seba. Ak vrati iny iterator, povodny bude automaticky zruseny. </remarks>
+			Iterator<T>& operator++() override;
+		private:
+			/// <summary> Zoznam, cez ktory iteruje. </summary>
+			const TieredVectorList<T>* list_;
+			/// <summary> Aktualna pozicia v zozname. </summary>
+			int position_;
+		};
+	};
+
+	template<typename T>
+	inline TieredVectorList<T>::TieredVectorList() :
+		List<T>(),
+		items_(new Array<T>(MIN_TIER_CAPACITY)),
+		heads_(new Array<int>(1)),
+		tierCapacity_(MIN_TIER_CAPACITY),
+		tierShift_(2),
+		size_(0)
+	{
+	}
+
+	template<typename T>
+	inline TieredVectorList<T>::TieredVectorList(const TieredVectorList<T>& other) :
+		List<T>(),
+		items_(new Array<T>(*other.items_)),
+		heads_(new Array<int>(*other.heads_)),
+		tierCapacity_(other.tierCapacity_),
+		tierShift_(other.tierShift_),
+		size_(other.size_)
+	{
+	}
+
+	template<typename T>
+	inline TieredVectorList<T>::TieredVectorList(TieredVectorList<T>&& other) :
+		List<T>(),
+		items_(std::exchange(other.items_, nullptr)),
+		heads_(std::exchange(other.heads_, nullptr)),
+		tierCapacity_(other.tierCapacity_),
+		tierShift_(other.tierShift_),
+		size_(std::exchange(other.size_, 0))
+	{
+	}
+
+	template<typename T>
+	inline TieredVectorList<T>::~TieredVectorList()
+	{
+		delete this->items_;
+		this->items_ = nullptr;
+		delete this->heads_;
+		this->heads_ = nullptr;
+		this->size_ = 0;
+	}
+
+	template<typename T>
+	inline Structure* TieredVectorList<T>::clone() const
+	{
+		return new TieredVectorList<T>(*this);
+	}
+
+	template<typename T>
+	inline size_t TieredVectorList<T>::size() const
+	{
+		return size_;
+	}
+
+	template<typename T>
+	inline MemoryUsage TieredVectorList<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(TieredVectorList<T>));
+		if (this->items_ != nullptr)
+		{
+			result.addAllocation(this->items_->memoryUsage());
+			result.addAllocation(this->heads_->memoryUsage());
+			result.bytesWasted += (this->items_->size() - this->size_) * sizeof(T);
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline List<T>& TieredVectorList<T>::operator=(const List<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const TieredVectorList<T>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline TieredVectorList<T>& TieredVectorList<T>::operator=(const TieredVectorList<T>& other)
+	{
+		if (this != &other)
+		{
+			delete this->items_;
+			delete this->heads_;
+			this->items_ = new Array<T>(*other.items_);
+			this->heads_ = new Array<int>(*other.heads_);
+			this->tierCapacity_ = other.tierCapacity_;
+			this->tierShift_ = other.tierShift_;
+			this->size_ = other.size_;
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline TieredVectorList<T>& TieredVectorList<T>::operator=(TieredVectorList<T>&& other)
+	{
+		if (this != &other)
+		{
+			delete this->items_;
+			delete this->heads_;
+			this->items_ = std::exchange(other.items_, nullptr);
+			this->heads_ = std::exchange(other.heads_, nullptr);
+			this->tierCapacity_ = other.tierCapacity_;
+			this->tierShift_ = other.tierShift_;
+			this->size_ = std::exchange(other.size_, 0);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline T& TieredVectorList<T>::operator[](const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_, "TieredVectorList<T>::operator[]: Invalid index.");
+		return this->slot(index >> this->tierShift_, index & (this->tierCapacity_ - 1));
+	}
+
+	template<typename T>
+	inline const T TieredVectorList<T>::operator[](const int index) const
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_, "TieredVectorList<T>::operator[]: Invalid index.");
+		return this->slot(index >> this->tierShift_, index & (this->tierCapacity_ - 1));
+	}
+
+	template<typename T>
+	inline void TieredVectorList<T>::add(const T& data)
+	{
+		this->insert(T(data), static_cast<int>(this->size_));
+	}
+
+	template<typename T>
+	inline void TieredVectorList<T>::add(T&& data)
+	{
+		this->insert(std::move(data), static_cast<int>(this->size_));
+	}
+
+	template<typename T>
+	inline void TieredVectorList<T>::insert(const T& data, const int index)
+	{
+		this->insert(T(data), index);
+	}
+
+	template<typename T>
+	inline void TieredVectorList<T>::insert(T&& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_ + 1, "TieredVectorList<T>::insert: Invalid index.");
+		this->ensureCapacity();
+
+		const int mask = this->tierCapacity_ - 1;
+		const int size = static_cast<int>(this->size_);
+		const int lastTier = size >> this->tierShift_;
+		const int tier = index >> this->tierShift_;
+		if (tier == lastTier)
+		{
+			if ((size & mask) == 0)
+			{
+				(*this->heads_)[lastTier] = 0;
+			}
+			this->insertIntoTier(tier, size & mask, index & mask, std::move(data));
+		}
+		else
+		{
+			// Plny stupen odovzda svoj posledny prvok nasledujucemu, ten ho ulozi pred svoj zaciatok.
+			T carry = this->removeFromTier(tier, this->tierCapacity_, mask);
+			this->insertIntoTier(tier, this->tierCapacity_ - 1, index & mask, std::move(data));
+			int* heads = this->heads_->data();
+			for (int t = tier + 1; t < lastTier; t++)
+			{
+				heads[t] = (heads[t] - 1) & mask;
+				std::swap(carry, this->slot(t, 0));
+			}
+			if ((size & mask) == 0)
+			{
+				heads[lastTier] = 0;
+			}
+			this->insertIntoTier(lastTier, size & mask, 0, std::move(carry));
+		}
+		this->size_++;
+	}
+
+	template<typename T>
+	inline bool TieredVectorList<T>::tryRemove(const T& data)
+	{
+		int index = this->getIndexOf(data);
+		if (index >= 0)
+		{
+			this->removeAt(index);
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template<typename T>
+	inline T TieredVectorList<T>::removeAt(const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, this->size_, "TieredVectorList<T>::removeAt: Invalid index.");
+
+		const int mask = this->tierCapacity_ - 1;
+		const int size = static_cast<int>(this->size_);
+		const int lastTier = (size - 1) >> this->tierShift_;
+		const int tier = index >> this->tierShift_;
+		T result;
+		if (tier == lastTier)
+		{
+			result = this->removeFromTier(tier, ((size - 1) & mask) + 1, index & mask);
+		}
+		else
+		{
+			// Kazdy nasledujuci stupen odovzda svoj prvy prvok na koniec predchadzajuceho.
+			result = this->removeFromTier(tier, this->tierCapacity_, index & mask);
+			int* heads = this->heads_->data();
+			for (int t = tier + 1; t < lastTier; t++)
+			{
+				this->slot(t - 1, mask) = std::move(this->slot(t, 0));
+				heads[t] = (heads[t] + 1) & mask;
+			}
+			this->slot(lastTier - 1, mask) = this->removeFromTier(lastTier, ((size - 1) & mask) + 1, 0);
+		}
+		this->size_--;
+
+		if (this->tierCapacity_ > MIN_TIER_CAPACITY && this->size_ <= static_cast<size_t>(this->tierCapacity_) * this->tierCapacity_ / 16)
+		{
+			this->rebuild(this->tierCapacity_ / 2, this->tierCapacity_ / 2);
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline int TieredVectorList<T>::getIndexOf(const T& data)
+	{
+		const int mask = this->tierCapacity_ - 1;
+		const int size = static_cast<int>(this->size_);
+		for (int index = 0; index < size; index++)
+		{
+			if (this->slot(index >> this->tierShift_, index & mask) == data)
+			{
+				return index;
+			}
+		}
+		return -1;
+	}
+
+	template<typename T>
+	inline void TieredVectorList<T>::clear()
+	{
+		this->size_ = 0;
+		if (this->tierCapacity_ > MIN_TIER_CAPACITY)
+		{
+			this->rebuild(MIN_TIER_CAPACITY, 1);
+		}
+	}
+
+	template<typename T>
+	inline Iterator<T>* TieredVectorList<T>::getBeginIterator() const
+	{
+		return new TieredVectorListIterator(this, 0);
+	}
+
+	template<typename T>
+	inline Iterator<T>* TieredVectorList<T>::getEndIterator() const
+	{
+		return new TieredVectorListIterator(this, static_cast<int>(this->size_));
+	}
+
+	template<typename T>
+	inline T& TieredVectorList<T>::slot(const int tier, const int offset) const
+	{
+		const int head = this->heads_->data()[tier];
+		return this->items_->data()[(tier << this->tierShift_) + ((head + offset) & (this->tierCapacity_ - 1))];
+	}
+
+	template<typename T>
+	inline void TieredVectorList<T>::insertIntoTier(const int tier, const int count, const int offset, T&& data)
+	{
+		int& head = (*this->heads_)[tier];
+		if (offset < count / 2)
+		{
+			// Kratsia je predna cast, posunie sa o jedno dolava.
+			head = (head - 1) & (this->tierCapacity_ - 1);
+			for (int i = 0; i < offset; i++)
+			{
+				this->slot(tier, i) = std::move(this->slot(tier, i + 1));
+			}
+		}
+		else
+		{
+			for (int i = count; i > offset; i--)
+			{
+				this->slot(tier, i) = std::move(this->slot(tier, i - 1));
+			}
+		}
+		this->slot(tier, offset) = std::move(data);
+	}
+
+	template<typename T>
+	inline T TieredVectorList<T>::removeFromTier(const int tier, const int count, const int offset)
+	{
+		T result = std::move(this->slot(tier, offset));
+		int& head = (*this->heads_)[tier];
+		if (offset < count / 2)
+		{
+			for (int i = offset; i > 0; i--)
+			{
+				this->slot(tier, i) = std::move(this->slot(tier, i - 1));
+			}
+			head = (head + 1) & (this->tierCapacity_ - 1);
+		}
+		else
+		{
+			for (int i = offset; i < count - 1; i++)
+			{
+				this->slot(tier, i) = std::move(this->slot(tier, i + 1));
+			}
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline void TieredVectorList<T>::ensureCapacity()
+	{
+		const size_t capacity = this->items_->size();
+		if (this->size_ < capacity)
+		{
+			return;
+		}
+		const int tierCount = static_cast<int>(this->heads_->size());
+		if (tierCount >= this->tierCapacity_)
+		{
+			// Stupnov je uz L, zdvojnasobenim L sa ich pocet stvrti.
+			this->rebuild(2 * this->tierCapacity_, this->tierCapacity_ / 2 + 1);
+		}
+		else
+		{
+			const int newTierCount = tierCount * 2 < this->tierCapacity_ ? tierCount * 2 : this->tierCapacity_;
+			Array<T>* items = new Array<T>(static_cast<size_t>(newTierCount) << this->tierShift_);
+			Array<int>* heads = new Array<int>(newTierCount);
+			Array<T>::copy(*this->items_, 0, *items, 0, static_cast<int>(capacity));
+			Array<int>::copy(*this->heads_, 0, *heads, 0, tierCount);
+			delete this->items_;
+			delete this->heads_;
+			this->items_ = items;
+			this->heads_ = heads;
+		}
+	}
+
+	template<typename T>
+	inline void TieredVectorList<T>::rebuild(const int tierCapacity, const int tierCount)
+	{
+		int shift = 0;
+		while ((1 << shift) < tierCapacity)
+		{
+			shift++;
+		}
+		Array<T>* items = new Array<T>(static_cast<size_t>(tierCount) << shift);
+		Array<int>* heads = new Array<int>(tierCount);
+		T* target = items->data();
+		const int mask = this->tierCapacity_ - 1;
+		const int size = static_cast<int>(this->size_);
+		for (int index = 0; index < size; index++)
+		{
+			target[index] = std::move(this->slot(index >> this->tierShift_, index & mask));
+		}
+		delete this->items_;
+		delete this->heads_;
+		this->items_ = items;
+		this->heads_ = heads;
+		this->tierCapacity_ = tierCapacity;
+		this->tierShift_ = shift;
+	}
+
+	template<typename T>
+	inline TieredVectorList<T>::TieredVectorListIterator::TieredVectorListIterator(const TieredVectorList<T>* list, int position) :
+		list_(list),
+		position_(position)
+	{
+	}
+
+	template<typename T>
+	inline TieredVectorList<T>::TieredVectorListIterator::~TieredVectorListIterator()
+	{
+		this->position_ = 0;
+		this->list_ = nullptr;
+	}
+
+	template<typename T>
+	inline Iterator<T>& TieredVectorList<T>::TieredVectorListIterator::operator=(const Iterator<T>& other)
+	{
+		if (this != &other)
+		{
+			this->position_ = dynamic_cast<const TieredVectorListIterator&>(other).position_;
+			this->list_ = dynamic_cast<const TieredVectorListIterator&>(other).list_;
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline bool TieredVectorList<T>::TieredVectorListIterator::operator!=(const Iterator<T>& other)
+	{
+		return
+			this->position_ != dynamic_cast<const TieredVectorListIterator&>(other).position_ ||
+			this->list_ != dynamic_cast<const TieredVectorListIterator&>(other).list_;
+	}
+
+	template<typename T>
+	inline const T TieredVectorList<T>::TieredVectorListIterator::operator*()
+	{
+		return (*this->list_)[this->position_];
+	}
+
+	template<typename T>
+	inline Iterator<T>& TieredVectorList<T>::TieredVectorListIterator::operator++()
+	{
+		++this->position_;
+		return *this;
+	}
+
+}
@@ -0,0 +1,778 @@
+#pragma once
+
+#include "list.h"
+#include "../structure_iterator.h"
+#include "../ds_routines.h"
+
+namespace structures
+{
+
+	/// <summary> Blok rozbaleneho zretazeneho zoznamu. Uchovava najviac K prvkov v poli. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v bloku. </typepram>
+	/// <typeparam name = "K"> Kapacita bloku. </typepram>
+	template<typename T, int K>
+	class UnrolledLinkedListBlock
+	{
+	public:
+		/// <summary> Konstruktor. Vytvori prazdny blok. </summary>
+		UnrolledLinkedListBlock();
+
+		/// <summary> Destruktor. </summary>
+		~UnrolledLinkedListBlock();
+
+		/// <summary> Vrati pocet prvkov v bloku. </summary>
+		/// <returns> Pocet prvkov v bloku. </returns>
+		int size() const;
+
+		/// <summary> Zisti, ci je blok plny. </summary>
+		/// <returns> true, ak blok obsahuje K prvkov, false inak. </returns>
+		bool isFull() const;
+
+		/// <summary> Vrati adresou prvok na pozicii v bloku. </summary>
+		/// <param name = "offset"> Pozicia prvku v bloku. </param>
+		/// <returns> Adresa prvku. </returns>
+		T& at(const int offset);
+
+		/// <summary> Vrati konstantnou adresou prvok na pozicii v bloku. </summary>
+		/// <param name = "offset"> Pozicia prvku v bloku. </param>
+		/// <returns> Konstantna adresa prvku. </returns>
+		const T& at(const int offset) const;
+
+		/// <summary> Vlozi prvok na poziciu v bloku, nasledujuce prvky posunie. Blok nesmie byt plny. </summary>
+		/// <param name = "data"> Vkladany prvok, do bloku sa presunie. </param>
+		/// <param name = "offset"> Pozicia, musi patrit do intervalu [0, size]. </param>
+		void insert(T&& data, const int offset);
+
+		/// <summary> Odstrani prvok z pozicie v bloku, nasledujuce prvky posunie. </summary>
+		/// <param name = "offset"> Pozicia odstranovaneho prvku. </param>
+		/// <returns> Odstraneny prvok. </returns>
+		T removeAt(const int offset);
+
+		/// <summary> Presunie prvky od pozicie from na koniec bloku other. </summary>
+		/// <param name = "other"> Blok, do ktoreho sa prvky presunu. Musi mat dost miesta. </param>
+		/// <param name = "from"> Pozicia prveho presuvaneho prvku. </param>
+		void moveTailTo(UnrolledLinkedListBlock<T, K>& other, const int from);
+
+		/// <summary> Getter nasledujuceho bloku. </summary>
+		/// <returns> Nasledujuci blok. </returns>
+		UnrolledLinkedListBlock<T, K>* getNext() const;
+
+		/// <summary> Setter nasledujuceho bloku. </summary>
+		/// <param name = "next"> Novy nasledujuci blok. </param>
+		void setNext(UnrolledLinkedListBlock<T, K>* next);
+
+		/// <summary> Getter predchadzajuceho bloku. </summary>
+		/// <returns> Predchadzajuci blok. </returns>
+		UnrolledLinkedListBlock<T, K>* getPrevious() const;
+
+		/// <summary> Setter predchadzajuceho bloku. </summary>
+		/// <param name = "previous"> Novy predchadzajuci blok. </param>
+		void setPrevious(UnrolledLinkedListBlock<T, K>* previous);
+	private:
+		/// <summary> Prvky bloku, platnych je prvych count_. </summary>
+		T items_[K];
+		/// <summary> Pocet prvkov v bloku. </summary>
+		int count_;
+		/// <summary> Nasledujuci blok. </summary>
+		UnrolledLinkedListBlock<T, K>* next_;
+		/// <summary> Predchadzajuci blok. </summary>
+		UnrolledLinkedListBlock<T, K>* previous_;
+	};
+
+	/// <summary> Rozbaleny zretazeny zoznam. Prvky uklada po K do obojstranne zretazenych blokov. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v zozname. Musi mat implicitny konstruktor. </typepram>
+	/// <typeparam name = "K"> Kapacita jedneho bloku. </typepram>
+	/// <remarks>
+	/// Plny blok sa pri vkladani rozdeli na polovice, blok zaplneny menej ako do polovice sa pri odoberani
+	/// zluci s nasledujucim, ak sa do neho zmesti. Priechod je takmer taky rychly ako v poli a vkladanie
+	/// do stredu zoznamu presuva najviac K prvkov, namiesto vsetkych ako v ArrayList.
+	/// </remarks>
+	template<typename T, int K = 32>
+	class UnrolledLinkedList final : public List<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		UnrolledLinkedList();
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> UnrolledLinkedList, z ktoreho sa prevezmu vlastnosti. </param>
+		UnrolledLinkedList(const UnrolledLinkedList<T, K>& other);
+
+		/// <summary> Presuvaci konstruktor. </summary>
+		/// <param name = "other"> UnrolledLinkedList, z ktoreho sa prevezme obsah. </param>
+		UnrolledLinkedList(UnrolledLinkedList<T, K>&& other);
+
+		/// <summary> Destruktor. </summary>
+		~UnrolledLinkedList();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat zoznamu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov v zozname. </summary>
+		/// <returns> Pocet prvkov v zozname. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru zoznam obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zoznam obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		List<T>& operator=(const List<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		UnrolledLinkedList<T, K>& operator=(const UnrolledLinkedList<T, K>& other);
+
+		/// <summary> Presuvaci operator priradenia. </summary>
+		/// <param name = "other"> Zoznam, z ktoreho sa prevezme obsah. </param>
+		/// <returns> Adresa, na ktorej sa tento zoznam nachadza po priradeni. </returns>
+		UnrolledLinkedList<T, K>& operator=(UnrolledLinkedList<T, K>&& other);
+
+		/// <summary> Vrati adresou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Adresa prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T& operator[](const int index) override;
+
+		/// <summary> Vrati hodnotou prvok na indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Hodnota prvku na danom indexe. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		const T operator[](const int index) const override;
+
+		/// <summary> Prida prvok do zoznamu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(const T& data) override;
+
+		/// <summary> Prida prvok do zoznamu. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void add(T&& data) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		/// <remarks> Ak je ako index zadana hodnota poctu prvkov (teda prvy neplatny index), metoda insert sa sprava ako metoda add. </remarks>
+		void insert(const T& data, const int index) override;
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. Prvok do zoznamu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "index"> Index prvku. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		void insert(T&& data, const int index) override;
+
+		/// <summary> Odstrani prvy vyskyt prvku zo zoznamu. </summary>
+		/// <param name = "data"> Odstranovany prvok. </param>
+		/// <returns> true, ak sa podarilo prvok zo zoznamu odobrat, false inak. </returns>
+		bool tryRemove(const T& data) override;
+
+		/// <summary> Odstrani zo zoznamu prvok na danom indexe. </summary>
+		/// <param name = "index"> Index prvku. </param>
+		/// <returns> Odstraneny prvok. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak index nepatri do zoznamu. </exception>
+		T removeAt(const int index) override;
+
+		/// <summary> Vrati index prveho vyskytu prvku v zozname. </summary>
+		/// <param name = "data"> Prvok, ktoreho index sa hlada. </param>
+		/// <returns> Index prveho vyskytu prvku v zozname, ak sa prvok v zozname nenachadza, vrati -1. </returns>
+		int getIndexOf(const T& data) override;
+
+		/// <summary> Vymaze zoznam. </summary>
+		void clear() override;
+
+		/// <summary> Vrati skutocny iterator na zaciatok struktury </summary>
+		/// <returns> Iterator na zaciatok struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getBeginIterator() const override;
+
+		/// <summary> Vrati skutocny iterator na koniec struktury </summary>
+		/// <returns> Iterator na koniec struktury. </returns>
+		/// <remarks> Zabezpecuje polymorfizmus. </remarks>
+		Iterator<T>* getEndIterator() const override;
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function);
+
+		/// <summary> Zavola funkciu postupne na kazdy prvok zoznamu. </summary>
+		/// <param name = "function"> Volana funkcia, dostane konstantnu adresu prvku. </param>
+		template<typename Function>
+		void forEach(Function function) const;
+	private:
+		/// <summary> Pocet prvkov v zozname. </summary>
+		size_t size_;
+		/// <summary> Pocet blokov zoznamu. </summary>
+		size_t blockCount_;
+		/// <summary> Prvy blok zoznamu. </summary>
+		UnrolledLinkedListBlock<T, K>* first_;
+		/// <summary> Posledny blok zoznamu. </summary>
+		UnrolledLinkedListBlock<T, K>* last_;
+	private:
+		/// <summary> Najde blok, v ktorom sa nachadza prvok na danom indexe. </summary>
+		/// <param name = "index"> Index prvku, musi patrit do zoznamu. </param>
+		/// <param name = "offset"> Vystupny parameter, pozicia prvku v najdenom bloku. </param>
+		/// <returns> Blok, v ktorom sa prvok nachadza. </returns>
+		/// <remarks> Prechadza od blizsieho konca zoznamu. </remarks>
+		UnrolledLinkedListBlock<T, K>* findBlock(int index, int& offset) const;
+
+		/// <summary> Zaradi do zoznamu novy prazdny blok za dany blok. </summary>
+		/// <param name = "block"> Blok, za ktory sa novy blok zaradi, alebo nullptr, ak je zoznam prazdny. </param>
+		/// <returns> Novy blok. </returns>
+		UnrolledLinkedListBlock<T, K>* linkBlockAfter(UnrolledLinkedListBlock<T, K>* block);
+
+		/// <summary> Vyradi blok zo zoznamu a zrusi ho. </summary>
+		/// <param name = "block"> Ruseny blok. </param>
+		void unlinkBlock(UnrolledLinkedListBlock<T, K>* block);
+
+		/// <summary> Vlozi prvok do zoznamu na dany index. </summary>
+		/// <param name = "data"> Vkladany prvok, do zoznamu sa presunie. </param>
+		/// <param name = "index"> Index prvku, musi patrit do intervalu [0, size]. </param>
+		void insertItem(T&& data, const int index);
+	private:
+		/// <summary> Iterator pre UnrolledLinkedList. </summary>
+		class UnrolledLinkedListIterator : public Iterator<T>
+		{
+		public:
+			/// <summary> Konstruktor. </summary>
+			/// <param name = "block"> Blok, v ktorom iterator zacina. </param>
+			/// <param name = "offset"> Pozicia v bloku, na ktorej iterator zacina. </param>
+			UnrolledLinkedListIterator(UnrolledLinkedListBlock<T, K>* block, int offset);
+
+			/// <summary> Destruktor. </summary>
+			~UnrolledLinkedListIterator();
+
+			/// <summary> Operator priradenia. Priradi do seba hodnotu druheho iteratora. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> Vrati seba po priradeni. </returns>
+			Iterator<T>& operator= (const Iterator<T>& other) override;
+
+			/// <summary> Porovna sa s druhym iteratorom na nerovnost. </summary>
+			/// <param name = "other"> Druhy iterator. </param>
+			/// <returns> True, ak sa iteratory nerovnaju, false inak. </returns>
+			bool operator!=(const Iterator<T>& other) override;
+
+			/// <summary> Vrati data, na ktore aktualne ukazuje iterator. </summary>
+			/// <returns> Data, na ktore aktualne ukazuje iterator. </returns>
+			const T operator*() override;
+
+			/// <summary> Posunie iterator na dalsi prvok v strukture. </summary>
+			/// <returns> Iterator na dalsi prvok v strukture. </returns>
+			/// <remarks> Zvycajne vrati seba. Ak vrati iny iterator, povodny bude automaticky zruseny. </remarks>
+			Iterator<T>& operator++() override;
+		private:
+			/// <summary> Aktualny blok. </summary>
+			UnrolledLinkedListBlock<T, K>* block_;
+			/// <summary> Aktualna pozicia v bloku. </summary>
+			int offset_;
+		};
+	};
+
+	template<typename T, int K>
+	inline UnrolledLinkedListBlock<T, K>::UnrolledLinkedListBlock() :
+		items_(),
+		count_(0),
+		next_(nullptr),
+		previous_(nullptr)
+	{
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedListBlock<T, K>::~UnrolledLinkedListBlock()
+	{
+		next_ = nullptr;
+		previous_ = nullptr;
+	}
+
+	template<typename T, int K>
+	inline int UnrolledLinkedListBlock<T, K>::size() const
+	{
+		return count_;
+	}
+
+	template<typename T, int K>
+	inline bool UnrolledLinkedListBlock<T, K>::isFull() const
+	{
+		return count_ == K;
+	}
+
+	template<typename T, int K>
+	inline T& UnrolledLinkedListBlock<T, K>::at(const int offset)
+	{
+		return items_[offset];
+	}
+
+	template<typename T, int K>
+	inline const T& UnrolledLinkedListBlock<T, K>::at(const int offset) const
+	{
+		return items_[offset];
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedListBlock<T, K>::insert(T&& data, const int offset)
+	{
+		for (int i = count_; i > offset; i--)
+		{
+			items_[i] = std::move(items_[i - 1]);
+		}
+		items_[offset] = std::move(data);
+		count_++;
+	}
+
+	template<typename T, int K>
+	inline T UnrolledLinkedListBlock<T, K>::removeAt(const int offset)
+	{
+		T result = std::move(items_[offset]);
+		count_--;
+		for (int i = offset; i < count_; i++)
+		{
+			items_[i] = std::move(items_[i + 1]);
+		}
+		items_[count_] = T();
+		return result;
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedListBlock<T, K>::moveTailTo(UnrolledLinkedListBlock<T, K>& other, const int from)
+	{
+		for (int i = from; i < count_; i++)
+		{
+			other.items_[other.count_++] = std::move(items_[i]);
+			items_[i] = T();
+		}
+		count_ = from;
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedListBlock<T, K>* UnrolledLinkedListBlock<T, K>::getNext() const
+	{
+		return next_;
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedListBlock<T, K>::setNext(UnrolledLinkedListBlock<T, K>* next)
+	{
+		next_ = next;
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedListBlock<T, K>* UnrolledLinkedListBlock<T, K>::getPrevious() const
+	{
+		return previous_;
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedListBlock<T, K>::setPrevious(UnrolledLinkedListBlock<T, K>* previous)
+	{
+		previous_ = previous;
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedList<T, K>::UnrolledLinkedList() :
+		List<T>(),
+		size_(0),
+		blockCount_(0),
+		first_(nullptr),
+		last_(nullptr)
+	{
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedList<T, K>::UnrolledLinkedList(const UnrolledLinkedList<T, K>& other) :
+		UnrolledLinkedList()
+	{
+		*this = other;
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedList<T, K>::UnrolledLinkedList(UnrolledLinkedList<T, K>&& other) :
+		List<T>(),
+		size_(std::exchange(other.size_, 0)),
+		blockCount_(std::exchange(other.blockCount_, 0)),
+		first_(std::exchange(other.first_, nullptr)),
+		last_(std::exchange(other.last_, nullptr))
+	{
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedList<T, K>::~UnrolledLinkedList()
+	{
+		this->clear();
+	}
+
+	template<typename T, int K>
+	inline Structure* UnrolledLinkedList<T, K>::clone() const
+	{
+		return new UnrolledLinkedList<T, K>(*this);
+	}
+
+	template<typename T, int K>
+	inline size_t UnrolledLinkedList<T, K>::size() const
+	{
+		return size_;
+	}
+
+	template<typename T, int K>
+	inline MemoryUsage UnrolledLinkedList<T, K>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(UnrolledLinkedList<T, K>));
+		result.addAllocations(sizeof(UnrolledLinkedListBlock<T, K>), blockCount_);
+		result.bytesWasted += (blockCount_ * K - size_) * sizeof(T);
+		return result;
+	}
+
+	template<typename T, int K>
+	inline List<T>& UnrolledLinkedList<T, K>::operator=(const List<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const UnrolledLinkedList<T, K>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedList<T, K>& UnrolledLinkedList<T, K>::operator=(const UnrolledLinkedList<T, K>& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+			other.forEach([this](const T& data) { this->add(data); });
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedList<T, K>& UnrolledLinkedList<T, K>::operator=(UnrolledLinkedList<T, K>&& other)
+	{
+		if (this != &other)
+		{
+			this->clear();
+			size_ = std::exchange(other.size_, 0);
+			blockCount_ = std::exchange(other.blockCount_, 0);
+			first_ = std::exchange(other.first_, nullptr);
+			last_ = std::exchange(other.last_, nullptr);
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline T& UnrolledLinkedList<T, K>::operator[](const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_, "UnrolledLinkedList<T, K>::operator[]: Invalid index.");
+		int offset;
+		return this->findBlock(index, offset)->at(offset);
+	}
+
+	template<typename T, int K>
+	inline const T UnrolledLinkedList<T, K>::operator[](const int index) const
+	{
+		DSRoutines::rangeCheckExcept(index, size_, "UnrolledLinkedList<T, K>::operator[]: Invalid index.");
+		int offset;
+		return this->findBlock(index, offset)->at(offset);
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedList<T, K>::add(const T& data)
+	{
+		this->insertItem(T(data), static_cast<int>(size_));
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedList<T, K>::add(T&& data)
+	{
+		this->insertItem(std::move(data), static_cast<int>(size_));
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedList<T, K>::insert(const T& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "UnrolledLinkedList<T, K>::insert: Invalid index.");
+		this->insertItem(T(data), index);
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedList<T, K>::insert(T&& data, const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_ + 1, "UnrolledLinkedList<T, K>::insert: Invalid index.");
+		this->insertItem(std::move(data), index);
+	}
+
+	template<typename T, int K>
+	inline bool UnrolledLinkedList<T, K>::tryRemove(const T& data)
+	{
+		int index = this->getIndexOf(data);
+		if (index >= 0)
+		{
+			this->removeAt(index);
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template<typename T, int K>
+	inline T UnrolledLinkedList<T, K>::removeAt(const int index)
+	{
+		DSRoutines::rangeCheckExcept(index, size_, "UnrolledLinkedList<T, K>::removeAt: Invalid index.");
+		int offset;
+		UnrolledLinkedListBlock<T, K>* block = this->findBlock(index, offset);
+		T data = block->removeAt(offset);
+		size_--;
+		if (block->size() == 0)
+		{
+			this->unlinkBlock(block);
+		}
+		else if (block->size() < K / 2)
+		{
+			UnrolledLinkedListBlock<T, K>* next = block->getNext();
+			if (next != nullptr && block->size() + next->size() <= K)
+			{
+				next->moveTailTo(*block, 0);
+				this->unlinkBlock(next);
+			}
+		}
+		return data;
+	}
+
+	template<typename T, int K>
+	inline int UnrolledLinkedList<T, K>::getIndexOf(const T& data)
+	{
+		int index = 0;
+		for (UnrolledLinkedListBlock<T, K>* block = first_; block != nullptr; block = block->getNext())
+		{
+			for (int i = 0; i < block->size(); i++)
+			{
+				if (block->at(i) == data)
+				{
+					return index + i;
+				}
+			}
+			index += block->size();
+		}
+		return -1;
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedList<T, K>::clear()
+	{
+		UnrolledLinkedListBlock<T, K>* block = first_;
+		while (block != nullptr)
+		{
+			UnrolledLinkedListBlock<T, K>* next = block->getNext();
+			delete block;
+			block = next;
+		}
+		first_ = nullptr;
+		last_ = nullptr;
+		size_ = 0;
+		blockCount_ = 0;
+	}
+
+	template<typename T, int K>
+	inline Iterator<T>* UnrolledLinkedList<T, K>::getBeginIterator() const
+	{
+		return new UnrolledLinkedListIterator(first_, 0);
+	}
+
+	template<typename T, int K>
+	inline Iterator<T>* UnrolledLinkedList<T, K>::getEndIterator() const
+	{
+		return new UnrolledLinkedListIterator(nullptr, 0);
+	}
+
+	template<typename T, int K>
+	template<typename Function>
+	inline void UnrolledLinkedList<T, K>::forEach(Function function)
+	{
+		for (UnrolledLinkedListBlock<T, K>* block = first_; block != nullptr; block = block->getNext())
+		{
+			for (int i = 0; i < block->size(); i++)
+			{
+				function(block->at(i));
+			}
+		}
+	}
+
+	template<typename T, int K>
+	template<typename Function>
+	inline void UnrolledLinkedList<T, K>::forEach(Function function) const
+	{
+		for (const UnrolledLinkedListBlock<T, K>* block = first_; block != nullptr; block = block->getNext())
+		{
+			for (int i = 0; i < block->size(); i++)
+			{
+				function(block->at(i));
+			}
+		}
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedListBlock<T, K>* UnrolledLinkedList<T, K>::findBlock(int index, int& offset) const
+	{
+		UnrolledLinkedListBlock<T, K>* block;
+		if (index < static_cast<int>(size_) / 2)
+		{
+			block = first_;
+			while (index >= block->size())
+			{
+				index -= block->size();
+				block = block->getNext();
+			}
+		}
+		else
+		{
+			block = last_;
+			index = static_cast<int>(size_) - index;
+			while (index > block->size())
+			{
+				index -= block->size();
+				block = block->getPrevious();
+			}
+			index = block->size() - index;
+		}
+		offset = index;
+		return block;
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedListBlock<T, K>* UnrolledLinkedList<T, K>::linkBlockAfter(UnrolledLinkedListBlock<T, K>* block)
+	{
+		UnrolledLinkedListBlock<T, K>* newBlock = new UnrolledLinkedListBlock<T, K>();
+		if (block == nullptr)
+		{
+			first_ = newBlock;
+			last_ = newBlock;
+		}
+		else
+		{
+			UnrolledLinkedListBlock<T, K>* next = block->getNext();
+			newBlock->setPrevious(block);
+			newBlock->setNext(next);
+			block->setNext(newBlock);
+			if (next != nullptr)
+			{
+				next->setPrevious(newBlock);
+			}
+			else
+			{
+				last_ = newBlock;
+			}
+		}
+		blockCount_++;
+		return newBlock;
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedList<T, K>::unlinkBlock(UnrolledLinkedListBlock<T, K>* block)
+	{
+		UnrolledLinkedListBlock<T, K>* previous = block->getPrevious();
+		UnrolledLinkedListBlock<T, K>* next = block->getNext();
+		if (previous != nullptr)
+		{
+			previous->setNext(next);
+		}
+		else
+		{
+			first_ = next;
+		}
+		if (next != nullptr)
+		{
+			next->setPrevious(previous);
+		}
+		else
+		{
+			last_ = previous;
+		}
+		delete block;
+		blockCount_--;
+	}
+
+	template<typename T, int K>
+	inline void UnrolledLinkedList<T, K>::insertItem(T&& data, const int index)
+	{
+		UnrolledLinkedListBlock<T, K>* block;
+		int offset;
+		if (index == static_cast<int>(size_))
+		{
+			block = last_;
+			if (block == nullptr || block->isFull())
+			{
+				block = this->linkBlockAfter(block);
+			}
+			offset = block->size();
+		}
+		else
+		{
+			block = this->findBlock(index, offset);
+			if (block->isFull())
+			{
+				UnrolledLinkedListBlock<T, K>* newBlock = this->linkBlockAfter(block);
+				block->moveTailTo(*newBlock, K / 2);
+				if (offset > K / 2)
+				{
+					block = newBlock;
+					offset -= K / 2;
+				}
+			}
+		}
+		block->insert(std::move(data), offset);
+		size_++;
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedList<T, K>::UnrolledLinkedListIterator::UnrolledLinkedListIterator(UnrolledLinkedListBlock<T, K>* block, int offset) :
+		block_(block),
+		offset_(offset)
+	{
+	}
+
+	template<typename T, int K>
+	inline UnrolledLinkedList<T, K>::UnrolledLinkedListIterator::~UnrolledLinkedListIterator()
+	{
+		block_ = nullptr;
+	}
+
+	template<typename T, int K>
+	inline Iterator<T>& UnrolledLinkedList<T, K>::UnrolledLinkedListIterator::operator=(const Iterator<T>& other)
+	{
+		if (this != &other)
+		{
+			const UnrolledLinkedListIterator& otherIterator = dynamic_cast<const UnrolledLinkedList<T, K>::UnrolledLinkedListIterator&>(other);
+			block_ = otherIterator.block_;
+			offset_ = otherIterator.offset_;
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline bool UnrolledLinkedList<T, K>::UnrolledLinkedListIterator::operator!=(const Iterator<T>& other)
+	{
+		const UnrolledLinkedListIterator& otherIterator = dynamic_cast<const UnrolledLinkedList<T, K>::UnrolledLinkedListIterator&>(other);
+		return block_ != otherIterator.block_ || offset_ != otherIterator.offset_;
+	}
+
+	template<typename T, int K>
+	inline const T UnrolledLinkedList<T, K>::UnrolledLinkedListIterator::operator*()
+	{
+		return block_->at(offset_);
+	}
+
+	template<typename T, int K>
+	inline Iterator<T>& UnrolledLinkedList<T, K>::UnrolledLinkedListIterator::operator++()
+	{
+		offset_++;
+		if (offset_ == block_->size())
+		{
+			block_ = block_->getNext();
+			offset_ = 0;
+		}
+		return *this;
+	}
+}
@@ -7,7 +7,7 @@ namespace structures
 {
 
 	template<typename T>
-	class ExplicitMatrix : public Matrix<T>
+	class ExplicitMatrix final : public Matrix<T>
 	{
 	public:
 	
@@ -21,6 +21,7 @@ namespace structures
 
 		Structure* clone() const override;
 		size_t size() const override;
+		MemoryUsage memoryUsage() const override;
 		Matrix<T>& operator=(const Matrix<T>& other) override;
 		ExplicitMatrix<T>& operator=(const ExplicitMatrix<T>& other);
 		ExplicitMatrix(const ExplicitMatrix<T>& other);
@@ -92,6 +93,18 @@ namespace structures
 		return numberOfColumns() * numberOfRows();
 	}
 
+	template<typename T>
+	inline MemoryUsage ExplicitMatrix<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(ExplicitMatrix<T>));
+		result.addAllocation(matrix_->memoryUsage());
+		for (size_t i = 0; i < matrix_->size(); i++)
+		{
+			result.addAllocation((*matrix_)[i]->memoryUsage());
+		}
+		return result;
+	}
+
 	template<typename T>
 	inline Matrix<T>& ExplicitMatrix<T>::operator=(const Matrix<T>& other)
 	{
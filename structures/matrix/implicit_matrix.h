@@ -6,7 +6,7 @@ namespace structures
 {
 
 	template<typename T>
-	class ImplicitMatrix : public Matrix<T>
+	class ImplicitMatrix final : public Matrix<T>
 	{
 	public:
 
@@ -22,6 +22,7 @@ namespace structures
 
 		Structure* clone() const override;
 		size_t size() const override;
+		MemoryUsage memoryUsage() const override;
 		Matrix<T>& operator=(const Matrix<T>& other) override;
 		ImplicitMatrix<T>& operator=(const ImplicitMatrix<T>& other);
 		ImplicitMatrix<T>& operator=(ImplicitMatrix<T>&& other);
@@ -105,6 +106,17 @@ namespace structures
 		return matrix_->size();
 	}
 
+	template<typename T>
+	inline MemoryUsage ImplicitMatrix<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(ImplicitMatrix<T>));
+		if (matrix_ != nullptr)
+		{
+			result.addAllocation(matrix_->memoryUsage());
+		}
+		return result;
+	}
+
 	template<typename T>
 	inline Matrix<T>& ImplicitMatrix<T>::operator=(const Matrix<T>& other)
 	{
@@ -17,6 +17,7 @@ namespace structures
 
 		virtual Structure* clone() const = 0;
 		virtual size_t size() const = 0;
+		virtual MemoryUsage memoryUsage() const = 0;
 		virtual Matrix<T>& operator=(const Matrix<T>& other) = 0;
 
 		Structure& operator=(const Structure& other) override;
@@ -0,0 +1,428 @@
+#pragma once
+
+#include "priority_queue.h"
+#include "../list/array_list.h"
+#include "../array/array.h"
+#include <stdexcept>
+#include <climits>
+#include <algorithm>
+
+namespace structures
+{
+	/// <summary> Prioritny front implementovany priehradkami (bucket queue) pre monotonne celociselne priority. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v prioritnom fronte. </typepram>
+	/// <remarks>
+	/// Front drzi okno bucketCount za sebou iducich priorit zacinajuce na baze, kazda priorita okna ma vlastnu priehradku
+	/// (index priorita mod bucketCount). Prvky s prioritou za oknom cakaju v zozname mimo okna. Kurzor ukazuje na najmensiu
+	/// prioritu v okne a pri pope sa posuva dopredu, ked sa okno vyprazdni, baza sa posunie na najmensiu prioritu mimo okna.
+	/// Ak su priority monotonne a ich rozsah nepresahuje okno, push aj pop trvaju amortizovane O(1).
+	/// Push s prioritou pred bazou posunie okno spat, prvky, ktore z neho vypadnu, sa presunu mimo okna.
+	/// V kontrolnom rezime push odmietne prioritu mensiu ako naposledy odobrata.
+	/// </remarks>
+	template<typename T>
+	class BucketQueue final : public PriorityQueue<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		/// <param name = "bucketCount"> Pocet priehradok, teda sirka okna priorit. </param>
+		/// <param name = "checkMonotone"> Ci ma push odmietnut prioritu mensiu ako naposledy odobrata. </param>
+		/// <exception cref="std::invalid_argument"> Vyhodena, ak je pocet priehradok 0. </exception>
+		BucketQueue(size_t bucketCount = 1024, bool checkMonotone = true);
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Front, z ktoreho sa prevezmu vlastnosti. </param>
+		BucketQueue(const BucketQueue<T>& other);
+
+		/// <summary> Destruktor. </summary>
+		~BucketQueue();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat frontu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Prioritny front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak vstupny parameter nie je front s priehradkami. </exception>
+		PriorityQueue<T>& operator=(const PriorityQueue<T>& other) override;
+
+		/// <summary> Operator priradenia. Pocet priehradok a kontrolny rezim sa nepreberu. </summary>
+		/// <param name = "other"> Front s priehradkami, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento front nachadza po priradeni. </returns>
+		BucketQueue<T>& operator=(const BucketQueue<T>& other);
+
+		/// <summary> Vrati pocet prvkov vo fronte. </summary>
+		/// <returns> Pocet prvkov vo fronte. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Vymaze obsah frontu a zabudne naposledy odobratu prioritu. </summary>
+		void clear() override;
+
+		/// <summary> Vlozi prvok s danou prioritou do frontu. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		/// <exception cref="std::logic_error"> Vyhodena v kontrolnom rezime, ak je priorita mensia ako naposledy odobrata. </exception>
+		void push(const int priority, const T& data) override;
+
+		/// <summary> Vlozi prvok s danou prioritou do frontu. Prvok presunie. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		/// <exception cref="std::logic_error"> Vyhodena v kontrolnom rezime, ak je priorita mensia ako naposledy odobrata. </exception>
+		void push(const int priority, T&& data) override;
+
+		/// <summary> Odstrani prvok s najvacsou prioritou z frontu. </summary>
+		/// <returns> Odstraneny prvok. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front prazdny. </exception>
+		T pop() override;
+
+		/// <summary> Vrati adresou prvok s najvacsou prioritou. </summary>
+		/// <returns> Adresa, na ktorej sa nachadza prvok s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front prazdny. </exception>
+		T& peek() override;
+
+		/// <summary> Vrati kopiu prvku s najvacsou prioritou. </summary>
+		/// <returns> Kopia prvku s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front prazdny. </exception>
+		const T peek() const override;
+
+		/// <summary> Vrati prioritu prvku s najvacsou prioritou. </summary>
+		/// <returns> Priorita prvku s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front prazdny. </exception>
+		int peekPriority() const override;
+
+		/// <summary> Vrati naposledy odobratu prioritu, mensiu prioritu kontrolny rezim odmietne. </summary>
+		/// <returns> Naposledy odobrata priorita, alebo najmensie cislo typu int, ak sa este nic neodobralo. </returns>
+		int lastPriority() const;
+
+	private:
+		/// <summary> Priehradky okna, kazda obsahuje prvky s jednou prioritou. </summary>
+		Array<ArrayList<PriorityQueueItem<T>*>*>* buckets_;
+		/// <summary> Prvky s prioritou za oknom. </summary>
+		ArrayList<PriorityQueueItem<T>*>* overflow_;
+		/// <summary> Najmensia priorita okna. </summary>
+		long long base_;
+		/// <summary> Najmensia priorita prvku v okne, ak okno nie je prazdne. </summary>
+		long long cursor_;
+		/// <summary> Pocet prvkov v okne. </summary>
+		size_t windowSize_;
+		/// <summary> Naposledy odobrata priorita. </summary>
+		int last_;
+		/// <summary> Ci push odmieta prioritu mensiu ako naposledy odobrata. </summary>
+		bool checkMonotone_;
+
+	private:
+		/// <summary> Zaradi vytvoreny prvok do okna alebo mimo neho. </summary>
+		/// <param name = "item"> Zaradovany prvok. Front ho prebera do vlastnictva. </param>
+		void pushItem(PriorityQueueItem<T>* item);
+
+		/// <summary> Vrati priehradku priority z okna. </summary>
+		/// <param name = "priority"> Priorita z okna. </param>
+		/// <returns> Priehradka priority. </returns>
+		ArrayList<PriorityQueueItem<T>*>* bucket(const long long priority) const;
+
+		/// <summary> Posunie zaciatok okna spat, prvky, ktore z okna vypadnu, presunie mimo okna. </summary>
+		/// <param name = "priority"> Novy zaciatok okna, mensi ako aktualny. </param>
+		void moveBaseBack(const long long priority);
+
+		/// <summary> Po odobrati prvku posunie kurzor na dalsiu neprazdnu priehradku, prazdne okno presunie za prvky mimo okna. </summary>
+		void advance();
+
+		/// <summary> Vrati prvok s najvacsou prioritou. </summary>
+		/// <param name = "message"> Sprava vynimky. </param>
+		/// <returns> Prvok s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front prazdny. </exception>
+		PriorityQueueItem<T>* findPeek(const char* message) const;
+	};
+
+	template<typename T>
+	inline BucketQueue<T>::BucketQueue(size_t bucketCount, bool checkMonotone) :
+		PriorityQueue<T>(),
+		buckets_(nullptr),
+		overflow_(new ArrayList<PriorityQueueItem<T>*>()),
+		base_(0),
+		cursor_(0),
+		windowSize_(0),
+		last_(INT_MIN),
+		checkMonotone_(checkMonotone)
+	{
+		if (bucketCount == 0)
+		{
+			delete overflow_;
+			throw std::invalid_argument("BucketQueue<T>::BucketQueue: Bucket count must be positive.");
+		}
+		buckets_ = new Array<ArrayList<PriorityQueueItem<T>*>*>(bucketCount);
+		for (int i = 0; i < static_cast<int>(bucketCount); i++)
+		{
+			(*buckets_)[i] = new ArrayList<PriorityQueueItem<T>*>();
+		}
+	}
+
+	template<typename T>
+	inline BucketQueue<T>::BucketQueue(const BucketQueue<T>& other) :
+		BucketQueue<T>(other.buckets_->size(), other.checkMonotone_)
+	{
+		*this = other;
+	}
+
+	template<typename T>
+	inline BucketQueue<T>::~BucketQueue()
+	{
+		clear();
+		for (int i = 0; i < static_cast<int>(buckets_->size()); i++)
+		{
+			delete (*buckets_)[i];
+		}
+		delete buckets_;
+		buckets_ = nullptr;
+		delete overflow_;
+		overflow_ = nullptr;
+	}
+
+	template<typename T>
+	inline Structure* BucketQueue<T>::clone() const
+	{
+		return new BucketQueue<T>(*this);
+	}
+
+	template<typename T>
+	inline PriorityQueue<T>& BucketQueue<T>::operator=(const PriorityQueue<T>& other)
+	{
+		return *this = dynamic_cast<const BucketQueue<T>&>(other);
+	}
+
+	template<typename T>
+	inline BucketQueue<T>& BucketQueue<T>::operator=(const BucketQueue<T>& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			// Kontrola sa pri kopirovani neuplatni, prvky druhej haldy mozu byt pod jej naposledy odobratou prioritou.
+			const bool checkMonotone = checkMonotone_;
+			checkMonotone_ = false;
+			for (int i = 0; i < static_cast<int>(other.buckets_->size()); i++)
+			{
+				const ArrayList<PriorityQueueItem<T>*>& bucket = *(*other.buckets_)[i];
+				for (int j = 0; j < static_cast<int>(bucket.size()); j++)
+				{
+					pushItem(new PriorityQueueItem<T>(*bucket[j]));
+				}
+			}
+			for (int i = 0; i < static_cast<int>(other.overflow_->size()); i++)
+			{
+				pushItem(new PriorityQueueItem<T>(*(*other.overflow_)[i]));
+			}
+			checkMonotone_ = checkMonotone;
+			last_ = other.last_;
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline size_t BucketQueue<T>::size() const
+	{
+		return windowSize_ + overflow_->size();
+	}
+
+	template<typename T>
+	inline MemoryUsage BucketQueue<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(BucketQueue<T>));
+		result.addAllocation(buckets_->memoryUsage());
+		for (int i = 0; i < static_cast<int>(buckets_->size()); i++)
+		{
+			result.addAllocation((*buckets_)[i]->memoryUsage());
+		}
+		result.addAllocation(overflow_->memoryUsage());
+		result.addAllocations(sizeof(PriorityQueueItem<T>), size());
+		return result;
+	}
+
+	template<typename T>
+	inline void BucketQueue<T>::clear()
+	{
+		for (int i = 0; i < static_cast<int>(buckets_->size()); i++)
+		{
+			ArrayList<PriorityQueueItem<T>*>& bucket = *(*buckets_)[i];
+			for (int j = 0; j < static_cast<int>(bucket.size()); j++)
+			{
+				delete bucket[j];
+			}
+			bucket.clear();
+		}
+		for (int i = 0; i < static_cast<int>(overflow_->size()); i++)
+		{
+			delete (*overflow_)[i];
+		}
+		overflow_->clear();
+		windowSize_ = 0;
+		last_ = INT_MIN;
+	}
+
+	template<typename T>
+	inline void BucketQueue<T>::push(const int priority, const T& data)
+	{
+		pushItem(new PriorityQueueItem<T>(priority, data));
+	}
+
+	template<typename T>
+	inline void BucketQueue<T>::push(const int priority, T&& data)
+	{
+		pushItem(new PriorityQueueItem<T>(priority, std::move(data)));
+	}
+
+	template<typename T>
+	inline T BucketQueue<T>::pop()
+	{
+		if (windowSize_ == 0)
+		{
+			throw std::logic_error("BucketQueue<T>::pop: Priority queue is empty.");
+		}
+		ArrayList<PriorityQueueItem<T>*>* current = bucket(cursor_);
+		PriorityQueueItem<T>* item = current->removeAt(static_cast<int>(current->size()) - 1);
+		windowSize_--;
+		last_ = item->getPriority();
+		advance();
+		T result = std::move(item->accessData());
+		delete item;
+		return result;
+	}
+
+	template<typename T>
+	inline T& BucketQueue<T>::peek()
+	{
+		return findPeek("BucketQueue<T>::peek: Priority queue is empty.")->accessData();
+	}
+
+	template<typename T>
+	inline const T BucketQueue<T>::peek() const
+	{
+		return findPeek("BucketQueue<T>::peek: Priority queue is empty.")->accessData();
+	}
+
+	template<typename T>
+	inline int BucketQueue<T>::peekPriority() const
+	{
+		return findPeek("BucketQueue<T>::peekPriority: Priority queue is empty.")->getPriority();
+	}
+
+	template<typename T>
+	inline int BucketQueue<T>::lastPriority() const
+	{
+		return last_;
+	}
+
+	template<typename T>
+	inline void BucketQueue<T>::pushItem(PriorityQueueItem<T>* item)
+	{
+		const long long priority = item->getPriority();
+		if (checkMonotone_ && priority < last_)
+		{
+			delete item;
+			throw std::logic_error("BucketQueue<T>::push: Priority is lower than the last popped priority.");
+		}
+		// Okno nie je prazdne, kym front nie je prazdny, prazdny front zacne okno novou prioritou.
+		if (windowSize_ == 0)
+		{
+			base_ = priority;
+			cursor_ = priority;
+		}
+		else if (priority < base_)
+		{
+			moveBaseBack(priority);
+		}
+		if (priority < base_ + static_cast<long long>(buckets_->size()))
+		{
+			bucket(priority)->add(item);
+			windowSize_++;
+			if (priority < cursor_)
+			{
+				cursor_ = priority;
+			}
+		}
+		else
+		{
+			overflow_->add(item);
+		}
+	}
+
+	template<typename T>
+	inline ArrayList<PriorityQueueItem<T>*>* BucketQueue<T>::bucket(const long long priority) const
+	{
+		const long long count = static_cast<long long>(buckets_->size());
+		return (*buckets_)[static_cast<int>(((priority % count) + count) % count)];
+	}
+
+	template<typename T>
+	inline void BucketQueue<T>::moveBaseBack(const long long priority)
+	{
+		const long long end = base_ + static_cast<long long>(buckets_->size());
+		for (long long moved = std::max(priority + static_cast<long long>(buckets_->size()), base_); moved < end; moved++)
+		{
+			ArrayList<PriorityQueueItem<T>*>* movedBucket = bucket(moved);
+			for (int i = 0; i < static_cast<int>(movedBucket->size()); i++)
+			{
+				overflow_->add((*movedBucket)[i]);
+			}
+			windowSize_ -= movedBucket->size();
+			movedBucket->clear();
+		}
+		base_ = priority;
+	}
+
+	template<typename T>
+	inline void BucketQueue<T>::advance()
+	{
+		if (windowSize_ > 0)
+		{
+			while (bucket(cursor_)->size() == 0)
+			{
+				cursor_++;
+			}
+		}
+		else if (overflow_->size() > 0)
+		{
+			// Okno sa presunie na najmensiu prioritu mimo okna a prevezme vsetky prvky, ktore don padnu.
+			long long minimum = (*overflow_)[0]->getPriority();
+			for (int i = 1; i < static_cast<int>(overflow_->size()); i++)
+			{
+				if ((*overflow_)[i]->getPriority() < minimum)
+				{
+					minimum = (*overflow_)[i]->getPriority();
+				}
+			}
+			base_ = minimum;
+			cursor_ = minimum;
+			const long long end = base_ + static_cast<long long>(buckets_->size());
+			int kept = 0;
+			for (int i = 0; i < static_cast<int>(overflow_->size()); i++)
+			{
+				PriorityQueueItem<T>* item = (*overflow_)[i];
+				if (item->getPriority() < end)
+				{
+					bucket(item->getPriority())->add(item);
+					windowSize_++;
+				}
+				else
+				{
+					(*overflow_)[kept++] = item;
+				}
+			}
+			overflow_->removeRange(kept, static_cast<int>(overflow_->size()));
+		}
+	}
+
+	template<typename T>
+	inline PriorityQueueItem<T>* BucketQueue<T>::findPeek(const char* message) const
+	{
+		if (windowSize_ == 0)
+		{
+			throw std::logic_error(message);
+		}
+		const ArrayList<PriorityQueueItem<T>*>* current = bucket(cursor_);
+		return (*current)[static_cast<int>(current->size()) - 1];
+	}
+}
@@ -9,7 +9,7 @@ namespace structures
 	/// <summary> Prioritny front implementovany haldou. Implementujucim typom haldy je struktura ArrayList. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v prioritnom fronte. </typepram>
 	template<typename T>
-	class Heap : public PriorityQueueList<T>
+	class Heap final : public PriorityQueueList<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -35,11 +35,6 @@ namespace structures
 		/// <returns> Adresa, na ktorej sa tato halda nachadza po priradeni. </returns>
 		virtual Heap<T>& operator=(const Heap<T>& other);
 
-		/// <summary> Vlozi prvok s danou prioritou do haldy. </summary>
-		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
-		/// <param name = "data"> Vkladany prvok. </param>
-		void push(const int priority, const T& data) override;
-
 		/// <summary> Odstrani prvok s najvacsou prioritou z haldy. </summary>
 		/// <returns> Odstraneny prvok. </returns>
 		/// <exception cref="std::logic_error"> Vyhodena, ak je halda prazdna. </exception>  
@@ -51,6 +46,10 @@ namespace structures
 		/// <exception cref="std::logic_error"> Vyhodena, ak je ArrayList prazdny. </exception>  
 		int indexOfPeek() const override;
 
+		/// <summary> Zaradi vytvoreny prvok prioritneho frontu do haldy. </summary>
+		/// <param name = "item"> Zaradovany prvok. Prioritny front ho prebera do vlastnictva. </param>
+		void pushItem(PriorityQueueItem<T>* item) override;
+
 	private:
 		/// <summary> Vrati index v ArrayList-e, na ktorom by sa mal nachadzat otec daneho prvku. </summary>
 		/// <param name = "index"> Index prvku, ktoreho otca chceme vratit. </param>
@@ -99,10 +98,10 @@ namespace structures
 	}
 
 	template<typename T>
-	void Heap<T>::push(const int priority, const T& data)
+	void Heap<T>::pushItem(PriorityQueueItem<T>* item)
 	{
 		int index = PriorityQueueList<T>::list_->size();
-		PriorityQueueList<T>::list_->add(new PriorityQueueItem<T>(priority, data));
+		PriorityQueueList<T>::list_->add(item);
 		while ((*PriorityQueueList<T>::list_)[getParentIndex(index)]->getPriority() > (*PriorityQueueList<T>::list_)[index]->getPriority() && index > 0)
 		{
 			DSRoutines::swap((*PriorityQueueList<T>::list_)[getParentIndex(index)], (*PriorityQueueList<T>::list_)[index]);
@@ -115,14 +114,17 @@ namespace structures
 	{
 		DSRoutines::swap((*PriorityQueueList<T>::list_)[0], (*PriorityQueueList<T>::list_)[PriorityQueueList<T>::list_->size() - 1]);
 		PriorityQueueItem<T>* item = PriorityQueueList<T>::list_->removeAt(PriorityQueueList<T>::list_->size() - 1);
-		T data = item->accessData();
+		T data = std::move(item->accessData());
 		delete item;
 		item = nullptr;
 		int index = 0;
-		while (getGreaterSonIndex(index) < static_cast<int>(PriorityQueueList<T>::list_->size()) && (*PriorityQueueList<T>::list_)[index]->getPriority() > (*PriorityQueueList<T>::list_)[getGreaterSonIndex(index)]->getPriority())
+		int sonIndex = getGreaterSonIndex(index);
+		while (sonIndex < static_cast<int>(PriorityQueueList<T>::list_->size()) && (*PriorityQueueList<T>::list_)[index]->getPriority() > (*PriorityQueueList<T>::list_)[sonIndex]->getPriority())
 		{
-			DSRoutines::swap((*PriorityQueueList<T>::list_)[index], (*PriorityQueueList<T>::list_)[getGreaterSonIndex(index)]);
-			index = getGreaterSonIndex(index);
+			// Syn sa urci pred vymenou, po nej by pri rovnakych prioritach mohol vyjst druhy syn.
+			DSRoutines::swap((*PriorityQueueList<T>::list_)[index], (*PriorityQueueList<T>::list_)[sonIndex]);
+			index = sonIndex;
+			sonIndex = getGreaterSonIndex(index);
 		}
 		return data;
 	}
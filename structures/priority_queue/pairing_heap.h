@@ -0,0 +1,583 @@
+#pragma once
+
+#include "priority_queue.h"
+#include "../list/array_list.h"
+#include <stdexcept>
+
+namespace structures
+{
+	/// <summary> Prioritny front implementovany parovacou haldou (pairing heap). </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v prioritnom fronte. </typepram>
+	/// <remarks>
+	/// Halda je strom, v ktorom ma kazdy uzol vacsiu prioritu ako jeho synovia. Vlozenie a spojenie dvoch hald (meld)
+	/// iba spoji dva korene v case O(1), pop spoji synov odstraneneho korena dvojprechodovym parovanim v amortizovanom case O(log n).
+	/// Uzol vlozeny cez insert sa da neskor najst cez Handle a jeho prioritu zvysit (decreaseKey).
+	/// Uvolnene uzly si halda necha na dalsie vlozenia, aby sa pri striedani push a pop nealokovala pamat.
+	/// V ladiacom preklade (ak nie je definovane NDEBUG) decreaseKey a priorityOf overuju, ze odkaz patri tejto halde a jeho prvok v nej stale je.
+	/// </remarks>
+	template<typename T>
+	class PairingHeap final : public PriorityQueue<T>
+	{
+	private:
+		struct Node;
+
+	public:
+		/// <summary> Odkaz na prvok v halde. Platny, kym prvok nie je z haldy odstraneny a halda vymazana. </summary>
+		class Handle
+		{
+		public:
+			/// <summary> Konstruktor. Vytvori neplatny odkaz. </summary>
+#ifndef NDEBUG
+			Handle() : node_(nullptr), generation_(0) {}
+#else
+			Handle() : node_(nullptr) {}
+#endif
+
+			/// <summary> Zisti, ci odkaz odkazuje na prvok. </summary>
+			/// <returns> true, ak odkaz odkazuje na prvok. </returns>
+			bool isValid() const { return node_ != nullptr; }
+
+		private:
+			friend class PairingHeap<T>;
+
+			/// <summary> Konstruktor. </summary>
+			/// <param name = "node"> Uzol, na ktory odkaz odkazuje. </param>
+#ifndef NDEBUG
+			explicit Handle(Node* node) : node_(node), generation_(node->generation) {}
+#else
+			explicit Handle(Node* node) : node_(node) {}
+#endif
+
+			/// <summary> Uzol, na ktory odkaz odkazuje. </summary>
+			Node* node_;
+#ifndef NDEBUG
+			/// <summary> Generacia uzla pri vytvoreni odkazu. </summary>
+			unsigned generation_;
+#endif
+		};
+
+		/// <summary> Konstruktor. </summary>
+		PairingHeap();
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Parovacia halda, z ktorej sa prevezmu vlastnosti. </param>
+		/// <remarks> Odkazy na prvky druhej haldy neodkazuju na prvky kopie. </remarks>
+		PairingHeap(const PairingHeap<T>& other);
+
+		/// <summary> Destruktor. </summary>
+		~PairingHeap();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat parovacej haldy. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Prioritny front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak vstupny parameter nie je parovacia halda. </exception>
+		PriorityQueue<T>& operator=(const PriorityQueue<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Parovacia halda, z ktorej ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tato halda nachadza po priradeni. </returns>
+		PairingHeap<T>& operator=(const PairingHeap<T>& other);
+
+		/// <summary> Vrati pocet prvkov v parovacej halde. </summary>
+		/// <returns> Pocet prvkov v parovacej halde. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru parovacia halda obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru parovacia halda obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Vymaze obsah parovacej haldy a uvolni aj uzly v zalohe. </summary>
+		void clear() override;
+
+		/// <summary> Vlozi prvok s danou prioritou do parovacej haldy. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		void push(const int priority, const T& data) override;
+
+		/// <summary> Vlozi prvok s danou prioritou do parovacej haldy. Prvok presunie. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		void push(const int priority, T&& data) override;
+
+		/// <summary> Vlozi prvok s danou prioritou do parovacej haldy a vrati odkaz nan. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		/// <returns> Odkaz na vlozeny prvok, pouzitelny v decreaseKey. </returns>
+		Handle insert(const int priority, const T& data);
+
+		/// <summary> Vlozi prvok s danou prioritou do parovacej haldy a vrati odkaz nan. Prvok presunie. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		/// <returns> Odkaz na vlozeny prvok, pouzitelny v decreaseKey. </returns>
+		Handle insert(const int priority, T&& data);
+
+		/// <summary> Odstrani prvok s najvacsou prioritou z parovacej haldy. </summary>
+		/// <returns> Odstraneny prvok. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je parovacia halda prazdna. </exception>
+		T pop() override;
+
+		/// <summary> Vrati adresou prvok s najvacsou prioritou. </summary>
+		/// <returns> Adresa, na ktorej sa nachadza prvok s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je parovacia halda prazdna. </exception>
+		T& peek() override;
+
+		/// <summary> Vrati kopiu prvku s najvacsou prioritou. </summary>
+		/// <returns> Kopia prvku s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je parovacia halda prazdna. </exception>
+		const T peek() const override;
+
+		/// <summary> Vrati prioritu prvku s najvacsou prioritou. </summary>
+		/// <returns> Priorita prvku s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je parovacia halda prazdna. </exception>
+		int peekPriority() const override;
+
+		/// <summary> Zvysi prioritu prvku (zmensi jej hodnotu). </summary>
+		/// <param name = "handle"> Odkaz na prvok tejto haldy. </param>
+		/// <param name = "priority"> Nova priorita, nesmie byt vacsia ako aktualna hodnota. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je odkaz neplatny alebo by sa priorita znizila. V ladiacom preklade aj vtedy, ak odkaz nepatri tejto halde. </exception>
+		void decreaseKey(const Handle& handle, const int priority);
+
+		/// <summary> Vrati prioritu prvku, na ktory odkazuje odkaz. </summary>
+		/// <param name = "handle"> Odkaz na prvok tejto haldy. </param>
+		/// <returns> Priorita prvku. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je odkaz neplatny. V ladiacom preklade aj vtedy, ak odkaz nepatri tejto halde. </exception>
+		int priorityOf(const Handle& handle) const;
+
+		/// <summary> Presunie vsetky prvky druhej haldy do tejto v case O(1). Druha halda zostane prazdna. </summary>
+		/// <param name = "other"> Halda, ktorej prvky sa presunu. Odkazy na jej prvky zostanu platne v tejto halde. </param>
+		void meld(PairingHeap<T>& other);
+
+	private:
+		/// <summary> Uzol parovacej haldy. </summary>
+		struct Node
+		{
+			/// <summary> Priorita prvku. </summary>
+			int priority;
+			/// <summary> Data prvku. </summary>
+			T data;
+			/// <summary> Prvy syn, alebo nullptr. </summary>
+			Node* child;
+			/// <summary> Nasledujuci brat, alebo nullptr. U uzlov v zalohe nasledujuci uzol zalohy. </summary>
+			Node* sibling;
+			/// <summary> Predchadzajuci brat, u prveho syna otec, u korena nullptr. </summary>
+			Node* previous;
+#ifndef NDEBUG
+			/// <summary> Halda, v ktorej uzol je, u uzlov v zalohe nullptr. </summary>
+			const PairingHeap<T>* owner;
+			/// <summary> Pocet vrateni uzla do zalohy, odlisi odkaz na uz odstraneny prvok od odkazu na jeho nastupcu v tom istom uzle. </summary>
+			unsigned generation;
+#endif
+		};
+
+		/// <summary> Koren haldy, alebo nullptr, ak je halda prazdna. </summary>
+		Node* root_;
+		/// <summary> Pocet prvkov v halde. </summary>
+		size_t size_;
+		/// <summary> Zoznam uvolnenych uzlov na dalsie pouzitie. </summary>
+		Node* pool_;
+		/// <summary> Pocet uzlov v zalohe. </summary>
+		size_t poolSize_;
+
+	private:
+		/// <summary> Vytvori uzol, pouzije uzol zo zalohy, ak existuje. </summary>
+		/// <param name = "priority"> Priorita prvku. </param>
+		/// <param name = "data"> Data prvku, presunu sa. </param>
+		/// <returns> Uzol. </returns>
+		Node* acquireNode(const int priority, T&& data);
+
+		/// <summary> Vrati uzol do zalohy. </summary>
+		/// <param name = "node"> Uvolneny uzol. </param>
+		void releaseNode(Node* node);
+
+		/// <summary> Vlozi uzol do haldy. </summary>
+		/// <param name = "node"> Vkladany uzol. </param>
+		void insertNode(Node* node);
+
+		/// <summary> Spoji dva korene, koren s mensou prioritou sa stane prvym synom druheho. </summary>
+		/// <param name = "first"> Prvy koren. </param>
+		/// <param name = "second"> Druhy koren. </param>
+		/// <returns> Koren spojeneho stromu. </returns>
+		static Node* link(Node* first, Node* second);
+
+		/// <summary> Spoji zoznam bratov do jedneho stromu dvojprechodovym parovanim. </summary>
+		/// <param name = "first"> Prvy z bratov, alebo nullptr. </param>
+		/// <returns> Koren spojeneho stromu, alebo nullptr. </returns>
+		static Node* combineSiblings(Node* first);
+
+		/// <summary> Vrati uzol, na ktory odkazuje odkaz, ak je odkaz platny. </summary>
+		/// <param name = "handle"> Odkaz. </param>
+		/// <param name = "message"> Sprava vynimky. </param>
+		/// <returns> Uzol. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je odkaz neplatny, v ladiacom preklade aj ak nepatri tejto halde. </exception>
+		Node* checkedNode(const Handle& handle, const char* message) const;
+
+		/// <summary> Vrati koren, ak halda nie je prazdna. </summary>
+		/// <param name = "message"> Sprava vynimky. </param>
+		/// <returns> Koren haldy. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je parovacia halda prazdna. </exception>
+		Node* checkedRoot(const char* message) const;
+	};
+
+	template<typename T>
+	inline PairingHeap<T>::PairingHeap() :
+		PriorityQueue<T>(),
+		root_(nullptr),
+		size_(0),
+		pool_(nullptr),
+		poolSize_(0)
+	{
+	}
+
+	template<typename T>
+	inline PairingHeap<T>::PairingHeap(const PairingHeap<T>& other) :
+		PairingHeap<T>()
+	{
+		*this = other;
+	}
+
+	template<typename T>
+	inline PairingHeap<T>::~PairingHeap()
+	{
+		clear();
+	}
+
+	template<typename T>
+	inline Structure* PairingHeap<T>::clone() const
+	{
+		return new PairingHeap<T>(*this);
+	}
+
+	template<typename T>
+	inline PriorityQueue<T>& PairingHeap<T>::operator=(const PriorityQueue<T>& other)
+	{
+		return *this = dynamic_cast<const PairingHeap<T>&>(other);
+	}
+
+	template<typename T>
+	inline PairingHeap<T>& PairingHeap<T>::operator=(const PairingHeap<T>& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			if (other.root_ != nullptr)
+			{
+				ArrayList<const Node*> stack;
+				stack.add(other.root_);
+				while (stack.size() > 0)
+				{
+					const Node* node = stack.removeAt(static_cast<int>(stack.size()) - 1);
+					insertNode(acquireNode(node->priority, T(node->data)));
+					for (const Node* child = node->child; child != nullptr; child = child->sibling)
+					{
+						stack.add(child);
+					}
+				}
+			}
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline size_t PairingHeap<T>::size() const
+	{
+		return size_;
+	}
+
+	template<typename T>
+	inline MemoryUsage PairingHeap<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(PairingHeap<T>));
+		result.addAllocations(sizeof(Node), size_);
+		result.addAllocations(sizeof(Node), poolSize_, poolSize_ * sizeof(Node));
+		return result;
+	}
+
+	template<typename T>
+	inline void PairingHeap<T>::clear()
+	{
+		// Synov kazdeho uzla vlozi za neho do zoznamu bratov, zoznam sa tak prejde cely v case O(n).
+		Node* node = root_;
+		while (node != nullptr)
+		{
+			Node* child = node->child;
+			if (child != nullptr)
+			{
+				Node* last = child;
+				while (last->sibling != nullptr)
+				{
+					last = last->sibling;
+				}
+				last->sibling = node->sibling;
+				node->sibling = child;
+			}
+			Node* next = node->sibling;
+			delete node;
+			node = next;
+		}
+		root_ = nullptr;
+		size_ = 0;
+		while (pool_ != nullptr)
+		{
+			Node* next = pool_->sibling;
+			delete pool_;
+			pool_ = next;
+		}
+		poolSize_ = 0;
+	}
+
+	template<typename T>
+	inline void PairingHeap<T>::push(const int priority, const T& data)
+	{
+		insertNode(acquireNode(priority, T(data)));
+	}
+
+	template<typename T>
+	inline void PairingHeap<T>::push(const int priority, T&& data)
+	{
+		insertNode(acquireNode(priority, std::move(data)));
+	}
+
+	template<typename T>
+	inline typename PairingHeap<T>::Handle PairingHeap<T>::insert(const int priority, const T& data)
+	{
+		Node* node = acquireNode(priority, T(data));
+		insertNode(node);
+		return Handle(node);
+	}
+
+	template<typename T>
+	inline typename PairingHeap<T>::Handle PairingHeap<T>::insert(const int priority, T&& data)
+	{
+		Node* node = acquireNode(priority, std::move(data));
+		insertNode(node);
+		return Handle(node);
+	}
+
+	template<typename T>
+	inline T PairingHeap<T>::pop()
+	{
+		Node* root = checkedRoot("PairingHeap<T>::pop: Priority queue is empty.");
+		root_ = combineSiblings(root->child);
+		size_--;
+		T data = std::move(root->data);
+		releaseNode(root);
+		return data;
+	}
+
+	template<typename T>
+	inline T& PairingHeap<T>::peek()
+	{
+		return checkedRoot("PairingHeap<T>::peek: Priority queue is empty.")->data;
+	}
+
+	template<typename T>
+	inline const T PairingHeap<T>::peek() const
+	{
+		return checkedRoot("PairingHeap<T>::peek: Priority queue is empty.")->data;
+	}
+
+	template<typename T>
+	inline int PairingHeap<T>::peekPriority() const
+	{
+		return checkedRoot("PairingHeap<T>::peekPriority: Priority queue is empty.")->priority;
+	}
+
+	template<typename T>
+	inline void PairingHeap<T>::decreaseKey(const Handle& handle, const int priority)
+	{
+		Node* node = checkedNode(handle, "PairingHeap<T>::decreaseKey: Invalid handle.");
+		if (priority > node->priority)
+		{
+			throw std::logic_error("PairingHeap<T>::decreaseKey: New priority is lower than the current one.");
+		}
+		node->priority = priority;
+		if (node == root_)
+		{
+			return;
+		}
+		// Uzol sa so svojim podstromom odpoji od otca a spoji s korenom.
+		if (node->previous->child == node)
+		{
+			node->previous->child = node->sibling;
+		}
+		else
+		{
+			node->previous->sibling = node->sibling;
+		}
+		if (node->sibling != nullptr)
+		{
+			node->sibling->previous = node->previous;
+		}
+		node->sibling = nullptr;
+		node->previous = nullptr;
+		root_ = link(root_, node);
+	}
+
+	template<typename T>
+	inline int PairingHeap<T>::priorityOf(const Handle& handle) const
+	{
+		return checkedNode(handle, "PairingHeap<T>::priorityOf: Invalid handle.")->priority;
+	}
+
+	template<typename T>
+	inline void PairingHeap<T>::meld(PairingHeap<T>& other)
+	{
+		if (this != &other && other.root_ != nullptr)
+		{
+#ifndef NDEBUG
+			// Uzly druhej haldy prejdu pod tuto, ich odkazy zostanu platne. Prechod stoji O(n) iba v ladiacom preklade.
+			ArrayList<Node*> stack;
+			stack.add(other.root_);
+			while (stack.size() > 0)
+			{
+				Node* node = stack.removeAt(static_cast<int>(stack.size()) - 1);
+				node->owner = this;
+				for (Node* child = node->child; child != nullptr; child = child->sibling)
+				{
+					stack.add(child);
+				}
+			}
+#endif
+			root_ = root_ != nullptr ? link(root_, other.root_) : other.root_;
+			size_ += other.size_;
+			other.root_ = nullptr;
+			other.size_ = 0;
+		}
+	}
+
+	template<typename T>
+	inline typename PairingHeap<T>::Node* PairingHeap<T>::acquireNode(const int priority, T&& data)
+	{
+		Node* node = pool_;
+		if (node != nullptr)
+		{
+			pool_ = node->sibling;
+			poolSize_--;
+			node->data = std::move(data);
+		}
+		else
+		{
+#ifndef NDEBUG
+			node = new Node{ priority, std::move(data), nullptr, nullptr, nullptr, nullptr, 0 };
+#else
+			node = new Node{ priority, std::move(data), nullptr, nullptr, nullptr };
+#endif
+		}
+#ifndef NDEBUG
+		node->owner = this;
+#endif
+		node->priority = priority;
+		node->child = nullptr;
+		node->sibling = nullptr;
+		node->previous = nullptr;
+		return node;
+	}
+
+	template<typename T>
+	inline void PairingHeap<T>::releaseNode(Node* node)
+	{
+#ifndef NDEBUG
+		node->owner = nullptr;
+		node->generation++;
+#endif
+		node->sibling = pool_;
+		pool_ = node;
+		poolSize_++;
+	}
+
+	template<typename T>
+	inline void PairingHeap<T>::insertNode(Node* node)
+	{
+		root_ = root_ != nullptr ? link(root_, node) : node;
+		size_++;
+	}
+
+	template<typename T>
+	inline typename PairingHeap<T>::Node* PairingHeap<T>::link(Node* first, Node* second)
+	{
+		if (second->priority < first->priority)
+		{
+			DSRoutines::swap(first, second);
+		}
+		second->sibling = first->child;
+		if (first->child != nullptr)
+		{
+			first->child->previous = second;
+		}
+		second->previous = first;
+		first->child = second;
+		return first;
+	}
+
+	template<typename T>
+	inline typename PairingHeap<T>::Node* PairingHeap<T>::combineSiblings(Node* first)
+	{
+		if (first == nullptr)
+		{
+			return nullptr;
+		}
+		// Prvy prechod: spoji dvojice zlava doprava, vysledky zretazi cez sibling v opacnom poradi.
+		Node* pairs = nullptr;
+		Node* node = first;
+		while (node != nullptr)
+		{
+			Node* second = node->sibling;
+			Node* next = second != nullptr ? second->sibling : nullptr;
+			node->sibling = nullptr;
+			node->previous = nullptr;
+			if (second != nullptr)
+			{
+				second->sibling = nullptr;
+				second->previous = nullptr;
+				node = link(node, second);
+			}
+			node->sibling = pairs;
+			pairs = node;
+			node = next;
+		}
+		// Druhy prechod: spoji dvojice sprava dolava do jedneho stromu.
+		Node* result = pairs;
+		pairs = pairs->sibling;
+		result->sibling = nullptr;
+		while (pairs != nullptr)
+		{
+			Node* next = pairs->sibling;
+			pairs->sibling = nullptr;
+			result = link(result, pairs);
+			pairs = next;
+		}
+		result->previous = nullptr;
+		return result;
+	}
+
+	template<typename T>
+	inline typename PairingHeap<T>::Node* PairingHeap<T>::checkedNode(const Handle& handle, const char* message) const
+	{
+		Node* node = handle.node_;
+		if (node == nullptr)
+		{
+			throw std::logic_error(message);
+		}
+#ifndef NDEBUG
+		if (node->owner != this || node->generation != handle.generation_)
+		{
+			throw std::logic_error(message);
+		}
+#endif
+		return node;
+	}
+
+	template<typename T>
+	inline typename PairingHeap<T>::Node* PairingHeap<T>::checkedRoot(const char* message) const
+	{
+		if (root_ == nullptr)
+		{
+			throw std::logic_error(message);
+		}
+		return root_;
+	}
+}
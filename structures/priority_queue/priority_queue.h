@@ -13,7 +13,12 @@ namespace structures
 		/// <summary> Konstruktor. </summary>
 		/// <param name = "priority"> Priorita dat uchovavanych v prvku. </param>
 		/// <param name = "data"> Data, ktore uchovava. </param>
-		PriorityQueueItem(int priority, T data);
+		PriorityQueueItem(int priority, const T& data);
+
+		/// <summary> Konstruktor. Data do prvku presunie. </summary>
+		/// <param name = "priority"> Priorita dat uchovavanych v prvku. </param>
+		/// <param name = "data"> Data, ktore uchovava. </param>
+		PriorityQueueItem(int priority, T&& data);
 
 		/// <summary> Kopirovaci konstruktor. </summary>
 		/// <param name = "other"> Prvok prioritneho frontu, z ktoreho sa prevezmu vlastnosti. </param>
@@ -21,7 +26,7 @@ namespace structures
 
 		/// <summary> Getter vracajuci hodnotu priority daneho prvku. </summary>
 		/// <returns> Priorita daneho prvku. </returns>
-		int getPriority();
+		int getPriority() const;
 
 	private:
 		/// <summary> Priorita daneho prvku. </summary>
@@ -62,6 +67,18 @@ namespace structures
 		/// <param name = "data"> Vkladany prvok. </param>
 		virtual void push(const int priority, const T& data) = 0;
 
+		/// <summary> Vlozi prvok s danou prioritou do prioritneho frontu. Prvok do prioritneho frontu presunie. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		virtual void push(const int priority, T&& data) = 0;
+
+		/// <summary> Vytvori prvok z argumentov a vlozi ho s danou prioritou do prioritneho frontu. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "args"> Argumenty konstruktora vkladaneho prvku. </param>
+		/// <remarks> Prvok sa vytvori raz a do prioritneho frontu sa presunie, nekopiruje sa. </remarks>
+		template<typename... Args>
+		void emplace(const int priority, Args&&... args);
+
 		/// <summary> Odstrani prvok s najvacsou prioritou z prioritneho frontu. </summary>
 		/// <returns> Odstraneny prvok. </returns>
 		/// <exception cref="std::logic_error"> Vyhodena, ak je prioritny front prazdny. </exception>  
@@ -91,12 +108,19 @@ namespace structures
 	};
 
 	template<typename T>
-	inline PriorityQueueItem<T>::PriorityQueueItem(int priority, T data) :
+	inline PriorityQueueItem<T>::PriorityQueueItem(int priority, const T& data) :
 		DataItem<T>(data),
 		priority_(priority)
 	{
 	}
 
+	template<typename T>
+	inline PriorityQueueItem<T>::PriorityQueueItem(int priority, T&& data) :
+		DataItem<T>(std::move(data)),
+		priority_(priority)
+	{
+	}
+
 	template<typename T>
 	inline PriorityQueueItem<T>::PriorityQueueItem(const PriorityQueueItem<T>& other) :
 		DataItem<T>(other),
@@ -105,7 +129,7 @@ namespace structures
 	}
 
 	template<typename T>
-	inline int PriorityQueueItem<T>::getPriority()
+	inline int PriorityQueueItem<T>::getPriority() const
 	{
 		return priority_;
 	}
@@ -119,6 +143,13 @@ namespace structures
 		return *this;
 	}
 
+	template<typename T>
+	template<typename... Args>
+	inline void PriorityQueue<T>::emplace(const int priority, Args&&... args)
+	{
+		this->push(priority, T(std::forward<Args>(args)...));
+	}
+
 	template<typename T>
 	inline PriorityQueue<T>::PriorityQueue() :
 		Structure()
@@ -0,0 +1,479 @@
+#pragma once
+
+#include "priority_queue.h"
+#include "../array/array.h"
+#include <stdexcept>
+#include <algorithm>
+
+namespace structures
+{
+	/// <summary> Dvojvrstvovy prioritny front. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v prioritnom fronte. </typepram>
+	/// <typeparam name = "K"> Kapacita hornej vrstvy a velkost bloku spodnej vrstvy. </typepram>
+	/// <remarks>
+	/// Horna vrstva je mala binarna halda s najviac K prvkami, ktora sa zmesti do cache procesora. Ked sa zaplni, utriedi sa
+	/// a ako jeden blok sa presunie do spodnej vrstvy. Spodna vrstva je halda blokov usporiadana podla najmensej priority bloku,
+	/// kazdy blok je utriedeny zostupne, takze jeho najmensi prvok je na konci. Pop porovna vrchol hornej vrstvy s najlepsim blokom.
+	/// Priority su ulozene priamo v haldach vedla smernika na prvok, porovnania preto nemusia citat prvky roztrusene v pamati.
+	/// Push trva O(log K), pop O(log K + log(n / K)).
+	/// </remarks>
+	template<typename T, int K = 1024>
+	class PriorityQueueDoubleLayer final : public PriorityQueue<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		PriorityQueueDoubleLayer();
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Dvojvrstvovy prioritny front, z ktoreho sa prevezmu vlastnosti. </param>
+		PriorityQueueDoubleLayer(const PriorityQueueDoubleLayer<T, K>& other);
+
+		/// <summary> Destruktor. </summary>
+		~PriorityQueueDoubleLayer();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat dvojvrstvoveho prioritneho frontu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Prioritny front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak vstupny parameter nie je dvojvrstvovy prioritny front. </exception>
+		PriorityQueue<T>& operator=(const PriorityQueue<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Dvojvrstvovy prioritny front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
+		PriorityQueueDoubleLayer<T, K>& operator=(const PriorityQueueDoubleLayer<T, K>& other);
+
+		/// <summary> Vrati pocet prvkov v dvojvrstvovom prioritnom fronte. </summary>
+		/// <returns> Pocet prvkov v dvojvrstvovom prioritnom fronte. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru dvojvrstvovy prioritny front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru dvojvrstvovy prioritny front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Vymaze obsah dvojvrstvoveho prioritneho frontu. </summary>
+		void clear() override;
+
+		/// <summary> Vlozi prvok s danou prioritou do dvojvrstvoveho prioritneho frontu. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		void push(const int priority, const T& data) override;
+
+		/// <summary> Vlozi prvok s danou prioritou do dvojvrstvoveho prioritneho frontu. Prvok presunie. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		void push(const int priority, T&& data) override;
+
+		/// <summary> Odstrani prvok s najvacsou prioritou z dvojvrstvoveho prioritneho frontu. </summary>
+		/// <returns> Odstraneny prvok. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je dvojvrstvovy prioritny front prazdny. </exception>
+		T pop() override;
+
+		/// <summary> Vrati adresou prvok s najvacsou prioritou. </summary>
+		/// <returns> Adresa, na ktorej sa nachadza prvok s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je dvojvrstvovy prioritny front prazdny. </exception>
+		T& peek() override;
+
+		/// <summary> Vrati kopiu prvku s najvacsou prioritou. </summary>
+		/// <returns> Kopia prvku s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je dvojvrstvovy prioritny front prazdny. </exception>
+		const T peek() const override;
+
+		/// <summary> Vrati prioritu prvku s najvacsou prioritou. </summary>
+		/// <returns> Priorita prvku s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je dvojvrstvovy prioritny front prazdny. </exception>
+		int peekPriority() const override;
+
+	private:
+		/// <summary> Zaznam v halde, priorita je ulozena priamo v nom. </summary>
+		struct Entry
+		{
+			/// <summary> Priorita prvku, alebo najmensia priorita bloku. </summary>
+			int priority;
+			/// <summary> Prvok, alebo blok. </summary>
+			void* target;
+		};
+
+		/// <summary> Blok spodnej vrstvy. </summary>
+		struct Block
+		{
+			/// <summary> Zaznamy bloku utriedene zostupne podla priority. </summary>
+			Entry entries[K];
+			/// <summary> Pocet zaznamov v bloku, najmensi je na indexe count - 1. </summary>
+			int count;
+		};
+
+		/// <summary> Halda hornej vrstvy. </summary>
+		Array<Entry>* top_;
+		/// <summary> Pocet prvkov v hornej vrstve. </summary>
+		int topSize_;
+		/// <summary> Halda blokov spodnej vrstvy, priorita zaznamu je najmensia priorita bloku. </summary>
+		Array<Entry>* blocks_;
+		/// <summary> Pocet blokov v spodnej vrstve. </summary>
+		int blockCount_;
+		/// <summary> Uvolneny blok odlozeny na dalsie pouzitie, alebo nullptr. </summary>
+		Block* spare_;
+		/// <summary> Pocet prvkov v prioritnom fronte. </summary>
+		size_t size_;
+
+	private:
+		/// <summary> Zaradi vytvoreny prvok do hornej vrstvy, plnu hornu vrstvu najprv presunie do spodnej. </summary>
+		/// <param name = "item"> Zaradovany prvok. Prioritny front ho prebera do vlastnictva. </param>
+		void pushItem(PriorityQueueItem<T>* item);
+
+		/// <summary> Presunie plnu hornu vrstvu ako jeden blok do spodnej vrstvy. </summary>
+		void flushTop();
+
+		/// <summary> Vrati prvok s najvacsou prioritou. </summary>
+		/// <param name = "message"> Sprava vynimky. </param>
+		/// <returns> Prvok s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je prioritny front prazdny. </exception>
+		PriorityQueueItem<T>* findPeek(const char* message) const;
+
+		/// <summary> Vrati, ci je prvok s najvacsou prioritou v hornej vrstve. </summary>
+		/// <returns> true, ak je prvok s najvacsou prioritou v hornej vrstve. </returns>
+		bool peekIsOnTop() const;
+
+		/// <summary> Vytvori kopiu bloku, kopiruje aj prvky. </summary>
+		/// <param name = "block"> Kopirovany blok. </param>
+		/// <returns> Kopia bloku. </returns>
+		Block* copyBlock(const Block* block);
+
+		/// <summary> Posunie zaznam v halde smerom ku korenu. </summary>
+		/// <param name = "heap"> Zaznamy haldy. </param>
+		/// <param name = "index"> Index posuvaneho zaznamu. </param>
+		static void siftUp(Entry* heap, int index);
+
+		/// <summary> Posunie zaznam v halde smerom k listom. </summary>
+		/// <param name = "heap"> Zaznamy haldy. </param>
+		/// <param name = "size"> Pocet zaznamov v halde. </param>
+		/// <param name = "index"> Index posuvaneho zaznamu. </param>
+		static void siftDown(Entry* heap, const int size, int index);
+	};
+
+	template<typename T, int K>
+	inline PriorityQueueDoubleLayer<T, K>::PriorityQueueDoubleLayer() :
+		PriorityQueue<T>(),
+		top_(new Array<Entry>(K)),
+		topSize_(0),
+		blocks_(new Array<Entry>(4)),
+		blockCount_(0),
+		spare_(nullptr),
+		size_(0)
+	{
+	}
+
+	template<typename T, int K>
+	inline PriorityQueueDoubleLayer<T, K>::PriorityQueueDoubleLayer(const PriorityQueueDoubleLayer<T, K>& other) :
+		PriorityQueueDoubleLayer<T, K>()
+	{
+		*this = other;
+	}
+
+	template<typename T, int K>
+	inline PriorityQueueDoubleLayer<T, K>::~PriorityQueueDoubleLayer()
+	{
+		clear();
+		delete spare_;
+		spare_ = nullptr;
+		delete top_;
+		top_ = nullptr;
+		delete blocks_;
+		blocks_ = nullptr;
+	}
+
+	template<typename T, int K>
+	inline Structure* PriorityQueueDoubleLayer<T, K>::clone() const
+	{
+		return new PriorityQueueDoubleLayer<T, K>(*this);
+	}
+
+	template<typename T, int K>
+	inline PriorityQueue<T>& PriorityQueueDoubleLayer<T, K>::operator=(const PriorityQueue<T>& other)
+	{
+		return *this = dynamic_cast<const PriorityQueueDoubleLayer<T, K>&>(other);
+	}
+
+	template<typename T, int K>
+	inline PriorityQueueDoubleLayer<T, K>& PriorityQueueDoubleLayer<T, K>::operator=(const PriorityQueueDoubleLayer<T, K>& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			const Entry* otherTop = other.top_->data();
+			Entry* top = top_->data();
+			for (int i = 0; i < other.topSize_; i++)
+			{
+				top[i].priority = otherTop[i].priority;
+				top[i].target = new PriorityQueueItem<T>(*static_cast<PriorityQueueItem<T>*>(otherTop[i].target));
+			}
+			topSize_ = other.topSize_;
+			if (blocks_->size() < other.blocks_->size())
+			{
+				delete blocks_;
+				blocks_ = new Array<Entry>(other.blocks_->size());
+			}
+			const Entry* otherBlocks = other.blocks_->data();
+			Entry* blocks = blocks_->data();
+			for (int i = 0; i < other.blockCount_; i++)
+			{
+				blocks[i].priority = otherBlocks[i].priority;
+				blocks[i].target = copyBlock(static_cast<const Block*>(otherBlocks[i].target));
+			}
+			blockCount_ = other.blockCount_;
+			size_ = other.size_;
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline size_t PriorityQueueDoubleLayer<T, K>::size() const
+	{
+		return size_;
+	}
+
+	template<typename T, int K>
+	inline MemoryUsage PriorityQueueDoubleLayer<T, K>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(PriorityQueueDoubleLayer<T, K>));
+		result.addAllocation(top_->memoryUsage());
+		result.bytesWasted += (K - topSize_) * sizeof(Entry);
+		result.addAllocation(blocks_->memoryUsage());
+		result.bytesWasted += (blocks_->size() - blockCount_) * sizeof(Entry);
+		const Entry* blocks = blocks_->data();
+		for (int i = 0; i < blockCount_; i++)
+		{
+			result.addAllocations(sizeof(Block), 1, (K - static_cast<const Block*>(blocks[i].target)->count) * sizeof(Entry));
+		}
+		if (spare_ != nullptr)
+		{
+			result.addAllocations(sizeof(Block), 1, sizeof(Block));
+		}
+		result.addAllocations(sizeof(PriorityQueueItem<T>), size_);
+		return result;
+	}
+
+	template<typename T, int K>
+	inline void PriorityQueueDoubleLayer<T, K>::clear()
+	{
+		Entry* top = top_->data();
+		for (int i = 0; i < topSize_; i++)
+		{
+			delete static_cast<PriorityQueueItem<T>*>(top[i].target);
+		}
+		topSize_ = 0;
+		Entry* blocks = blocks_->data();
+		for (int i = 0; i < blockCount_; i++)
+		{
+			Block* block = static_cast<Block*>(blocks[i].target);
+			for (int j = 0; j < block->count; j++)
+			{
+				delete static_cast<PriorityQueueItem<T>*>(block->entries[j].target);
+			}
+			if (spare_ == nullptr)
+			{
+				spare_ = block;
+			}
+			else
+			{
+				delete block;
+			}
+		}
+		blockCount_ = 0;
+		size_ = 0;
+	}
+
+	template<typename T, int K>
+	inline void PriorityQueueDoubleLayer<T, K>::push(const int priority, const T& data)
+	{
+		pushItem(new PriorityQueueItem<T>(priority, data));
+	}
+
+	template<typename T, int K>
+	inline void PriorityQueueDoubleLayer<T, K>::push(const int priority, T&& data)
+	{
+		pushItem(new PriorityQueueItem<T>(priority, std::move(data)));
+	}
+
+	template<typename T, int K>
+	inline T PriorityQueueDoubleLayer<T, K>::pop()
+	{
+		if (size_ == 0)
+		{
+			throw std::logic_error("PriorityQueueDoubleLayer<T, K>::pop: Priority queue is empty.");
+		}
+		PriorityQueueItem<T>* item;
+		if (peekIsOnTop())
+		{
+			Entry* top = top_->data();
+			item = static_cast<PriorityQueueItem<T>*>(top[0].target);
+			top[0] = top[--topSize_];
+			siftDown(top, topSize_, 0);
+		}
+		else
+		{
+			Entry* blocks = blocks_->data();
+			Block* block = static_cast<Block*>(blocks[0].target);
+			item = static_cast<PriorityQueueItem<T>*>(block->entries[--block->count].target);
+			if (block->count > 0)
+			{
+				blocks[0].priority = block->entries[block->count - 1].priority;
+			}
+			else
+			{
+				if (spare_ == nullptr)
+				{
+					spare_ = block;
+				}
+				else
+				{
+					delete block;
+				}
+				blocks[0] = blocks[--blockCount_];
+			}
+			siftDown(blocks, blockCount_, 0);
+		}
+		size_--;
+		T data = std::move(item->accessData());
+		delete item;
+		return data;
+	}
+
+	template<typename T, int K>
+	inline T& PriorityQueueDoubleLayer<T, K>::peek()
+	{
+		return findPeek("PriorityQueueDoubleLayer<T, K>::peek: Priority queue is empty.")->accessData();
+	}
+
+	template<typename T, int K>
+	inline const T PriorityQueueDoubleLayer<T, K>::peek() const
+	{
+		return findPeek("PriorityQueueDoubleLayer<T, K>::peek: Priority queue is empty.")->accessData();
+	}
+
+	template<typename T, int K>
+	inline int PriorityQueueDoubleLayer<T, K>::peekPriority() const
+	{
+		return findPeek("PriorityQueueDoubleLayer<T, K>::peekPriority: Priority queue is empty.")->getPriority();
+	}
+
+	template<typename T, int K>
+	inline void PriorityQueueDoubleLayer<T, K>::pushItem(PriorityQueueItem<T>* item)
+	{
+		if (topSize_ == K)
+		{
+			flushTop();
+		}
+		Entry* top = top_->data();
+		top[topSize_].priority = item->getPriority();
+		top[topSize_].target = item;
+		siftUp(top, topSize_++);
+		size_++;
+	}
+
+	template<typename T, int K>
+	inline void PriorityQueueDoubleLayer<T, K>::flushTop()
+	{
+		Block* block = spare_;
+		if (block != nullptr)
+		{
+			spare_ = nullptr;
+		}
+		else
+		{
+			block = new Block;
+		}
+		Entry* top = top_->data();
+		// Halda je uz ciastocne usporiadana, triedenie celeho bloku je aj tak len O(K log K) raz za K pushov.
+		std::copy(top, top + topSize_, block->entries);
+		std::sort(block->entries, block->entries + topSize_, [](const Entry& a, const Entry& b) { return a.priority > b.priority; });
+		block->count = topSize_;
+		topSize_ = 0;
+		if (blockCount_ == static_cast<int>(blocks_->size()))
+		{
+			Array<Entry>* newBlocks = new Array<Entry>(2 * blocks_->size());
+			Array<Entry>::copy(*blocks_, 0, *newBlocks, 0, blockCount_);
+			delete blocks_;
+			blocks_ = newBlocks;
+		}
+		Entry* blocks = blocks_->data();
+		blocks[blockCount_].priority = block->entries[block->count - 1].priority;
+		blocks[blockCount_].target = block;
+		siftUp(blocks, blockCount_++);
+	}
+
+	template<typename T, int K>
+	inline PriorityQueueItem<T>* PriorityQueueDoubleLayer<T, K>::findPeek(const char* message) const
+	{
+		if (size_ == 0)
+		{
+			throw std::logic_error(message);
+		}
+		if (peekIsOnTop())
+		{
+			return static_cast<PriorityQueueItem<T>*>(top_->data()[0].target);
+		}
+		const Block* block = static_cast<const Block*>(blocks_->data()[0].target);
+		return static_cast<PriorityQueueItem<T>*>(block->entries[block->count - 1].target);
+	}
+
+	template<typename T, int K>
+	inline bool PriorityQueueDoubleLayer<T, K>::peekIsOnTop() const
+	{
+		return blockCount_ == 0 || (topSize_ > 0 && top_->data()[0].priority <= blocks_->data()[0].priority);
+	}
+
+	template<typename T, int K>
+	inline typename PriorityQueueDoubleLayer<T, K>::Block* PriorityQueueDoubleLayer<T, K>::copyBlock(const Block* block)
+	{
+		Block* result = new Block;
+		for (int i = 0; i < block->count; i++)
+		{
+			result->entries[i].priority = block->entries[i].priority;
+			result->entries[i].target = new PriorityQueueItem<T>(*static_cast<const PriorityQueueItem<T>*>(block->entries[i].target));
+		}
+		result->count = block->count;
+		return result;
+	}
+
+	template<typename T, int K>
+	inline void PriorityQueueDoubleLayer<T, K>::siftUp(Entry* heap, int index)
+	{
+		const Entry entry = heap[index];
+		while (index > 0 && heap[(index - 1) / 2].priority > entry.priority)
+		{
+			heap[index] = heap[(index - 1) / 2];
+			index = (index - 1) / 2;
+		}
+		heap[index] = entry;
+	}
+
+	template<typename T, int K>
+	inline void PriorityQueueDoubleLayer<T, K>::siftDown(Entry* heap, const int size, int index)
+	{
+		if (size == 0)
+		{
+			return;
+		}
+		const Entry entry = heap[index];
+		int son = 2 * index + 1;
+		while (son < size)
+		{
+			if (son + 1 < size && heap[son + 1].priority < heap[son].priority)
+			{
+				son++;
+			}
+			if (heap[son].priority >= entry.priority)
+			{
+				break;
+			}
+			heap[index] = heap[son];
+			index = son;
+			son = 2 * index + 1;
+		}
+		heap[index] = entry;
+	}
+}
@@ -8,7 +8,7 @@ namespace structures
 	/// <summary> Prioritny front implementovany utriednym ArrayList-om s obmedzenou kapacitou. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v prioritnom fronte. </typepram>
 	template<typename T>
-	class PriorityQueueLimitedSortedArrayList : public PriorityQueueSortedArrayList<T>
+	class PriorityQueueLimitedSortedArrayList final : public PriorityQueueSortedArrayList<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -22,6 +22,10 @@ namespace structures
 		/// <returns> Ukazovatel na klon struktury. </returns>
 		Structure* clone() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru prioritny front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru prioritny front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Prioritny front implementovany utriedenym ArrayList-om, z ktoreho ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
@@ -34,21 +38,15 @@ namespace structures
 		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
 		virtual PriorityQueueLimitedSortedArrayList<T>& operator=(const PriorityQueueLimitedSortedArrayList<T>& other);
 
-		/// <summary> Vlozi prvok s danou prioritou do prioritneho frontu implementovaneho utriednym ArrayList-om s obmedzenou kapacitou. </summary>
-		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
-		/// <param name = "data"> Vkladany prvok. </param>
-		/// <exception cref="std::logic_error"> Vyhodena, ak je prioritny front plny. </exception>  
-		void push(const int priority, const T& data) override;
-		
 		/// <summary>
-		///  Vlozi prvok s danou prioritou do prioritneho frontu implementovaneho utriednym ArrayList-om s obmedzenou kapacitou.
+		///  Zaradi prvok do prioritneho frontu implementovaneho utriednym ArrayList-om s obmedzenou kapacitou.
 		///  V pripade, ze je prioritny front plny, odstrani polozku s najmensou prioritou z prioritneho frontu a vrati smernik na nu. 
 		///  V opacnom pripade vrati nullptr. 
 		/// </summary>
-		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
-		/// <param name = "data"> Vkladany prvok. </param>
+		/// <param name = "item"> Zaradovany prvok. Prioritny front ho prebera do vlastnictva. </param>
 		/// <returns> Smernik na odstranenu polozku alebo nullptr. </returns>
-		PriorityQueueItem<T>* pushAndRemove(const int priority, const T& data);
+		/// <remarks> Prvok sa nekopiruje, preto ho mozno presuvat medzi prioritnymi frontami. </remarks>
+		PriorityQueueItem<T>* pushAndRemove(PriorityQueueItem<T>* item);
 
 		/// <summary> Vrati najmensiu prioritu nachadzajucu sa v prioritnom fronte. </summary>
 		/// <returns> Najmensiu priorita nachadzajuca sa v prioritnom fronte. </returns>
@@ -63,6 +61,19 @@ namespace structures
 		/// <returns> true, ak sa kapacitu podarilo zmenit, false inak. </returns>
 		bool trySetCapacity(size_t capacity);
 
+		/// <summary> Naplni prazdny prioritny front prvkami, ktore su uz usporiadane od najmensej po najvacsiu prioritu. </summary>
+		/// <param name = "items"> Pole prvkov. Prioritny front ich prebera do vlastnictva. </param>
+		/// <param name = "count"> Pocet prvkov, musi byt mensi ako kapacita. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak prioritny front nie je prazdny alebo sa prvky do neho nezmestia. </exception>
+		/// <remarks> Prvky sa pridavaju na koniec zoznamu, bez hladania miesta pre kazdy prvok. </remarks>
+		void assignSorted(PriorityQueueItem<T>* const* items, const size_t count);
+
+	protected:
+		/// <summary> Zaradi vytvoreny prvok do prioritneho frontu implementovaneho utriednym ArrayList-om s obmedzenou kapacitou. </summary>
+		/// <param name = "item"> Zaradovany prvok. Prioritny front ho prebera do vlastnictva. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je prioritny front plny. </exception>  
+		void pushItem(PriorityQueueItem<T>* item) override;
+
 	private:
 		/// <summary> Kapacita prioritneho frontu. </summary>
 		size_t capacity_;
@@ -88,6 +99,14 @@ namespace structures
 		return new PriorityQueueLimitedSortedArrayList<T>(*this);
 	}
 
+	template<typename T>
+	inline MemoryUsage PriorityQueueLimitedSortedArrayList<T>::memoryUsage() const
+	{
+		MemoryUsage result = PriorityQueueSortedArrayList<T>::memoryUsage();
+		result.bytesOwned += sizeof(PriorityQueueLimitedSortedArrayList<T>) - sizeof(PriorityQueueSortedArrayList<T>);
+		return result;
+	}
+
 	template<typename T>
 	inline PriorityQueueSortedArrayList<T>& PriorityQueueLimitedSortedArrayList<T>::operator=(const PriorityQueueSortedArrayList<T>& other)
 	{
@@ -106,22 +125,23 @@ namespace structures
 	}
 
 	template<typename T>
-	void PriorityQueueLimitedSortedArrayList<T>::push(const int priority, const T & data)
+	void PriorityQueueLimitedSortedArrayList<T>::pushItem(PriorityQueueItem<T>* item)
 	{
 		if (PriorityQueueList<T>::list_->size() < capacity_)
 		{
-			PriorityQueueSortedArrayList<T>::push(priority, data);
+			PriorityQueueSortedArrayList<T>::pushItem(item);
 		}
 		else
 		{
+			delete item;
 			throw std::logic_error("PriorityQueueLimitedSortedArrayList<T>::push: Priority queue is full.");
 		}
 	}
 
 	template<typename T>
-	inline PriorityQueueItem<T>* PriorityQueueLimitedSortedArrayList<T>::pushAndRemove(const int priority, const T & data)
+	inline PriorityQueueItem<T>* PriorityQueueLimitedSortedArrayList<T>::pushAndRemove(PriorityQueueItem<T>* item)
 	{
-		PriorityQueueSortedArrayList<T>::push(priority, data);
+		PriorityQueueSortedArrayList<T>::pushItem(item);
 		if (PriorityQueueList<T>::list_->size() >= capacity_)
 		{
 			return PriorityQueueList<T>::list_->removeAt(0);
@@ -155,4 +175,17 @@ namespace structures
 			return false;
 		}
 	}
+
+	template<typename T>
+	inline void PriorityQueueLimitedSortedArrayList<T>::assignSorted(PriorityQueueItem<T>* const* items, const size_t count)
+	{
+		if (PriorityQueueList<T>::list_->size() > 0 || count >= capacity_)
+		{
+			throw std::logic_error("PriorityQueueLimitedSortedArrayList<T>::assignSorted: Priority queue is not empty or items do not fit.");
+		}
+		for (size_t i = 0; i < count; i++)
+		{
+			PriorityQueueList<T>::list_->add(items[i]);
+		}
+	}
 }
\ No newline at end of file
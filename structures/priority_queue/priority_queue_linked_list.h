@@ -8,7 +8,7 @@ namespace structures
 	/// <summary> Prioritny front implementovany neutriednym LinkedList-om. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v prioritnom fronte. </typepram>
 	template<typename T>
-	class PriorityQueueLinkedList : public PriorityQueueList<T>
+	class PriorityQueueLinkedList final : public PriorityQueueList<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -34,10 +34,10 @@ namespace structures
 		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
 		virtual PriorityQueueLinkedList<T>& operator=(const PriorityQueueLinkedList<T>& other);
 
-		/// <summary> Vlozi prvok s danou prioritou do prioritneho frontu implementovaneho neutriednym LinkedList-om. </summary>
-		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
-		/// <param name = "data"> Vkladany prvok. </param>
-		void push(const int priority, const T& data) override;
+	protected:
+		/// <summary> Zaradi vytvoreny prvok prioritneho frontu do neutriedeneho LinkedList-u. </summary>
+		/// <param name = "item"> Zaradovany prvok. Prioritny front ho prebera do vlastnictva. </param>
+		void pushItem(PriorityQueueItem<T>* item) override;
 	};
 
 	template<typename T>
@@ -76,8 +76,8 @@ namespace structures
 	}
 
 	template<typename T>
-	inline void PriorityQueueLinkedList<T>::push(const int priority, const T & data)
+	inline void PriorityQueueLinkedList<T>::pushItem(PriorityQueueItem<T>* item)
 	{
-		PriorityQueueList<T>::list_->add(new PriorityQueueItem<T>(priority, data));
+		PriorityQueueList<T>::addItem(item);
 	}
 }
\ No newline at end of file
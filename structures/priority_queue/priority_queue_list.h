@@ -29,9 +29,23 @@ namespace structures
 		/// <returns> Pocet prvkov v prioritnom fronte implementovanom zoznamom. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru prioritny front implementovany zoznamom obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru prioritny front implementovany zoznamom obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Vymaze obsah prioritneho frontu implementovaneho zoznamom. </summary>
 		void clear() override;
 
+		/// <summary> Vlozi prvok s danou prioritou do prioritneho frontu implementovaneho zoznamom. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		void push(const int priority, const T& data) override;
+
+		/// <summary> Vlozi prvok s danou prioritou do prioritneho frontu implementovaneho zoznamom. Prvok presunie. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		void push(const int priority, T&& data) override;
+
 		/// <summary> Odstrani prvok s najvacsou prioritou z prioritneho frontu implementovaneho zoznamom. </summary>
 		/// <returns> Odstraneny prvok. </returns>
 		/// <exception cref="std::logic_error"> Vyhodena, ak je prioritny front implementovany zoznamom prazdny. </exception>  
@@ -70,15 +84,40 @@ namespace structures
 		/// <exception cref="std::logic_error"> Vyhodena, ak je zoznam prazdny. </exception>  
 		virtual int indexOfPeek() const;
 
+		/// <summary> Zaradi vytvoreny prvok prioritneho frontu do zoznamu. </summary>
+		/// <param name = "item"> Zaradovany prvok. Prioritny front ho prebera do vlastnictva. </param>
+		virtual void pushItem(PriorityQueueItem<T>* item) = 0;
+
+		/// <summary> Prida prvok na koniec zoznamu a aktualizuje zapamatany prvok s najvacsou prioritou. </summary>
+		/// <param name = "item"> Pridavany prvok. Prioritny front ho prebera do vlastnictva. </param>
+		/// <remarks> Pouzivaju ho potomkovia, ktori neprekryvaju indexOfPeek. </remarks>
+		void addItem(PriorityQueueItem<T>* item);
+
 	protected:
 		/// <summary> Smernik na zoznam, do ktoreho sa ukladaju prvky prioritneho frontu. </summary>
 		List<PriorityQueueItem<T>*>* list_;
+
+		/// <summary> Zapamatany index prvku s najvacsou prioritou, -1, ak nie je znamy. </summary>
+		/// <remarks> Nastavuje ho iba indexOfPeek tejto triedy a addItem, pop ho zneplatni. </remarks>
+		mutable int peekIndex_;
+
+	private:
+		/// <summary> Zapamatany prvok s najvacsou prioritou, platny, ak peekIndex_ nie je -1. </summary>
+		mutable PriorityQueueItem<T>* peekItem_;
+
+	private:
+		/// <summary> Vrati prvok s najvacsou prioritou. </summary>
+		/// <returns> Prvok s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je zoznam prazdny. </exception>
+		PriorityQueueItem<T>* itemOfPeek() const;
 	};
 
 	template<typename T>
 	inline PriorityQueueList<T>::PriorityQueueList(List<PriorityQueueItem<T>*>* list) :
 		PriorityQueue<T>(),
-		list_(list)
+		list_(list),
+		peekIndex_(-1),
+		peekItem_(nullptr)
 	{
 	}
 
@@ -125,6 +164,15 @@ namespace structures
 		return list_->size();
 	}
 
+	template<typename T>
+	inline MemoryUsage PriorityQueueList<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(PriorityQueueList<T>));
+		result.addAllocation(list_->memoryUsage());
+		result.addAllocations(sizeof(PriorityQueueItem<T>), list_->size());
+		return result;
+	}
+
 	template<typename T>
 	inline void PriorityQueueList<T>::clear()
 	{
@@ -133,6 +181,31 @@ namespace structures
 			delete item;
 		}
 		list_->clear();
+		peekIndex_ = -1;
+	}
+
+	template<typename T>
+	inline void PriorityQueueList<T>::push(const int priority, const T& data)
+	{
+		this->pushItem(new PriorityQueueItem<T>(priority, data));
+	}
+
+	template<typename T>
+	inline void PriorityQueueList<T>::push(const int priority, T&& data)
+	{
+		this->pushItem(new PriorityQueueItem<T>(priority, std::move(data)));
+	}
+
+	template<typename T>
+	inline void PriorityQueueList<T>::addItem(PriorityQueueItem<T>* item)
+	{
+		list_->add(item);
+		// Pri rovnakej priorite zostava zapamatany starsi prvok, rovnako ako pri prehladavani zoznamu.
+		if (list_->size() == 1 || (peekIndex_ >= 0 && item->getPriority() < peekItem_->getPriority()))
+		{
+			peekIndex_ = static_cast<int>(list_->size()) - 1;
+			peekItem_ = item;
+		}
 	}
 
 	template<typename T>
@@ -142,18 +215,24 @@ namespace structures
 		{
 			throw std::logic_error("PriorityQueueList<T>::indexOfPeek: Queue is empty.");
 		}
-		int min = INT_MAX;
+		if (peekIndex_ >= 0)
+		{
+			return peekIndex_;
+		}
+		PriorityQueueItem<T>* minItem = nullptr;
 		int minIndex = 0;
 		int index = 0;
 		for (PriorityQueueItem<T>* item : *list_)
 		{
-			if (min > item->getPriority())
+			if (minItem == nullptr || minItem->getPriority() > item->getPriority())
 			{
-				min = item->getPriority();
+				minItem = item;
 				minIndex = index;
 			}
 			index++;
 		}
+		peekIndex_ = minIndex;
+		peekItem_ = minItem;
 		return minIndex;
 	}
 
@@ -161,7 +240,8 @@ namespace structures
 	inline T PriorityQueueList<T>::pop()
 	{
 		PriorityQueueItem<T>* item = list_->removeAt(indexOfPeek());
-		T data = item->accessData();
+		peekIndex_ = -1;
+		T data = std::move(item->accessData());
 		delete item;
 		return data;
 	}
@@ -169,18 +249,26 @@ namespace structures
 	template<typename T>
 	inline T & PriorityQueueList<T>::peek()
 	{
-		return (*list_)[indexOfPeek()]->accessData();
+		return itemOfPeek()->accessData();
 	}
 
 	template<typename T>
 	inline const T PriorityQueueList<T>::peek() const
 	{
-		return (*list_)[indexOfPeek()]->accessData();
+		return itemOfPeek()->accessData();
 	}
 
 	template<typename T>
 	inline int PriorityQueueList<T>::peekPriority() const
 	{
-		return (*list_)[indexOfPeek()]->getPriority();
+		return itemOfPeek()->getPriority();
+	}
+
+	template<typename T>
+	inline PriorityQueueItem<T>* PriorityQueueList<T>::itemOfPeek() const
+	{
+		// Potomok s vlastnym indexOfPeek zapamatany index nenastavuje, prvok sa vtedy precita zo zoznamu.
+		const int index = indexOfPeek();
+		return index == peekIndex_ ? peekItem_ : (*list_)[index];
 	}
 }
\ No newline at end of file
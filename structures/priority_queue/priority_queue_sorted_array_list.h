@@ -35,16 +35,15 @@ namespace structures
 		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
 		virtual PriorityQueueSortedArrayList<T>& operator=(const PriorityQueueSortedArrayList<T>& other);
 
-		/// <summary> Vlozi prvok s danou prioritou do prioritneho frontu implementovaneho utriednym ArrayList-om. </summary>
-		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
-		/// <param name = "data"> Vkladany prvok. </param>
-		void push(const int priority, const T& data) override;
-
 	protected:
 		/// <summary> Vrati index v utriedenom ArrayList-e, na ktorom sa nachadza prvok s najvacsou prioritou. </summary>
 		/// <returns> Index prvku s najvacsou prioritou. </returns>
 		/// <exception cref="std::logic_error"> Vyhodena, ak je zoznam prazdny. </exception>  
 		int indexOfPeek() const override;
+
+		/// <summary> Zaradi vytvoreny prvok prioritneho frontu do utriedeneho ArrayList-u. </summary>
+		/// <param name = "item"> Zaradovany prvok. Prioritny front ho prebera do vlastnictva. </param>
+		void pushItem(PriorityQueueItem<T>* item) override;
 	};
 
 	template<typename T>
@@ -83,30 +82,27 @@ namespace structures
 	}
   
 	template<typename T>
-	inline void PriorityQueueSortedArrayList<T>::push(const int priority, const T& data)
+	inline void PriorityQueueSortedArrayList<T>::pushItem(PriorityQueueItem<T>* item)
 	{
-		PriorityQueueItem<T>* item = new PriorityQueueItem<T>(priority, data);
-		if (PriorityQueueList<T>::list_->size() == 0)
-		{
-			PriorityQueueList<T>::list_->add(item);
-		}
-		else
+		// Zoznam je utriedeny zostupne, binarne sa hlada prvy prvok s cislom priority nie vacsim ako vkladany.
+		// Prvok sa vlozi pred neho, prvky s rovnakou prioritou sa tak odoberaju v poradi vkladania.
+		const int priority = item->getPriority();
+		List<PriorityQueueItem<T>*>& list = *PriorityQueueList<T>::list_;
+		int low = 0;
+		int high = static_cast<int>(list.size());
+		while (low < high)
 		{
-			bool foundSmaller = false;
-			for (size_t i = 0; i < PriorityQueueList<T>::list_->size(); i++)
+			const int middle = low + (high - low) / 2;
+			if (list[middle]->getPriority() <= priority)
 			{
-				if (priority >= (*PriorityQueueList<T>::list_)[i]->getPriority())
-				{
-					PriorityQueueList<T>::list_->insert(item, i);
-					foundSmaller = true;
-					break;
-				}
+				high = middle;
 			}
-			if (!foundSmaller)
+			else
 			{
-				PriorityQueueList<T>::list_->add(item);
+				low = middle + 1;
 			}
 		}
+		list.insert(item, low);
 	}
 
 	template<typename T>
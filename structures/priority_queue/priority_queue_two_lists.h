@@ -2,16 +2,21 @@
 
 #include "priority_queue.h"
 #include "priority_queue_limited_sorted_array_list.h"
-#include "../list/linked_list.h"
+#include "../array/array.h"
 #include <cmath>
+#include <algorithm>
 
 namespace structures
 {
 	/// <summary> Prioritny front implementovany dvojzoznamom. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v prioritnom fronte. </typepram>
-	/// <remarks> Implementacia efektivne vyuziva prioritny front implementovany utriednym ArrayList-om s obmedzenou kapacitou a LinkedList. </remarks>
+	/// <remarks>
+	/// Implementacia efektivne vyuziva prioritny front implementovany utriednym ArrayList-om s obmedzenou kapacitou a neutriedene pole.
+	/// Ked sa kratsi zoznam vyprazdni, najlepsie prvky dlhsieho zoznamu sa vyberu v linearnom case (nth_element), utriedi sa iba tento vyber
+	/// a zvysok dlhsieho zoznamu sa posunie na zaciatok pola. Pop tak v priemere trva O(sqrt(n)) bez alokacie pre kazdy prvok.
+	/// </remarks>
 	template<typename T>
-	class PriorityQueueTwoLists : public PriorityQueue<T>
+	class PriorityQueueTwoLists final : public PriorityQueue<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -36,11 +41,23 @@ namespace structures
 		/// <returns> Pocet prvkov v prioritnom fronte implementovanom dvojzoznamom. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru prioritny front implementovany dvojzoznamom obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru prioritny front implementovany dvojzoznamom obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Vymaze obsah prioritneho frontu implementovaneho dvojzoznamom. </summary>
 		void clear() override;
 
+		/// <summary> Vlozi prvok s danou prioritou do prioritneho frontu implementovaneho dvojzoznamom. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
 		void push(const int priority, const T& data) override;
 
+		/// <summary> Vlozi prvok s danou prioritou do prioritneho frontu implementovaneho dvojzoznamom. Prvok presunie. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		void push(const int priority, T&& data) override;
+
 		/// <summary> Odstrani prvok s najvacsou prioritou z prioritneho frontu implementovaneho dvojzoznamom. </summary>
 		/// <returns> Odstraneny prvok. </returns>
 		/// <exception cref="std::logic_error"> Vyhodena, ak je prioritny front implementovany dvojzoznamom prazdny. </exception>  
@@ -66,19 +83,35 @@ namespace structures
 		/// <remarks> Z pohladu dvojzoznamu sa jedna o kratsi utriedeny zoznam. </remarks>
 		PriorityQueueLimitedSortedArrayList<T>* shortList_;
 
-		/// <summary> Smernik na dlhsi neutriedeny zoznam. </summary>
-		LinkedList<PriorityQueueItem<T>*>* longList_;
+		/// <summary> Pole dlhsieho neutriedeneho zoznamu. </summary>
+		Array<PriorityQueueItem<T>*>* longList_;
+
+		/// <summary> Pocet prvkov v dlhsom zozname. </summary>
+		size_t longSize_;
 
 	protected:
 		
 		virtual size_t calculateSizeOfShortList(size_t longListSize);
 
+	private:
+		/// <summary> Zaradi vytvoreny prvok do kratsieho alebo dlhsieho zoznamu podla jeho priority. </summary>
+		/// <param name = "item"> Zaradovany prvok. Prioritny front ho prebera do vlastnictva. </param>
+		void pushItem(PriorityQueueItem<T>* item);
+
+		/// <summary> Prida prvok na koniec dlhsieho zoznamu, ak je pole plne, zdvojnasobi ho. </summary>
+		/// <param name = "item"> Pridavany prvok. </param>
+		void addToLongList(PriorityQueueItem<T>* item);
+
+		/// <summary> Presunie najlepsie prvky dlhsieho zoznamu do prazdneho kratsieho zoznamu. </summary>
+		void rebuildShortList();
+
 	};
 
 	template<typename T>
 	PriorityQueueTwoLists<T>::PriorityQueueTwoLists() :
 		shortList_(new PriorityQueueLimitedSortedArrayList<T>()),
-		longList_(new LinkedList<PriorityQueueItem<T>*>())
+		longList_(new Array<PriorityQueueItem<T>*>(4)),
+		longSize_(0)
 	{
 	}
 
@@ -114,45 +147,72 @@ namespace structures
 	template<typename T>
 	PriorityQueueTwoLists<T>& PriorityQueueTwoLists<T>::operator=(const PriorityQueueTwoLists<T>& other)
 	{
-		for (PriorityQueueItem<T>* item : *other.longList_)
+		if (this != &other)
 		{
-			longList_->add(new PriorityQueueItem<T>(*item));
+			clear();
+			*shortList_ = *other.shortList_;
+			for (size_t i = 0; i < other.longSize_; i++)
+			{
+				addToLongList(new PriorityQueueItem<T>(*(*other.longList_)[static_cast<int>(i)]));
+			}
 		}
-		*longList_ = *other.longList_;
 		return *this;
 	}
 
 	template<typename T>
 	size_t PriorityQueueTwoLists<T>::size() const
 	{
-		return shortList_->size() + longList_->size();
+		return shortList_->size() + longSize_;
+	}
+
+	template<typename T>
+	inline MemoryUsage PriorityQueueTwoLists<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(PriorityQueueTwoLists<T>));
+		result.addAllocation(shortList_->memoryUsage());
+		result.addAllocation(longList_->memoryUsage());
+		result.bytesWasted += (longList_->size() - longSize_) * sizeof(PriorityQueueItem<T>*);
+		result.addAllocations(sizeof(PriorityQueueItem<T>), longSize_);
+		return result;
 	}
 
 	template<typename T>
 	void PriorityQueueTwoLists<T>::clear()
 	{
 		shortList_->clear();
-		for (PriorityQueueItem<T>* item : *longList_)
+		for (size_t i = 0; i < longSize_; i++)
 		{
-			delete item;
+			delete (*longList_)[static_cast<int>(i)];
 		}
-		longList_->clear();
+		longSize_ = 0;
 	}
 
 	template<typename T>
 	void PriorityQueueTwoLists<T>::push(const int priority, const T & data)
 	{
-		if (longList_->size() == 0 || shortList_->minPriority() > priority)
+		pushItem(new PriorityQueueItem<T>(priority, data));
+	}
+
+	template<typename T>
+	void PriorityQueueTwoLists<T>::push(const int priority, T&& data)
+	{
+		pushItem(new PriorityQueueItem<T>(priority, std::move(data)));
+	}
+
+	template<typename T>
+	inline void PriorityQueueTwoLists<T>::pushItem(PriorityQueueItem<T>* item)
+	{
+		if (longSize_ == 0 || shortList_->minPriority() > item->getPriority())
 		{
-			PriorityQueueItem<T>* item = shortList_->pushAndRemove(priority, data);
-			if (item != nullptr)
+			PriorityQueueItem<T>* removedItem = shortList_->pushAndRemove(item);
+			if (removedItem != nullptr)
 			{
-				longList_->add(item);
+				addToLongList(removedItem);
 			}
 		}
 		else
 		{
-			longList_->add(new PriorityQueueItem<T>(priority, data));
+			addToLongList(item);
 		}
 	}
 
@@ -160,27 +220,9 @@ namespace structures
 	T PriorityQueueTwoLists<T>::pop()
 	{
 		T data = shortList_->pop();
-		if (shortList_->size() == 0 && longList_->size() > 0)
+		if (shortList_->size() == 0 && longSize_ > 0)
 		{
-			size_t capacity = calculateSizeOfShortList(longList_->size());
-			if (capacity < 4)
-			{
-				capacity = 4;
-			}
-			shortList_->trySetCapacity(capacity);
-			LinkedList<PriorityQueueItem<T>*>* helpList = new LinkedList<PriorityQueueItem<T>*>();
-			while (longList_->size() > 0)
-			{
-				PriorityQueueItem<T>* removedItem = longList_->removeAt(0);
-				PriorityQueueItem<T>* extraItem = shortList_->pushAndRemove(removedItem->getPriority(), removedItem->accessData());
-				delete removedItem;
-				if (extraItem != nullptr)
-				{
-					helpList->add(extraItem);
-				}
-			}
-			delete longList_;
-			longList_ = helpList;
+			rebuildShortList();
 		}
 		return data;
 	}
@@ -209,4 +251,42 @@ namespace structures
 		return static_cast<size_t>(round(sqrt(static_cast<long double>(longListSize))));
 	}
 
+	template<typename T>
+	inline void PriorityQueueTwoLists<T>::addToLongList(PriorityQueueItem<T>* item)
+	{
+		if (longSize_ == longList_->size())
+		{
+			Array<PriorityQueueItem<T>*>* newList = new Array<PriorityQueueItem<T>*>(2 * longList_->size());
+			Array<PriorityQueueItem<T>*>::copy(*longList_, 0, *newList, 0, static_cast<int>(longSize_));
+			delete longList_;
+			longList_ = newList;
+		}
+		(*longList_)[static_cast<int>(longSize_)] = item;
+		longSize_++;
+	}
+
+	template<typename T>
+	inline void PriorityQueueTwoLists<T>::rebuildShortList()
+	{
+		size_t capacity = calculateSizeOfShortList(longSize_);
+		if (capacity < 4)
+		{
+			capacity = 4;
+		}
+		shortList_->trySetCapacity(capacity);
+		// Kratsi zoznam s kapacitou c drzi najviac c - 1 prvkov, dalsi prvok by pushAndRemove hned vratil.
+		const size_t count = std::min(capacity - 1, longSize_);
+		PriorityQueueItem<T>** items = longList_->data();
+		if (count < longSize_)
+		{
+			std::nth_element(items, items + count, items + longSize_,
+				[](const PriorityQueueItem<T>* a, const PriorityQueueItem<T>* b) { return a->getPriority() < b->getPriority(); });
+		}
+		std::sort(items, items + count,
+			[](const PriorityQueueItem<T>* a, const PriorityQueueItem<T>* b) { return a->getPriority() > b->getPriority(); });
+		shortList_->assignSorted(items, count);
+		Array<PriorityQueueItem<T>*>::copy(*longList_, static_cast<int>(count), *longList_, 0, static_cast<int>(longSize_ - count));
+		longSize_ -= count;
+	}
+
 }
\ No newline at end of file
@@ -1,13 +1,14 @@
 #pragma once
 
 #include "priority_queue_list.h"
+#include "../list/array_list.h"
 
 namespace structures
 {
 	/// <summary> Prioritny front implementovany neutriednym ArrayList-om. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v prioritnom fronte. </typepram>
 	template<typename T>
-	class PriorityQueueUnsortedArrayList : public PriorityQueueList<T>
+	class PriorityQueueUnsortedArrayList final : public PriorityQueueList<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -33,15 +34,15 @@ namespace structures
 		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
 		virtual PriorityQueueUnsortedArrayList<T>& operator=(const PriorityQueueUnsortedArrayList<T>& other);
 
-		/// <summary> Vlozi prvok s danou prioritou do prioritneho frontu implementovaneho neutriednym ArrayList-om. </summary>
-		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
-		/// <param name = "data"> Vkladany prvok. </param>
-		void push(const int priority, const T& data) override;
-
 		/// <summary> Odstrani prvok s najvacsou prioritou z prioritneho frontu implementovaneho neutriednym ArrayList-om. </summary>
 		/// <returns> Odstraneny prvok. </returns>
 		/// <exception cref="std::logic_error"> Vyhodena, ak je prioritny front implementovany neutriednym ArrayList-om prazdny. </exception>  
 		T pop() override;
+
+	protected:
+		/// <summary> Zaradi vytvoreny prvok prioritneho frontu do neutriedeneho ArrayList-u. </summary>
+		/// <param name = "item"> Zaradovany prvok. Prioritny front ho prebera do vlastnictva. </param>
+		void pushItem(PriorityQueueItem<T>* item) override;
 	};
 
 	template<typename T>
@@ -80,17 +81,19 @@ namespace structures
 	}
 
 	template<typename T>
-	void PriorityQueueUnsortedArrayList<T>::push(const int priority, const T & data)
+	inline void PriorityQueueUnsortedArrayList<T>::pushItem(PriorityQueueItem<T>* item)
 	{
-		list_->add(new PriorityQueueItem<T>(priority, data));
+		PriorityQueueList<T>::addItem(item);
 	}
 
 	template<typename T>
 	inline T PriorityQueueUnsortedArrayList<T>::pop()
 	{
-		DSRoutines::swap((*list_)[indexOfPeek()], (*list_)[list_->size() - 1]);
-		PriorityQueueItem<T>* item = list_->removeAt(list_->size() - 1);
-		T data = item->accessData();
+		List<PriorityQueueItem<T>*>& list = *PriorityQueueList<T>::list_;
+		DSRoutines::swap(list[this->indexOfPeek()], list[list.size() - 1]);
+		PriorityQueueItem<T>* item = list.removeAt(list.size() - 1);
+		PriorityQueueList<T>::peekIndex_ = -1;
+		T data = std::move(item->accessData());
 		delete item;
 		return data;
 	}
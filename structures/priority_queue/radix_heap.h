@@ -0,0 +1,372 @@
+#pragma once
+
+#include "priority_queue.h"
+#include "../list/array_list.h"
+#include <stdexcept>
+#include <climits>
+
+namespace structures
+{
+	/// <summary> Prioritny front implementovany radixovou haldou pre monotonne priority. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v prioritnom fronte. </typepram>
+	/// <remarks>
+	/// Halda si pamata naposledy odobratu prioritu. Prvok s prioritou p patri do priehradky podla najvyssieho bitu,
+	/// v ktorom sa p lisi od tejto priority, priehradka 0 obsahuje prvky s rovnakou prioritou. Pop berie z priehradky 0,
+	/// ak je prazdna, najmensia priorita prvej neprazdnej priehradky sa stane naposledy odobratou a prvky tejto priehradky
+	/// sa rozdelia do nizsich priehradok. Kazdy prvok sa tak presunie najviac 32-krat, push trva O(1) a pop amortizovane O(1).
+	/// Halda predpoklada, ze sa nevklada priorita mensia ako naposledy odobrata (napr. Dijkstrov algoritmus, casovace).
+	/// V kontrolnom rezime takyto push vyhodi vynimku, inak sa prvky prerozdelia v case O(n).
+	/// </remarks>
+	template<typename T>
+	class RadixHeap final : public PriorityQueue<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		/// <param name = "checkMonotone"> Ci ma push odmietnut prioritu mensiu ako naposledy odobrata. </param>
+		RadixHeap(bool checkMonotone = true);
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Radixova halda, z ktorej sa prevezmu vlastnosti. </param>
+		RadixHeap(const RadixHeap<T>& other);
+
+		/// <summary> Destruktor. </summary>
+		~RadixHeap();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat radixovej haldy. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Prioritny front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento prioritny front nachadza po priradeni. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak vstupny parameter nie je radixova halda. </exception>
+		PriorityQueue<T>& operator=(const PriorityQueue<T>& other) override;
+
+		/// <summary> Operator priradenia. Kontrolny rezim sa nepreberie. </summary>
+		/// <param name = "other"> Radixova halda, z ktorej ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tato halda nachadza po priradeni. </returns>
+		RadixHeap<T>& operator=(const RadixHeap<T>& other);
+
+		/// <summary> Vrati pocet prvkov v radixovej halde. </summary>
+		/// <returns> Pocet prvkov v radixovej halde. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru radixova halda obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru radixova halda obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Vymaze obsah radixovej haldy a zabudne naposledy odobratu prioritu. </summary>
+		void clear() override;
+
+		/// <summary> Vlozi prvok s danou prioritou do radixovej haldy. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		/// <exception cref="std::logic_error"> Vyhodena v kontrolnom rezime, ak je priorita mensia ako naposledy odobrata. </exception>
+		void push(const int priority, const T& data) override;
+
+		/// <summary> Vlozi prvok s danou prioritou do radixovej haldy. Prvok presunie. </summary>
+		/// <param name = "priority"> Priorita vkladaneho prvku. </param>
+		/// <param name = "data"> Vkladany prvok. </param>
+		/// <exception cref="std::logic_error"> Vyhodena v kontrolnom rezime, ak je priorita mensia ako naposledy odobrata. </exception>
+		void push(const int priority, T&& data) override;
+
+		/// <summary> Odstrani prvok s najvacsou prioritou z radixovej haldy. </summary>
+		/// <returns> Odstraneny prvok. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je radixova halda prazdna. </exception>
+		T pop() override;
+
+		/// <summary> Vrati adresou prvok s najvacsou prioritou. </summary>
+		/// <returns> Adresa, na ktorej sa nachadza prvok s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je radixova halda prazdna. </exception>
+		T& peek() override;
+
+		/// <summary> Vrati kopiu prvku s najvacsou prioritou. </summary>
+		/// <returns> Kopia prvku s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je radixova halda prazdna. </exception>
+		const T peek() const override;
+
+		/// <summary> Vrati prioritu prvku s najvacsou prioritou. </summary>
+		/// <returns> Priorita prvku s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je radixova halda prazdna. </exception>
+		int peekPriority() const override;
+
+		/// <summary> Vrati naposledy odobratu prioritu, mensiu prioritu kontrolny rezim odmietne. </summary>
+		/// <returns> Naposledy odobrata priorita, alebo najmensie cislo typu int, ak sa este nic neodobralo. </returns>
+		int lastPriority() const;
+
+	private:
+		/// <summary> Pocet priehradok, priehradka 0 a jedna pre kazdy bit priority. </summary>
+		static const int BUCKET_COUNT = 33;
+
+		/// <summary> Priehradky prvkov. </summary>
+		ArrayList<PriorityQueueItem<T>*> buckets_[BUCKET_COUNT];
+		/// <summary> Naposledy odobrata priorita. </summary>
+		int last_;
+		/// <summary> Pocet prvkov v halde. </summary>
+		size_t size_;
+		/// <summary> Ci push odmieta prioritu mensiu ako naposledy odobrata. </summary>
+		bool checkMonotone_;
+
+	private:
+		/// <summary> Zaradi vytvoreny prvok do priehradky. </summary>
+		/// <param name = "item"> Zaradovany prvok. Halda ho prebera do vlastnictva. </param>
+		void pushItem(PriorityQueueItem<T>* item);
+
+		/// <summary> Vrati index priehradky pre prioritu vzhladom na naposledy odobratu prioritu. </summary>
+		/// <param name = "priority"> Priorita, nie mensia ako naposledy odobrata. </param>
+		/// <returns> Index priehradky. </returns>
+		int bucketIndex(const int priority) const;
+
+		/// <summary> Zmensi naposledy odobratu prioritu a prerozdeli vsetky prvky do priehradok. </summary>
+		/// <param name = "priority"> Nova naposledy odobrata priorita. </param>
+		void lowerLast(const int priority);
+
+		/// <summary> Najde prvok s najvacsou prioritou. </summary>
+		/// <param name = "message"> Sprava vynimky. </param>
+		/// <returns> Prvok s najvacsou prioritou. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je radixova halda prazdna. </exception>
+		PriorityQueueItem<T>* findPeek(const char* message) const;
+	};
+
+	template<typename T>
+	inline RadixHeap<T>::RadixHeap(bool checkMonotone) :
+		PriorityQueue<T>(),
+		last_(INT_MIN),
+		size_(0),
+		checkMonotone_(checkMonotone)
+	{
+	}
+
+	template<typename T>
+	inline RadixHeap<T>::RadixHeap(const RadixHeap<T>& other) :
+		RadixHeap<T>(other.checkMonotone_)
+	{
+		*this = other;
+	}
+
+	template<typename T>
+	inline RadixHeap<T>::~RadixHeap()
+	{
+		clear();
+	}
+
+	template<typename T>
+	inline Structure* RadixHeap<T>::clone() const
+	{
+		return new RadixHeap<T>(*this);
+	}
+
+	template<typename T>
+	inline PriorityQueue<T>& RadixHeap<T>::operator=(const PriorityQueue<T>& other)
+	{
+		return *this = dynamic_cast<const RadixHeap<T>&>(other);
+	}
+
+	template<typename T>
+	inline RadixHeap<T>& RadixHeap<T>::operator=(const RadixHeap<T>& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			last_ = other.last_;
+			for (int i = 0; i < BUCKET_COUNT; i++)
+			{
+				const ArrayList<PriorityQueueItem<T>*>& bucket = other.buckets_[i];
+				for (int j = 0; j < static_cast<int>(bucket.size()); j++)
+				{
+					buckets_[i].add(new PriorityQueueItem<T>(*bucket[j]));
+				}
+			}
+			size_ = other.size_;
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline size_t RadixHeap<T>::size() const
+	{
+		return size_;
+	}
+
+	template<typename T>
+	inline MemoryUsage RadixHeap<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(RadixHeap<T>));
+		for (const ArrayList<PriorityQueueItem<T>*>& bucket : buckets_)
+		{
+			// Objekt zoznamu je sucastou haldy, samostatne alokovane je iba jeho pole.
+			result += bucket.memoryUsage();
+			result.bytesOwned -= sizeof(ArrayList<PriorityQueueItem<T>*>);
+		}
+		result.addAllocations(sizeof(PriorityQueueItem<T>), size_);
+		return result;
+	}
+
+	template<typename T>
+	inline void RadixHeap<T>::clear()
+	{
+		for (ArrayList<PriorityQueueItem<T>*>& bucket : buckets_)
+		{
+			for (int i = 0; i < static_cast<int>(bucket.size()); i++)
+			{
+				delete bucket[i];
+			}
+			bucket.clear();
+		}
+		last_ = INT_MIN;
+		size_ = 0;
+	}
+
+	template<typename T>
+	inline void RadixHeap<T>::push(const int priority, const T& data)
+	{
+		pushItem(new PriorityQueueItem<T>(priority, data));
+	}
+
+	template<typename T>
+	inline void RadixHeap<T>::push(const int priority, T&& data)
+	{
+		pushItem(new PriorityQueueItem<T>(priority, std::move(data)));
+	}
+
+	template<typename T>
+	inline T RadixHeap<T>::pop()
+	{
+		if (size_ == 0)
+		{
+			throw std::logic_error("RadixHeap<T>::pop: Priority queue is empty.");
+		}
+		if (buckets_[0].size() == 0)
+		{
+			int index = 1;
+			while (buckets_[index].size() == 0)
+			{
+				index++;
+			}
+			// Najmensia priorita priehradky sa stane naposledy odobratou, ostatne prvky priehradky sa dostanu do nizsich priehradok.
+			ArrayList<PriorityQueueItem<T>*>& bucket = buckets_[index];
+			const int count = static_cast<int>(bucket.size());
+			int minimum = bucket[0]->getPriority();
+			for (int i = 1; i < count; i++)
+			{
+				if (bucket[i]->getPriority() < minimum)
+				{
+					minimum = bucket[i]->getPriority();
+				}
+			}
+			last_ = minimum;
+			for (int i = 0; i < count; i++)
+			{
+				buckets_[bucketIndex(bucket[i]->getPriority())].add(bucket[i]);
+			}
+			bucket.clear();
+		}
+		PriorityQueueItem<T>* item = buckets_[0].removeAt(static_cast<int>(buckets_[0].size()) - 1);
+		size_--;
+		T result = std::move(item->accessData());
+		delete item;
+		return result;
+	}
+
+	template<typename T>
+	inline T& RadixHeap<T>::peek()
+	{
+		return findPeek("RadixHeap<T>::peek: Priority queue is empty.")->accessData();
+	}
+
+	template<typename T>
+	inline const T RadixHeap<T>::peek() const
+	{
+		return findPeek("RadixHeap<T>::peek: Priority queue is empty.")->accessData();
+	}
+
+	template<typename T>
+	inline int RadixHeap<T>::peekPriority() const
+	{
+		return findPeek("RadixHeap<T>::peekPriority: Priority queue is empty.")->getPriority();
+	}
+
+	template<typename T>
+	inline int RadixHeap<T>::lastPriority() const
+	{
+		return last_;
+	}
+
+	template<typename T>
+	inline void RadixHeap<T>::pushItem(PriorityQueueItem<T>* item)
+	{
+		if (item->getPriority() < last_)
+		{
+			if (checkMonotone_)
+			{
+				delete item;
+				throw std::logic_error("RadixHeap<T>::push: Priority is lower than the last popped priority.");
+			}
+			lowerLast(item->getPriority());
+		}
+		buckets_[bucketIndex(item->getPriority())].add(item);
+		size_++;
+	}
+
+	template<typename T>
+	inline int RadixHeap<T>::bucketIndex(const int priority) const
+	{
+		// Posunutie znamienkoveho bitu zachova usporiadanie priorit aj pre zaporne cisla.
+		unsigned int difference = (static_cast<unsigned int>(priority) ^ 0x80000000u) ^ (static_cast<unsigned int>(last_) ^ 0x80000000u);
+		int result = 0;
+		while (difference != 0)
+		{
+			difference >>= 1;
+			result++;
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline void RadixHeap<T>::lowerLast(const int priority)
+	{
+		ArrayList<PriorityQueueItem<T>*> items;
+		for (ArrayList<PriorityQueueItem<T>*>& bucket : buckets_)
+		{
+			for (int i = 0; i < static_cast<int>(bucket.size()); i++)
+			{
+				items.add(bucket[i]);
+			}
+			bucket.clear();
+		}
+		last_ = priority;
+		for (int i = 0; i < static_cast<int>(items.size()); i++)
+		{
+			buckets_[bucketIndex(items[i]->getPriority())].add(items[i]);
+		}
+	}
+
+	template<typename T>
+	inline PriorityQueueItem<T>* RadixHeap<T>::findPeek(const char* message) const
+	{
+		if (size_ == 0)
+		{
+			throw std::logic_error(message);
+		}
+		if (buckets_[0].size() > 0)
+		{
+			return buckets_[0][static_cast<int>(buckets_[0].size()) - 1];
+		}
+		int index = 1;
+		while (buckets_[index].size() == 0)
+		{
+			index++;
+		}
+		const ArrayList<PriorityQueueItem<T>*>& bucket = buckets_[index];
+		// Pop presunie posledny z prvkov s najmensou prioritou na vrch priehradky 0, peek vrati ten isty prvok.
+		PriorityQueueItem<T>* result = bucket[0];
+		for (int i = 1; i < static_cast<int>(bucket.size()); i++)
+		{
+			if (bucket[i]->getPriority() <= result->getPriority())
+			{
+				result = bucket[i];
+			}
+		}
+		return result;
+	}
+}
@@ -0,0 +1,468 @@
+#pragma once
+
+#include "queue.h"
+#include "../list/list.h"
+#include "../concurrency_routines.h"
+
+#include <mutex>
+#include <condition_variable>
+#include <stdexcept>
+
+namespace structures
+{
+	/// <summary> Ohraniceny blokujuci front nad lubovolnym frontom. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych vo fronte. </typepram>
+	/// <remarks>
+	/// Vsetky operacie nad vnutornym frontom prebiehaju pod jednym zamkom. Ak je front plny, push caka, kym konzument
+	/// neuvolni miesto, ak je prazdny, pop caka na producenta. Cakajuce vlakna sa budia iba vtedy, ked nejake naozaj caka,
+	/// takze bez cakajucich vlakien operacia len zamkne a odomkne mutex bez volania jadra.
+	/// Po zatvoreni (close) sa do frontu neda pridavat, zostavajuce prvky sa daju odobrat a cakajuce vlakna sa zobudia.
+	/// Kapacita vnutorneho frontu musi byt aspon kapacita blokujuceho frontu.
+	/// </remarks>
+	template<typename T>
+	class BlockingQueue final : public Queue<T>
+	{
+	public:
+		/// <summary> Parametricky konstruktor. </summary>
+		/// <param name = "queue"> Vnutorny front, blokujuci front ho prevezme a v destruktore zrusi. </param>
+		/// <param name = "capacity"> Najvacsi pocet prvkov vo fronte. </param>
+		BlockingQueue(Queue<T>* queue, const size_t capacity);
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Front, z ktoreho sa prevezmu vlastnosti. </param>
+		BlockingQueue(const BlockingQueue<T>& other);
+
+		/// <summary> Destruktor. </summary>
+		~BlockingQueue();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat frontu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov vo fronte. </summary>
+		/// <returns> Pocet prvkov vo fronte. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati kapacitu frontu. </summary>
+		/// <returns> Kapacita frontu. </returns>
+		size_t capacity() const;
+
+		/// <summary> Vrati udaje o pamati, ktoru front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento front nachadza po priradeni. </returns>
+		Queue<T>& operator=(const Queue<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento front nachadza po priradeni. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak vnutorne fronty nie su rovnakeho typu. </exception>
+		BlockingQueue<T>& operator=(const BlockingQueue<T>& other);
+
+		/// <summary> Vymaze front a zobudi cakajucich producentov. </summary>
+		void clear() override;
+
+		/// <summary> Prida prvok do frontu, ak je front plny, caka, kym sa neuvolni miesto. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front zatvoreny. </exception>
+		void push(const T& data) override;
+
+		/// <summary> Prida prvok do frontu, ak je front plny, caka, kym sa neuvolni miesto. Prvok do frontu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front zatvoreny. </exception>
+		void push(T&& data) override;
+
+		/// <summary> Odstrani prvok z frontu, ak je front prazdny, caka, kym sa prvok neobjavi. </summary>
+		/// <returns> Prvok na zaciatku frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front zatvoreny a prazdny. </exception>
+		T pop() override;
+
+		/// <summary> Odkaz na prvok na zaciatku frontu nie je podporovany. </summary>
+		/// <exception cref="std::logic_error"> Vyhodena vzdy, odkaz by po odomknuti mohol ukazovat na prvok, ktory uz ine vlakno odobralo. </exception>
+		T& peek() override;
+
+		/// <summary> Vrati kopiu prvku na zaciatku frontu, vytvorenu pod zamkom. </summary>
+		/// <returns> Prvok na zaciatku frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>
+		/// <remarks> Neblokuje. </remarks>
+		const T peek() const override;
+
+		/// <summary> Pokusi sa pridat prvok do frontu, najviac po dany cas caka na volne miesto. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "timeout"> Najdlhsi cas cakania, nulovy cas znamena, ze sa neceka. </param>
+		/// <returns> true, ak bol prvok pridany, false, ak cas vyprsal (prvok sa vtedy nepresunie). </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front zatvoreny. </exception>
+		template<typename Rep, typename Period>
+		bool tryPush(T&& data, const std::chrono::duration<Rep, Period>& timeout);
+
+		/// <summary> Pokusi sa pridat prvok do frontu, najviac po dany cas caka na volne miesto. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <param name = "timeout"> Najdlhsi cas cakania, nulovy cas znamena, ze sa neceka. </param>
+		/// <returns> true, ak bol prvok pridany, false, ak cas vyprsal. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front zatvoreny. </exception>
+		template<typename Rep, typename Period>
+		bool tryPush(const T& data, const std::chrono::duration<Rep, Period>& timeout);
+
+		/// <summary> Pokusi sa odobrat prvok z frontu, najviac po dany cas caka na prvok. </summary>
+		/// <param name = "data"> Premenna, do ktorej sa prvok presunie. </param>
+		/// <param name = "timeout"> Najdlhsi cas cakania, nulovy cas znamena, ze sa neceka. </param>
+		/// <returns> true, ak bol prvok odobrany, false, ak cas vyprsal alebo je front zatvoreny a prazdny. </returns>
+		template<typename Rep, typename Period>
+		bool tryPop(T& data, const std::chrono::duration<Rep, Period>& timeout);
+
+		/// <summary> Presunie prvky z frontu na koniec zoznamu pod jednym zamknutim. Neblokuje. </summary>
+		/// <param name = "list"> Zoznam, do ktoreho sa prvky pridaju. </param>
+		/// <param name = "maxCount"> Najvacsi pocet presunutych prvkov. </param>
+		/// <returns> Pocet presunutych prvkov. </returns>
+		size_t drainTo(List<T>& list, const size_t maxCount);
+
+		/// <summary> Zatvori front. Dalsie pridavanie vyhodi vynimku, vsetky cakajuce vlakna sa zobudia. </summary>
+		void close();
+
+		/// <summary> Zisti, ci je front zatvoreny. </summary>
+		/// <returns> true, ak je front zatvoreny. </returns>
+		bool isClosed() const;
+
+	private:
+		/// <summary> Vnutorny front. </summary>
+		Queue<T>* queue_;
+		/// <summary> Najvacsi pocet prvkov vo fronte. </summary>
+		size_t capacity_;
+		/// <summary> Priznak zatvorenia frontu. </summary>
+		bool closed_;
+		/// <summary> Pocet producentov cakajucich na volne miesto. </summary>
+		size_t waitingProducers_;
+		/// <summary> Pocet konzumentov cakajucich na prvok. </summary>
+		size_t waitingConsumers_;
+		/// <summary> Zamok chraniaci vsetky atributy. </summary>
+		mutable std::mutex mutex_;
+		/// <summary> Signal pre konzumentov, ze vo fronte je prvok alebo bol front zatvoreny. </summary>
+		std::condition_variable notEmpty_;
+		/// <summary> Signal pre producentov, ze vo fronte je miesto alebo bol front zatvoreny. </summary>
+		std::condition_variable notFull_;
+
+	private:
+		/// <summary> Pocka, kym vo fronte nebude miesto, alebo kym nevyprsi cas. </summary>
+		/// <param name = "lock"> Zamknuty zamok frontu. </param>
+		/// <param name = "deadline"> Cas, po ktorom sa prestane cakat, nullptr znamena cakat bez obmedzenia. </param>
+		/// <param name = "message"> Sprava vynimky pri zatvorenom fronte. </param>
+		/// <returns> true, ak je vo fronte miesto. </returns>
+		/// <exception cref="std::logic_error"> Vyhodena, ak je front zatvoreny. </exception>
+		bool waitNotFull(std::unique_lock<std::mutex>& lock, const std::chrono::steady_clock::time_point* deadline, const char* message);
+
+		/// <summary> Pocka, kym vo fronte nebude prvok, alebo kym nevyprsi cas alebo sa front nezatvori. </summary>
+		/// <param name = "lock"> Zamknuty zamok frontu. </param>
+		/// <param name = "deadline"> Cas, po ktorom sa prestane cakat, nullptr znamena cakat bez obmedzenia. </param>
+		/// <returns> true, ak je vo fronte prvok. </returns>
+		bool waitNotEmpty(std::unique_lock<std::mutex>& lock, const std::chrono::steady_clock::time_point* deadline);
+
+		/// <summary> Vlozi prvok do vnutorneho frontu, odomkne zamok a zobudi cakajuceho konzumenta. </summary>
+		/// <param name = "lock"> Zamknuty zamok frontu. </param>
+		/// <param name = "data"> Pridavany prvok. </param>
+		template<typename U>
+		void pushLocked(std::unique_lock<std::mutex>& lock, U&& data);
+
+		/// <summary> Odoberie prvok z vnutorneho frontu, odomkne zamok a zobudi cakajuceho producenta. </summary>
+		/// <param name = "lock"> Zamknuty zamok frontu. </param>
+		/// <returns> Odobrany prvok. </returns>
+		T popLocked(std::unique_lock<std::mutex>& lock);
+	};
+
+	template<typename T>
+	inline BlockingQueue<T>::BlockingQueue(Queue<T>* queue, const size_t capacity) :
+		Queue<T>(),
+		queue_(queue),
+		capacity_(capacity),
+		closed_(false),
+		waitingProducers_(0),
+		waitingConsumers_(0)
+	{
+	}
+
+	template<typename T>
+	inline BlockingQueue<T>::BlockingQueue(const BlockingQueue<T>& other) :
+		Queue<T>(other),
+		queue_(nullptr),
+		capacity_(other.capacity_),
+		closed_(false),
+		waitingProducers_(0),
+		waitingConsumers_(0)
+	{
+		std::lock_guard<std::mutex> lock(other.mutex_);
+		queue_ = dynamic_cast<Queue<T>*>(other.queue_->clone());
+		closed_ = other.closed_;
+	}
+
+	template<typename T>
+	inline BlockingQueue<T>::~BlockingQueue()
+	{
+		delete queue_;
+		queue_ = nullptr;
+	}
+
+	template<typename T>
+	inline Structure* BlockingQueue<T>::clone() const
+	{
+		return new BlockingQueue<T>(*this);
+	}
+
+	template<typename T>
+	inline size_t BlockingQueue<T>::size() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return queue_->size();
+	}
+
+	template<typename T>
+	inline size_t BlockingQueue<T>::capacity() const
+	{
+		return capacity_;
+	}
+
+	template<typename T>
+	inline MemoryUsage BlockingQueue<T>::memoryUsage() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		MemoryUsage result(sizeof(BlockingQueue<T>));
+		result.addAllocation(queue_->memoryUsage());
+		return result;
+	}
+
+	template<typename T>
+	inline Queue<T>& BlockingQueue<T>::operator=(const Queue<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const BlockingQueue<T>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline BlockingQueue<T>& BlockingQueue<T>::operator=(const BlockingQueue<T>& other)
+	{
+		if (this != &other)
+		{
+			std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+			std::unique_lock<std::mutex> otherLock(other.mutex_, std::defer_lock);
+			std::lock(lock, otherLock);
+			*queue_ = *other.queue_;
+			capacity_ = other.capacity_;
+			closed_ = other.closed_;
+			notEmpty_.notify_all();
+			notFull_.notify_all();
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline void BlockingQueue<T>::clear()
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		queue_->clear();
+		const bool wake = waitingProducers_ > 0;
+		lock.unlock();
+		if (wake)
+		{
+			notFull_.notify_all();
+		}
+	}
+
+	template<typename T>
+	inline void BlockingQueue<T>::push(const T& data)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		waitNotFull(lock, nullptr, "BlockingQueue<T>::push: Queue is closed.");
+		pushLocked(lock, data);
+	}
+
+	template<typename T>
+	inline void BlockingQueue<T>::push(T&& data)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		waitNotFull(lock, nullptr, "BlockingQueue<T>::push: Queue is closed.");
+		pushLocked(lock, std::move(data));
+	}
+
+	template<typename T>
+	inline T BlockingQueue<T>::pop()
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		if (!waitNotEmpty(lock, nullptr))
+		{
+			throw std::out_of_range("BlockingQueue<T>::pop: Queue is closed and empty.");
+		}
+		return popLocked(lock);
+	}
+
+	template<typename T>
+	inline T& BlockingQueue<T>::peek()
+	{
+		throw std::logic_error("BlockingQueue<T>::peek: Reference to the first item is not supported, use const peek.");
+	}
+
+	template<typename T>
+	inline const T BlockingQueue<T>::peek() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return static_cast<const Queue<T>*>(queue_)->peek();
+	}
+
+	template<typename T>
+	template<typename Rep, typename Period>
+	inline bool BlockingQueue<T>::tryPush(T&& data, const std::chrono::duration<Rep, Period>& timeout)
+	{
+		const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+		std::unique_lock<std::mutex> lock(mutex_);
+		if (!waitNotFull(lock, &deadline, "BlockingQueue<T>::tryPush: Queue is closed."))
+		{
+			return false;
+		}
+		pushLocked(lock, std::move(data));
+		return true;
+	}
+
+	template<typename T>
+	template<typename Rep, typename Period>
+	inline bool BlockingQueue<T>::tryPush(const T& data, const std::chrono::duration<Rep, Period>& timeout)
+	{
+		const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+		std::unique_lock<std::mutex> lock(mutex_);
+		if (!waitNotFull(lock, &deadline, "BlockingQueue<T>::tryPush: Queue is closed."))
+		{
+			return false;
+		}
+		pushLocked(lock, data);
+		return true;
+	}
+
+	template<typename T>
+	template<typename Rep, typename Period>
+	inline bool BlockingQueue<T>::tryPop(T& data, const std::chrono::duration<Rep, Period>& timeout)
+	{
+		const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+		std::unique_lock<std::mutex> lock(mutex_);
+		if (!waitNotEmpty(lock, &deadline))
+		{
+			return false;
+		}
+		data = popLocked(lock);
+		return true;
+	}
+
+	template<typename T>
+	inline size_t BlockingQueue<T>::drainTo(List<T>& list, const size_t maxCount)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		size_t result = 0;
+		while (result < maxCount && queue_->size() > 0)
+		{
+			list.add(queue_->pop());
+			result++;
+		}
+		const bool wake = result > 0 && waitingProducers_ > 0;
+		lock.unlock();
+		if (wake)
+		{
+			notFull_.notify_all();
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline void BlockingQueue<T>::close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			closed_ = true;
+		}
+		notEmpty_.notify_all();
+		notFull_.notify_all();
+	}
+
+	template<typename T>
+	inline bool BlockingQueue<T>::isClosed() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return closed_;
+	}
+
+	template<typename T>
+	inline bool BlockingQueue<T>::waitNotFull(std::unique_lock<std::mutex>& lock, const std::chrono::steady_clock::time_point* deadline, const char* message)
+	{
+		while (!closed_ && queue_->size() >= capacity_)
+		{
+			if (deadline != nullptr && std::chrono::steady_clock::now() >= *deadline)
+			{
+				return false;
+			}
+			waitingProducers_++;
+			if (deadline != nullptr)
+			{
+				notFull_.wait_until(lock, *deadline);
+			}
+			else
+			{
+				notFull_.wait(lock);
+			}
+			waitingProducers_--;
+		}
+		if (closed_)
+		{
+			throw std::logic_error(message);
+		}
+		return true;
+	}
+
+	template<typename T>
+	inline bool BlockingQueue<T>::waitNotEmpty(std::unique_lock<std::mutex>& lock, const std::chrono::steady_clock::time_point* deadline)
+	{
+		while (!closed_ && queue_->size() == 0)
+		{
+			if (deadline != nullptr && std::chrono::steady_clock::now() >= *deadline)
+			{
+				return false;
+			}
+			waitingConsumers_++;
+			if (deadline != nullptr)
+			{
+				notEmpty_.wait_until(lock, *deadline);
+			}
+			else
+			{
+				notEmpty_.wait(lock);
+			}
+			waitingConsumers_--;
+		}
+		return queue_->size() > 0;
+	}
+
+	template<typename T>
+	template<typename U>
+	inline void BlockingQueue<T>::pushLocked(std::unique_lock<std::mutex>& lock, U&& data)
+	{
+		queue_->push(std::forward<U>(data));
+		const bool wake = waitingConsumers_ > 0;
+		lock.unlock();
+		if (wake)
+		{
+			notEmpty_.notify_one();
+		}
+	}
+
+	template<typename T>
+	inline T BlockingQueue<T>::popLocked(std::unique_lock<std::mutex>& lock)
+	{
+		T result = queue_->pop();
+		const bool wake = waitingProducers_ > 0;
+		lock.unlock();
+		if (wake)
+		{
+			notFull_.notify_one();
+		}
+		return result;
+	}
+}
@@ -8,7 +8,7 @@ namespace structures
 	/// <summary> Explicitny front. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych vo fronte. </typepram>
 	template<typename T>
-	class ExplicitQueue : public Queue<T>
+	class ExplicitQueue final : public Queue<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -29,6 +29,10 @@ namespace structures
 		/// <returns> Pocet prvkov vo fronte. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Front, z ktoreho ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento front nachadza po priradeni. </returns>
@@ -46,6 +50,10 @@ namespace structures
 		/// <param name = "data"> Pridavany prvok. </param>
 		void push(const T& data) override;
 
+		/// <summary> Prida prvok do frontu. Prvok do frontu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void push(T&& data) override;
+
 		/// <summary> Odstrani prvok z frontu. </summary>
 		/// <returns> Prvok na zaciatku frontu. </returns>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>  
@@ -68,7 +76,7 @@ namespace structures
 
 	template<typename T>
 	ExplicitQueue<T>::ExplicitQueue() :
-		Queue(),
+		Queue<T>(),
 		list_(new LinkedList<T>())
 	{
 	}
@@ -119,6 +127,14 @@ namespace structures
 		return list_->size();
 	}
 
+	template<typename T>
+	inline MemoryUsage ExplicitQueue<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(ExplicitQueue<T>));
+		result.addAllocation(list_->memoryUsage());
+		return result;
+	}
+
 	template<typename T>
 	inline void ExplicitQueue<T>::clear()
 	{
@@ -131,6 +147,12 @@ namespace structures
 		list_->add(data);
 	}
 
+	template<typename T>
+	inline void ExplicitQueue<T>::push(T&& data)
+	{
+		list_->add(std::move(data));
+	}
+
 	template<typename T>
 	inline T ExplicitQueue<T>::pop()
 	{
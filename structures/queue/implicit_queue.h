@@ -2,23 +2,30 @@
 
 #include "queue.h"
 #include "../array/array.h"
+#include "../ds_routines.h"
 
 #include <stdexcept>
+#include <algorithm>
 
 namespace structures
 {
 	/// <summary> Implicitny front. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych vo fronte. </typepram>
+	/// <remarks>
+	/// Kapacita pola je vzdy mocnina 2, pozicia v kruhu sa preto pocita maskou namiesto zvysku po deleni.
+	/// Rastuci front pri zaplneni pole zdvojnasobi, pevny front prijme najviac pozadovany pocet prvkov.
+	/// </remarks>
 	template<typename T>
-	class ImplicitQueue : public Queue<T>
+	class ImplicitQueue final : public Queue<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
 		ImplicitQueue();
 
 		/// <summary> Parametricky konstruktor. </summary>
-		/// <param name = "capacity"> Maximalna velkost frontu. </param>
-		ImplicitQueue(const size_t capacity);
+		/// <param name = "capacity"> Maximalna velkost frontu, v pripade rastuceho frontu pociatocna kapacita. </param>
+		/// <param name = "growable"> true, ak ma front pri zaplneni zvacsit pole, false, ak ma vyhodit vynimku. </param>
+		ImplicitQueue(const size_t capacity, const bool growable = false);
 
 		/// <summary> Kopirovaci konstruktor. </summary>
 		/// <param name = "other"> Implicitny front, z ktoreho sa prevezmu vlastnosti. </param>
@@ -35,6 +42,18 @@ namespace structures
 		/// <returns> Pocet prvkov vo fronte. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati pocet prvkov, ktore sa do frontu zmestia. </summary>
+		/// <returns> Kapacita frontu. Rastuci front ju pri zaplneni zvacsi. </returns>
+		size_t capacity() const;
+
+		/// <summary> Zisti, ci front pri zaplneni zvacsi pole. </summary>
+		/// <returns> true, ak je front rastuci, false inak. </returns>
+		bool isGrowable() const;
+
+		/// <summary> Vrati udaje o pamati, ktoru front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Front, z ktoreho ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento front nachadza po priradeni. </returns>
@@ -53,6 +72,11 @@ namespace structures
 		/// <exception cref="std::out_of_range"> Vyhodena, ak je front plny. </exception>  
 		void push(const T& data) override;
 
+		/// <summary> Prida prvok do frontu. Prvok do frontu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front plny. </exception>  
+		void push(T&& data) override;
+
 		/// <summary> Odstrani prvok z frontu. </summary>
 		/// <returns> Prvok na zaciatku frontu. </returns>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>  
@@ -68,6 +92,20 @@ namespace structures
 		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>  
 		const T peek() const override;
 
+		/// <summary> Prida do frontu prvky z pola. </summary>
+		/// <param name = "items"> Prvy pridavany prvok. </param>
+		/// <param name = "count"> Pocet pridavanych prvkov. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak sa prvky do pevneho frontu nezmestia. Front sa vtedy nezmeni. </exception>
+		/// <remarks> Prvky skopiruje najviac dvoma suvislymi usekmi. </remarks>
+		void pushRange(const T* items, const size_t count);
+
+		/// <summary> Odstrani z frontu najviac maxCount prvkov a presunie ich do pola. </summary>
+		/// <param name = "target"> Pole, do ktoreho sa prvky presunu, musi mat miesto aspon pre maxCount prvkov. </param>
+		/// <param name = "maxCount"> Najvacsi pocet odobranych prvkov. </param>
+		/// <returns> Pocet skutocne odobranych prvkov. </returns>
+		/// <remarks> Prvky presunie najviac dvoma suvislymi usekmi. </remarks>
+		size_t popInto(T* target, const size_t maxCount);
+
 	protected:
 		/// <summary> Pole, pomocou ktoreho je implementovany front. </summary>	
 		Array<T>* array_;
@@ -77,6 +115,23 @@ namespace structures
 
 		/// <summary> Pocet prvkov vo fronte. </summary>	
 		size_t size_;
+
+		/// <summary> Maximalny pocet prvkov pevneho frontu. </summary>	
+		size_t capacity_;
+
+		/// <summary> Ci front pri zaplneni zvacsi pole. </summary>	
+		bool growable_;
+
+	private:
+		/// <summary> Zabezpeci miesto pre dalsich count prvkov. </summary>
+		/// <param name = "count"> Pocet pridavanych prvkov. </param>
+		/// <param name = "message"> Sprava vynimky, ak sa prvky do pevneho frontu nezmestia. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak sa prvky do pevneho frontu nezmestia. </exception>
+		void reserveFor(const size_t count, const char* message);
+
+		/// <summary> Presunie prvky do noveho pola danej kapacity tak, ze prvy prvok bude na indexe 0. </summary>
+		/// <param name = "arrayCapacity"> Kapacita noveho pola, mocnina 2. </param>
+		void relocate(const size_t arrayCapacity);
 	};
 
 	template<typename T>
@@ -86,20 +141,24 @@ namespace structures
 	}
 
 	template<typename T>
-	ImplicitQueue<T>::ImplicitQueue(const size_t capacity) :
-		Queue(),
-		array_(new Array<T>(capacity)),
+	ImplicitQueue<T>::ImplicitQueue(const size_t capacity, const bool growable) :
+		Queue<T>(),
+		array_(new Array<T>(DSRoutines::ceilPowerOfTwo(capacity))),
 		startIndex_(0),
-		size_(0)
+		size_(0),
+		capacity_(capacity),
+		growable_(growable)
 	{
 	}
 
 	template<typename T>
 	ImplicitQueue<T>::ImplicitQueue(const ImplicitQueue<T>& other) :
-		Queue(other),
+		Queue<T>(other),
 		array_(new Array<T>(*other.array_)),
 		startIndex_(other.startIndex_),
-		size_(other.size_)
+		size_(other.size_),
+		capacity_(other.capacity_),
+		growable_(other.growable_)
 	{
 	}
 
@@ -127,10 +186,15 @@ namespace structures
 	{
 		if (this != &other)
 		{
-			if (other.size_ > array_->size())
+			if (!growable_ && other.size_ > capacity_)
 			{
 				throw std::out_of_range("ImplicitQueue<T>::operator=: Not enough capacity in array.");
 			}
+			if (other.size_ > array_->size())
+			{
+				delete array_;
+				array_ = new Array<T>(DSRoutines::ceilPowerOfTwo(other.size_));
+			}
 			if (other.startIndex_ + other.size_ <= other.array_->size())
 			{
 				Array<T>::copy(*other.array_, other.startIndex_, *array_, 0, static_cast<int>(other.size_));
@@ -159,6 +223,27 @@ namespace structures
 		return size_;
 	}
 
+	template<typename T>
+	inline size_t ImplicitQueue<T>::capacity() const
+	{
+		return growable_ ? array_->size() : capacity_;
+	}
+
+	template<typename T>
+	inline bool ImplicitQueue<T>::isGrowable() const
+	{
+		return growable_;
+	}
+
+	template<typename T>
+	inline MemoryUsage ImplicitQueue<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(ImplicitQueue<T>));
+		result.addAllocation(array_->memoryUsage());
+		result.bytesWasted += (array_->size() - size_) * sizeof(T);
+		return result;
+	}
+
 	template<typename T>
 	inline void ImplicitQueue<T>::clear()
 	{
@@ -169,17 +254,15 @@ namespace structures
 	template<typename T>
 	inline void ImplicitQueue<T>::push(const T& data)
 	{
-		size_t capacity = array_->size();
+		push(T(data));
+	}
 
-		if (size_ < capacity)
-		{
-			(*array_)[static_cast<int>((startIndex_ + size_) % capacity)] = data;
-			size_++;
-		}
-		else
-		{
-			throw std::out_of_range("ImplicitQueue<T>::push: Queue is full.");
-		}
+	template<typename T>
+	inline void ImplicitQueue<T>::push(T&& data)
+	{
+		reserveFor(1, "ImplicitQueue<T>::push: Queue is full.");
+		array_->data()[(startIndex_ + size_) & (array_->size() - 1)] = std::move(data);
+		size_++;
 	}
 
 
@@ -189,8 +272,8 @@ namespace structures
 		if (size_ > 0)
 		{
 			size_--;
-			T& pomData = (*array_)[startIndex_];
-			startIndex_ = ++startIndex_ % array_->size();
+			T pomData = std::move(array_->data()[startIndex_]);
+			startIndex_ = (startIndex_ + 1) & static_cast<int>(array_->size() - 1);
 			return pomData;
 		}
 		else
@@ -224,4 +307,59 @@ namespace structures
 			throw std::out_of_range("ImplicitQueue<T>::peek: Queue is empty.");
 		}
 	}
+
+	template<typename T>
+	inline void ImplicitQueue<T>::pushRange(const T* items, const size_t count)
+	{
+		reserveFor(count, "ImplicitQueue<T>::pushRange: Not enough capacity in queue.");
+		T* data = array_->data();
+		const size_t arrayCapacity = array_->size();
+		const size_t endIndex = (startIndex_ + size_) & (arrayCapacity - 1);
+		const size_t firstPart = std::min(count, arrayCapacity - endIndex);
+		std::copy(items, items + firstPart, data + endIndex);
+		std::copy(items + firstPart, items + count, data);
+		size_ += count;
+	}
+
+	template<typename T>
+	inline size_t ImplicitQueue<T>::popInto(T* target, const size_t maxCount)
+	{
+		T* data = array_->data();
+		const size_t arrayCapacity = array_->size();
+		const size_t count = std::min(maxCount, size_);
+		const size_t firstPart = std::min(count, arrayCapacity - startIndex_);
+		std::move(data + startIndex_, data + startIndex_ + firstPart, target);
+		std::move(data, data + count - firstPart, target + firstPart);
+		startIndex_ = static_cast<int>((startIndex_ + count) & (arrayCapacity - 1));
+		size_ -= count;
+		return count;
+	}
+
+	template<typename T>
+	inline void ImplicitQueue<T>::reserveFor(const size_t count, const char* message)
+	{
+		if (!growable_)
+		{
+			if (size_ + count > capacity_)
+			{
+				throw std::out_of_range(message);
+			}
+		}
+		else if (size_ + count > array_->size())
+		{
+			relocate(DSRoutines::ceilPowerOfTwo(size_ + count));
+		}
+	}
+
+	template<typename T>
+	inline void ImplicitQueue<T>::relocate(const size_t arrayCapacity)
+	{
+		const size_t count = size_;
+		Array<T>* newArray = new Array<T>(arrayCapacity);
+		popInto(newArray->data(), count);
+		delete array_;
+		array_ = newArray;
+		startIndex_ = 0;
+		size_ = count;
+	}
 }
\ No newline at end of file
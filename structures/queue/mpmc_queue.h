@@ -0,0 +1,455 @@
+#pragma once
+
+#include "queue.h"
+#include "../ds_routines.h"
+#include "../concurrency_routines.h"
+
+#include <stdexcept>
+
+namespace structures
+{
+	/// <summary> Ohraniceny front pre viacerych producentov a viacerych konzumentov (multi-producer/multi-consumer). </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych vo fronte. </typepram>
+	/// <remarks>
+	/// Kruhove pole bunek s kapacitou mocniny 2, kazda bunka ma poradove cislo (D. Vyukov).
+	/// Poradove cislo rovne pozicii znamena volnu bunku pre producenta s touto poziciou, pozicia + 1 obsadenu bunku
+	/// pre konzumenta s touto poziciou. Producenti aj konzumenti si poziciu rezervuju jednou operaciou compare-and-swap,
+	/// samotny zapis a citanie dat uz prebiehaju bez zamku a bez zdielania riadku cache s druhou stranou.
+	/// Kopirovanie, priradenie a peek nie su bezpecne pri sucasnom pouzivani frontu.
+	/// </remarks>
+	template<typename T>
+	class MpmcQueue final : public Queue<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		MpmcQueue();
+
+		/// <summary> Parametricky konstruktor. </summary>
+		/// <param name = "capacity"> Minimalna kapacita frontu, zaokruhli sa nahor na mocninu 2 (aspon 2). </param>
+		MpmcQueue(const size_t capacity);
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Front, z ktoreho sa prevezmu vlastnosti. </param>
+		MpmcQueue(const MpmcQueue<T>& other);
+
+		/// <summary> Destruktor. </summary>
+		~MpmcQueue();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat frontu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov vo fronte. </summary>
+		/// <returns> Pocet prvkov vo fronte. </returns>
+		/// <remarks> Pri sucasnom pouzivani frontu je vysledok iba odhad. </remarks>
+		size_t size() const override;
+
+		/// <summary> Vrati kapacitu frontu. </summary>
+		/// <returns> Kapacita frontu. </returns>
+		size_t capacity() const;
+
+		/// <summary> Vrati udaje o pamati, ktoru front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento front nachadza po priradeni. </returns>
+		Queue<T>& operator=(const Queue<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento front nachadza po priradeni. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak sa prvky druheho frontu do tohto nezmestia. </exception>
+		MpmcQueue<T>& operator=(const MpmcQueue<T>& other);
+
+		/// <summary> Vymaze front. Odobera prvky po jednom, preto je bezpecne aj pri sucasnom pouzivani. </summary>
+		void clear() override;
+
+		/// <summary> Prida prvok do frontu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front plny. </exception>
+		void push(const T& data) override;
+
+		/// <summary> Prida prvok do frontu. Prvok do frontu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front plny. </exception>
+		void push(T&& data) override;
+
+		/// <summary> Odstrani prvok z frontu. </summary>
+		/// <returns> Prvok na zaciatku frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>
+		T pop() override;
+
+		/// <summary> Vrati prvok na zaciatku frontu. </summary>
+		/// <returns> Prvok na zaciatku frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>
+		/// <remarks> Platny iba vtedy, ked front nepouzivaju ine vlakna. </remarks>
+		T& peek() override;
+
+		/// <summary> Vrati prvok na zaciatku frontu. </summary>
+		/// <returns> Prvok na zaciatku frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>
+		/// <remarks> Platny iba vtedy, ked front nepouzivaju ine vlakna. </remarks>
+		const T peek() const override;
+
+		/// <summary> Pokusi sa pridat prvok do frontu. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <returns> true, ak bol prvok pridany, false, ak je front plny. </returns>
+		bool tryPush(const T& data);
+
+		/// <summary> Pokusi sa pridat prvok do frontu. Prvok do frontu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <returns> true, ak bol prvok pridany, false, ak je front plny (prvok sa vtedy nepresunie). </returns>
+		bool tryPush(T&& data);
+
+		/// <summary> Pokusi sa odobrat prvok z frontu. </summary>
+		/// <param name = "data"> Premenna, do ktorej sa prvok presunie. </param>
+		/// <returns> true, ak bol prvok odobrany, false, ak je front prazdny. </returns>
+		bool tryPop(T& data);
+
+		/// <summary> Prida prvok do frontu, ak je front plny, caka (s exponencialnym odstupom), kym sa neuvolni miesto. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void pushWait(T&& data);
+
+		/// <summary> Odoberie prvok z frontu, ak je front prazdny, caka (s exponencialnym odstupom), kym sa prvok neobjavi. </summary>
+		/// <returns> Prvok na zaciatku frontu. </returns>
+		T popWait();
+
+	private:
+		/// <summary> Bunka kruhoveho pola. </summary>
+		struct Cell
+		{
+			/// <summary> Poradove cislo bunky, urcuje, ci do nej moze zapisovat producent alebo citat konzument. </summary>
+			std::atomic<size_t> sequence;
+			/// <summary> Data bunky. </summary>
+			T data;
+		};
+
+		/// <summary> Kruhove pole bunek. </summary>
+		Cell* cells_;
+		/// <summary> Maska pozicie v poli (kapacita - 1). </summary>
+		size_t mask_;
+
+		/// <summary> Oddeluje poziciu producentov od nemennych udajov. </summary>
+		char paddingEnqueue_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+		/// <summary> Pozicia, na ktoru zapise dalsi producent. </summary>
+		std::atomic<size_t> enqueuePosition_;
+
+		/// <summary> Oddeluje poziciu konzumentov od pozicie producentov. </summary>
+		char paddingDequeue_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+		/// <summary> Pozicia, z ktorej bude citat dalsi konzument. </summary>
+		std::atomic<size_t> dequeuePosition_;
+
+		/// <summary> Oddeluje poziciu konzumentov od nasledujucich objektov v pamati. </summary>
+		char paddingEnd_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+
+	private:
+		/// <summary> Vytvori kruhove pole bunek danej kapacity. </summary>
+		/// <param name = "capacity"> Kapacita, mocnina 2. </param>
+		void createCells(const size_t capacity);
+
+		/// <summary> Rezervuje bunku pre producenta. </summary>
+		/// <returns> Rezervovana bunka, nullptr, ak je front plny. </returns>
+		Cell* reserveEnqueue();
+
+		/// <summary> Skopiruje obsah druheho frontu do tohto. </summary>
+		/// <param name = "other"> Front, z ktoreho sa kopiruje. </param>
+		void copyFrom(const MpmcQueue<T>& other);
+	};
+
+	template<typename T>
+	inline MpmcQueue<T>::MpmcQueue() :
+		MpmcQueue(1024)
+	{
+	}
+
+	template<typename T>
+	inline MpmcQueue<T>::MpmcQueue(const size_t capacity) :
+		Queue<T>(),
+		cells_(nullptr),
+		mask_(0),
+		enqueuePosition_(0),
+		dequeuePosition_(0)
+	{
+		createCells(DSRoutines::ceilPowerOfTwo(capacity < 2 ? 2 : capacity));
+	}
+
+	template<typename T>
+	inline MpmcQueue<T>::MpmcQueue(const MpmcQueue<T>& other) :
+		Queue<T>(other),
+		cells_(nullptr),
+		mask_(0),
+		enqueuePosition_(0),
+		dequeuePosition_(0)
+	{
+		createCells(other.capacity());
+		copyFrom(other);
+	}
+
+	template<typename T>
+	inline MpmcQueue<T>::~MpmcQueue()
+	{
+		delete[] cells_;
+		cells_ = nullptr;
+	}
+
+	template<typename T>
+	inline Structure* MpmcQueue<T>::clone() const
+	{
+		return new MpmcQueue<T>(*this);
+	}
+
+	template<typename T>
+	inline size_t MpmcQueue<T>::size() const
+	{
+		const size_t dequeuePosition = dequeuePosition_.load(std::memory_order_acquire);
+		const size_t enqueuePosition = enqueuePosition_.load(std::memory_order_acquire);
+		// Rezervovane, ale este nezapisane bunky sa tiez pocitaju, preto moze byt odhad aj vacsi ako kapacita.
+		const size_t result = enqueuePosition - dequeuePosition;
+		return enqueuePosition < dequeuePosition ? 0 : (result > capacity() ? capacity() : result);
+	}
+
+	template<typename T>
+	inline size_t MpmcQueue<T>::capacity() const
+	{
+		return mask_ + 1;
+	}
+
+	template<typename T>
+	inline MemoryUsage MpmcQueue<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(MpmcQueue<T>), 3 * ConcurrencyRoutines::CACHE_LINE_SIZE);
+		result.addAllocations(capacity() * sizeof(Cell), 1, (capacity() - size()) * sizeof(T));
+		return result;
+	}
+
+	template<typename T>
+	inline Queue<T>& MpmcQueue<T>::operator=(const Queue<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const MpmcQueue<T>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline MpmcQueue<T>& MpmcQueue<T>::operator=(const MpmcQueue<T>& other)
+	{
+		if (this != &other)
+		{
+			if (other.size() > capacity())
+			{
+				throw std::out_of_range("MpmcQueue<T>::operator=: Not enough capacity in array.");
+			}
+			copyFrom(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline void MpmcQueue<T>::clear()
+	{
+		T data;
+		while (tryPop(data))
+		{
+		}
+	}
+
+	template<typename T>
+	inline void MpmcQueue<T>::push(const T& data)
+	{
+		if (!tryPush(data))
+		{
+			throw std::out_of_range("MpmcQueue<T>::push: Queue is full.");
+		}
+	}
+
+	template<typename T>
+	inline void MpmcQueue<T>::push(T&& data)
+	{
+		if (!tryPush(std::move(data)))
+		{
+			throw std::out_of_range("MpmcQueue<T>::push: Queue is full.");
+		}
+	}
+
+	template<typename T>
+	inline T MpmcQueue<T>::pop()
+	{
+		T result;
+		if (!tryPop(result))
+		{
+			throw std::out_of_range("MpmcQueue<T>::pop: Queue is empty.");
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline T& MpmcQueue<T>::peek()
+	{
+		const size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+		Cell& cell = cells_[position & mask_];
+		if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+		{
+			throw std::out_of_range("MpmcQueue<T>::peek: Queue is empty.");
+		}
+		return cell.data;
+	}
+
+	template<typename T>
+	inline const T MpmcQueue<T>::peek() const
+	{
+		const size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+		const Cell& cell = cells_[position & mask_];
+		if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+		{
+			throw std::out_of_range("MpmcQueue<T>::peek: Queue is empty.");
+		}
+		return cell.data;
+	}
+
+	template<typename T>
+	inline bool MpmcQueue<T>::tryPush(const T& data)
+	{
+		Cell* cell = reserveEnqueue();
+		if (cell == nullptr)
+		{
+			return false;
+		}
+		cell->data = data;
+		cell->sequence.store(cell->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename T>
+	inline bool MpmcQueue<T>::tryPush(T&& data)
+	{
+		Cell* cell = reserveEnqueue();
+		if (cell == nullptr)
+		{
+			return false;
+		}
+		cell->data = std::move(data);
+		cell->sequence.store(cell->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename T>
+	inline bool MpmcQueue<T>::tryPop(T& data)
+	{
+		size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+		Cell* cell;
+		while (true)
+		{
+			cell = &cells_[position & mask_];
+			const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - (position + 1));
+			if (difference == 0)
+			{
+				if (dequeuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (difference < 0)
+			{
+				// Bunka este neobsahuje prvok z tohto kola, front je prazdny.
+				return false;
+			}
+			else
+			{
+				position = dequeuePosition_.load(std::memory_order_relaxed);
+			}
+		}
+		data = std::move(cell->data);
+		// Bunka sa uvolni pre producenta o jedno kolo neskor.
+		cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename T>
+	inline void MpmcQueue<T>::pushWait(T&& data)
+	{
+		Backoff backoff;
+		Cell* cell = reserveEnqueue();
+		while (cell == nullptr)
+		{
+			backoff.pause();
+			cell = reserveEnqueue();
+		}
+		cell->data = std::move(data);
+		cell->sequence.store(cell->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	template<typename T>
+	inline T MpmcQueue<T>::popWait()
+	{
+		Backoff backoff;
+		T result;
+		while (!tryPop(result))
+		{
+			backoff.pause();
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline void MpmcQueue<T>::createCells(const size_t capacity)
+	{
+		cells_ = new Cell[capacity];
+		mask_ = capacity - 1;
+		for (size_t i = 0; i < capacity; i++)
+		{
+			cells_[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	template<typename T>
+	inline typename MpmcQueue<T>::Cell* MpmcQueue<T>::reserveEnqueue()
+	{
+		size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Cell* cell = &cells_[position & mask_];
+			const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - position);
+			if (difference == 0)
+			{
+				if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					return cell;
+				}
+			}
+			else if (difference < 0)
+			{
+				// Bunku z minuleho kola este neprecital konzument, front je plny.
+				return nullptr;
+			}
+			else
+			{
+				position = enqueuePosition_.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	template<typename T>
+	inline void MpmcQueue<T>::copyFrom(const MpmcQueue<T>& other)
+	{
+		const size_t first = other.dequeuePosition_.load(std::memory_order_acquire);
+		const size_t last = other.enqueuePosition_.load(std::memory_order_acquire);
+		for (size_t i = 0; i <= mask_; i++)
+		{
+			cells_[i].sequence.store(i, std::memory_order_relaxed);
+		}
+		size_t count = 0;
+		for (size_t position = first; position != last; position++, count++)
+		{
+			cells_[count].data = other.cells_[position & other.mask_].data;
+			cells_[count].sequence.store(count + 1, std::memory_order_relaxed);
+		}
+		dequeuePosition_.store(0, std::memory_order_relaxed);
+		enqueuePosition_.store(count, std::memory_order_release);
+	}
+}
@@ -41,6 +41,17 @@ namespace structures
 		/// <remarks> Operacia moze vyhodit vynimku v pripade frontu s pevnou kapacitou. </remarks>
 		virtual void push(const T& data) = 0;
 
+		/// <summary> Prida prvok do frontu. Prvok do frontu presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <remarks> Operacia moze vyhodit vynimku v pripade frontu s pevnou kapacitou. </remarks>
+		virtual void push(T&& data) = 0;
+
+		/// <summary> Vytvori prvok z argumentov a prida ho do frontu. </summary>
+		/// <param name = "args"> Argumenty konstruktora pridavaneho prvku. </param>
+		/// <remarks> Prvok sa vytvori raz a do frontu sa presunie, nekopiruje sa. </remarks>
+		template<typename... Args>
+		void emplace(Args&&... args);
+
 		/// <summary> Odstrani prvok z frontu. </summary>
 		/// <returns> Prvok frontu. </returns>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>  
@@ -80,6 +91,13 @@ namespace structures
 		return *this;
 	}
 
+	template<typename T>
+	template<typename... Args>
+	inline void Queue<T>::emplace(Args&&... args)
+	{
+		this->push(T(std::forward<Args>(args)...));
+	}
+
 	template<typename T>
 	inline Queue<T>::Queue() :
 		Structure()
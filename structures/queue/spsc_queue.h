@@ -0,0 +1,428 @@
+#pragma once
+
+#include "queue.h"
+#include "../array/array.h"
+#include "../ds_routines.h"
+#include "../concurrency_routines.h"
+
+#include <stdexcept>
+#include <algorithm>
+
+namespace structures
+{
+	/// <summary> Front pre jedneho producenta a jedneho konzumenta (single-producer/single-consumer). </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych vo fronte. </typepram>
+	/// <remarks>
+	/// Prvky su ulozene v kruhovom poli s kapacitou mocniny 2 ako v ImplicitQueue. Producent zapisuje iba koniec frontu
+	/// a konzument iba zaciatok, obe pozicie su atomicke (release/acquire) a lezia na roznych riadkoch cache.
+	/// Kazda strana si pamata posledne videnu poziciu druhej strany a cita ju znova az vtedy, ked sa jej zda front plny (prazdny).
+	/// Operacie push, tryPush a pushBatch smie volat iba jedno vlakno (producent), operacie pop, tryPop, popBatch, peek a clear
+	/// iba jedno ine vlakno (konzument). Kopirovanie a priradenie nie su bezpecne pri sucasnom pouzivani frontu.
+	/// </remarks>
+	template<typename T>
+	class SpscQueue final : public Queue<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		SpscQueue();
+
+		/// <summary> Parametricky konstruktor. </summary>
+		/// <param name = "capacity"> Minimalna kapacita frontu, zaokruhli sa nahor na mocninu 2. </param>
+		SpscQueue(const size_t capacity);
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Front, z ktoreho sa prevezmu vlastnosti. </param>
+		SpscQueue(const SpscQueue<T>& other);
+
+		/// <summary> Destruktor. </summary>
+		~SpscQueue();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat frontu. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov vo fronte. </summary>
+		/// <returns> Pocet prvkov vo fronte. </returns>
+		/// <remarks> Pri sucasnom pouzivani frontu je vysledok iba odhad. </remarks>
+		size_t size() const override;
+
+		/// <summary> Vrati kapacitu frontu. </summary>
+		/// <returns> Kapacita frontu. </returns>
+		size_t capacity() const;
+
+		/// <summary> Vrati udaje o pamati, ktoru front obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru front obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento front nachadza po priradeni. </returns>
+		Queue<T>& operator=(const Queue<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Front, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento front nachadza po priradeni. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak sa prvky druheho frontu do tohto nezmestia. </exception>
+		SpscQueue<T>& operator=(const SpscQueue<T>& other);
+
+		/// <summary> Vymaze front. Smie volat iba konzument. </summary>
+		void clear() override;
+
+		/// <summary> Prida prvok do frontu. Smie volat iba producent. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front plny. </exception>
+		void push(const T& data) override;
+
+		/// <summary> Prida prvok do frontu. Prvok do frontu presunie. Smie volat iba producent. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front plny. </exception>
+		void push(T&& data) override;
+
+		/// <summary> Odstrani prvok z frontu. Smie volat iba konzument. </summary>
+		/// <returns> Prvok na zaciatku frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>
+		T pop() override;
+
+		/// <summary> Vrati prvok na zaciatku frontu. Smie volat iba konzument. </summary>
+		/// <returns> Prvok na zaciatku frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>
+		T& peek() override;
+
+		/// <summary> Vrati prvok na zaciatku frontu. Smie volat iba konzument. </summary>
+		/// <returns> Prvok na zaciatku frontu. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je front prazdny. </exception>
+		const T peek() const override;
+
+		/// <summary> Pokusi sa pridat prvok do frontu. Smie volat iba producent. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <returns> true, ak bol prvok pridany, false, ak je front plny. </returns>
+		bool tryPush(const T& data);
+
+		/// <summary> Pokusi sa pridat prvok do frontu. Prvok do frontu presunie. Smie volat iba producent. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		/// <returns> true, ak bol prvok pridany, false, ak je front plny (prvok sa vtedy nepresunie). </returns>
+		bool tryPush(T&& data);
+
+		/// <summary> Pokusi sa odobrat prvok z frontu. Smie volat iba konzument. </summary>
+		/// <param name = "data"> Premenna, do ktorej sa prvok presunie. </param>
+		/// <returns> true, ak bol prvok odobrany, false, ak je front prazdny. </returns>
+		bool tryPop(T& data);
+
+		/// <summary> Prida do frontu co najviac prvkov z pola. Smie volat iba producent. </summary>
+		/// <param name = "items"> Prvy pridavany prvok. </param>
+		/// <param name = "count"> Pocet pridavanych prvkov. </param>
+		/// <returns> Pocet pridanych prvkov, ostatne sa do frontu nezmestili. </returns>
+		/// <remarks> Prvky skopiruje najviac dvoma suvislymi usekmi a zverejni ich jednym atomickym zapisom. </remarks>
+		size_t pushBatch(const T* items, const size_t count);
+
+		/// <summary> Odoberie z frontu najviac maxCount prvkov a presunie ich do pola. Smie volat iba konzument. </summary>
+		/// <param name = "target"> Pole, do ktoreho sa prvky presunu, musi mat miesto aspon pre maxCount prvkov. </param>
+		/// <param name = "maxCount"> Najvacsi pocet odobranych prvkov. </param>
+		/// <returns> Pocet odobranych prvkov. </returns>
+		/// <remarks> Prvky presunie najviac dvoma suvislymi usekmi a uvolni ich miesto jednym atomickym zapisom. </remarks>
+		size_t popBatch(T* target, const size_t maxCount);
+
+	private:
+		/// <summary> Pole, pomocou ktoreho je implementovany front. </summary>
+		Array<T>* array_;
+		/// <summary> Maska pozicie v poli (kapacita - 1). </summary>
+		size_t mask_;
+
+		/// <summary> Oddeluje poziciu konzumenta od nemennych udajov. </summary>
+		char paddingHead_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+		/// <summary> Pocet doteraz odobranych prvkov, zapisuje iba konzument. </summary>
+		std::atomic<size_t> head_;
+		/// <summary> Posledna pozicia konca frontu, ktoru konzument videl. </summary>
+		size_t cachedTail_;
+
+		/// <summary> Oddeluje poziciu producenta od pozicie konzumenta. </summary>
+		char paddingTail_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+		/// <summary> Pocet doteraz pridanych prvkov, zapisuje iba producent. </summary>
+		std::atomic<size_t> tail_;
+		/// <summary> Posledna pozicia zaciatku frontu, ktoru producent videl. </summary>
+		size_t cachedHead_;
+
+		/// <summary> Oddeluje poziciu producenta od nasledujucich objektov v pamati. </summary>
+		char paddingEnd_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+
+	private:
+		/// <summary> Vrati pocet volnych miest z pohladu producenta, ak treba, znova nacita zaciatok frontu. </summary>
+		/// <param name = "tail"> Aktualna pozicia konca frontu. </param>
+		/// <param name = "needed"> Pocet miest, ktore producent potrebuje. </param>
+		/// <returns> Pocet volnych miest. </returns>
+		size_t freeSlots(const size_t tail, const size_t needed);
+
+		/// <summary> Vrati pocet dostupnych prvkov z pohladu konzumenta, ak treba, znova nacita koniec frontu. </summary>
+		/// <param name = "head"> Aktualna pozicia zaciatku frontu. </param>
+		/// <param name = "needed"> Pocet prvkov, ktore konzument potrebuje. </param>
+		/// <returns> Pocet dostupnych prvkov. </returns>
+		size_t availableItems(const size_t head, const size_t needed);
+
+		/// <summary> Skopiruje obsah druheho frontu do tohto, od indexu 0. </summary>
+		/// <param name = "other"> Front, z ktoreho sa kopiruje. </param>
+		void copyFrom(const SpscQueue<T>& other);
+	};
+
+	template<typename T>
+	inline SpscQueue<T>::SpscQueue() :
+		SpscQueue(1024)
+	{
+	}
+
+	template<typename T>
+	inline SpscQueue<T>::SpscQueue(const size_t capacity) :
+		Queue<T>(),
+		array_(new Array<T>(DSRoutines::ceilPowerOfTwo(capacity))),
+		mask_(array_->size() - 1),
+		head_(0),
+		cachedTail_(0),
+		tail_(0),
+		cachedHead_(0)
+	{
+	}
+
+	template<typename T>
+	inline SpscQueue<T>::SpscQueue(const SpscQueue<T>& other) :
+		Queue<T>(other),
+		array_(new Array<T>(other.array_->size())),
+		mask_(other.mask_),
+		head_(0),
+		cachedTail_(0),
+		tail_(0),
+		cachedHead_(0)
+	{
+		copyFrom(other);
+	}
+
+	template<typename T>
+	inline SpscQueue<T>::~SpscQueue()
+	{
+		delete array_;
+		array_ = nullptr;
+	}
+
+	template<typename T>
+	inline Structure* SpscQueue<T>::clone() const
+	{
+		return new SpscQueue<T>(*this);
+	}
+
+	template<typename T>
+	inline size_t SpscQueue<T>::size() const
+	{
+		// Zaciatok sa cita prvy, koniec nemoze byt pred nim.
+		const size_t head = head_.load(std::memory_order_acquire);
+		return tail_.load(std::memory_order_acquire) - head;
+	}
+
+	template<typename T>
+	inline size_t SpscQueue<T>::capacity() const
+	{
+		return mask_ + 1;
+	}
+
+	template<typename T>
+	inline MemoryUsage SpscQueue<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(SpscQueue<T>), 3 * ConcurrencyRoutines::CACHE_LINE_SIZE);
+		result.addAllocation(array_->memoryUsage());
+		result.bytesWasted += (capacity() - size()) * sizeof(T);
+		return result;
+	}
+
+	template<typename T>
+	inline Queue<T>& SpscQueue<T>::operator=(const Queue<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const SpscQueue<T>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline SpscQueue<T>& SpscQueue<T>::operator=(const SpscQueue<T>& other)
+	{
+		if (this != &other)
+		{
+			if (other.size() > capacity())
+			{
+				throw std::out_of_range("SpscQueue<T>::operator=: Not enough capacity in array.");
+			}
+			copyFrom(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline void SpscQueue<T>::clear()
+	{
+		cachedTail_ = tail_.load(std::memory_order_acquire);
+		head_.store(cachedTail_, std::memory_order_release);
+	}
+
+	template<typename T>
+	inline void SpscQueue<T>::push(const T& data)
+	{
+		if (!tryPush(data))
+		{
+			throw std::out_of_range("SpscQueue<T>::push: Queue is full.");
+		}
+	}
+
+	template<typename T>
+	inline void SpscQueue<T>::push(T&& data)
+	{
+		if (!tryPush(std::move(data)))
+		{
+			throw std::out_of_range("SpscQueue<T>::push: Queue is full.");
+		}
+	}
+
+	template<typename T>
+	inline T SpscQueue<T>::pop()
+	{
+		T result;
+		if (!tryPop(result))
+		{
+			throw std::out_of_range("SpscQueue<T>::pop: Queue is empty.");
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline T& SpscQueue<T>::peek()
+	{
+		const size_t head = head_.load(std::memory_order_relaxed);
+		if (availableItems(head, 1) == 0)
+		{
+			throw std::out_of_range("SpscQueue<T>::peek: Queue is empty.");
+		}
+		return array_->data()[head & mask_];
+	}
+
+	template<typename T>
+	inline const T SpscQueue<T>::peek() const
+	{
+		const size_t head = head_.load(std::memory_order_relaxed);
+		if (tail_.load(std::memory_order_acquire) == head)
+		{
+			throw std::out_of_range("SpscQueue<T>::peek: Queue is empty.");
+		}
+		return array_->data()[head & mask_];
+	}
+
+	template<typename T>
+	inline bool SpscQueue<T>::tryPush(const T& data)
+	{
+		const size_t tail = tail_.load(std::memory_order_relaxed);
+		if (freeSlots(tail, 1) == 0)
+		{
+			return false;
+		}
+		array_->data()[tail & mask_] = data;
+		tail_.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename T>
+	inline bool SpscQueue<T>::tryPush(T&& data)
+	{
+		const size_t tail = tail_.load(std::memory_order_relaxed);
+		if (freeSlots(tail, 1) == 0)
+		{
+			return false;
+		}
+		array_->data()[tail & mask_] = std::move(data);
+		tail_.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename T>
+	inline bool SpscQueue<T>::tryPop(T& data)
+	{
+		const size_t head = head_.load(std::memory_order_relaxed);
+		if (availableItems(head, 1) == 0)
+		{
+			return false;
+		}
+		data = std::move(array_->data()[head & mask_]);
+		head_.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	template<typename T>
+	inline size_t SpscQueue<T>::pushBatch(const T* items, const size_t count)
+	{
+		const size_t tail = tail_.load(std::memory_order_relaxed);
+		const size_t pushed = std::min(count, freeSlots(tail, count));
+		if (pushed > 0)
+		{
+			T* data = array_->data();
+			const size_t start = tail & mask_;
+			const size_t firstPart = std::min(pushed, capacity() - start);
+			std::copy(items, items + firstPart, data + start);
+			std::copy(items + firstPart, items + pushed, data);
+			tail_.store(tail + pushed, std::memory_order_release);
+		}
+		return pushed;
+	}
+
+	template<typename T>
+	inline size_t SpscQueue<T>::popBatch(T* target, const size_t maxCount)
+	{
+		const size_t head = head_.load(std::memory_order_relaxed);
+		const size_t popped = std::min(maxCount, availableItems(head, maxCount));
+		if (popped > 0)
+		{
+			T* data = array_->data();
+			const size_t start = head & mask_;
+			const size_t firstPart = std::min(popped, capacity() - start);
+			std::move(data + start, data + start + firstPart, target);
+			std::move(data, data + popped - firstPart, target + firstPart);
+			head_.store(head + popped, std::memory_order_release);
+		}
+		return popped;
+	}
+
+	template<typename T>
+	inline size_t SpscQueue<T>::freeSlots(const size_t tail, const size_t needed)
+	{
+		size_t result = capacity() - (tail - cachedHead_);
+		if (result < needed)
+		{
+			cachedHead_ = head_.load(std::memory_order_acquire);
+			result = capacity() - (tail - cachedHead_);
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline size_t SpscQueue<T>::availableItems(const size_t head, const size_t needed)
+	{
+		size_t result = cachedTail_ - head;
+		if (result < needed)
+		{
+			cachedTail_ = tail_.load(std::memory_order_acquire);
+			result = cachedTail_ - head;
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline void SpscQueue<T>::copyFrom(const SpscQueue<T>& other)
+	{
+		const size_t head = other.head_.load(std::memory_order_acquire);
+		const size_t count = other.tail_.load(std::memory_order_acquire) - head;
+		const T* source = other.array_->data();
+		T* data = array_->data();
+		for (size_t i = 0; i < count; i++)
+		{
+			data[i] = source[(head + i) & other.mask_];
+		}
+		head_.store(0, std::memory_order_relaxed);
+		tail_.store(count, std::memory_order_release);
+		cachedHead_ = 0;
+		cachedTail_ = count;
+	}
+}
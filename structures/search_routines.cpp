@@ -0,0 +1,369 @@
+#include "search_routines.h"
+
+#include <stdexcept>
+
+#if DS_SEARCH_SIMD
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define DS_TARGET_SSE2
+#define DS_TARGET_AVX2
+#else
+#define DS_TARGET_SSE2 __attribute__((target("sse2")))
+#define DS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// Vektorove instrukcie sa nedaju prelozit do MSIL, jadra sa vzdy prekladaju ako nativny kod.
+#ifdef _MANAGED
+#pragma managed(push, off)
+#endif
+
+namespace structures {
+
+	namespace {
+
+		/// <summary> Skalarne prehladavanie, pouzije sa na zvysok pola, ktory nevyplni cely register. </summary>
+		template<typename Lane>
+		int scanScalar(const Lane* items, int start, int count, Lane value, bool countAll, int found)
+		{
+			for (int i = start; i < count; i++)
+			{
+				if (items[i] == value)
+				{
+					if (!countAll)
+					{
+						return i;
+					}
+					found++;
+				}
+			}
+			return countAll ? found : -1;
+		}
+
+#if DS_SEARCH_SIMD
+		/// <summary> Vrati poradie najnizsieho nastaveneho bitu masky, maska nesmie byt 0. </summary>
+		inline int lowestBit(unsigned int mask)
+		{
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return static_cast<int>(index);
+#else
+			return __builtin_ctz(mask);
+#endif
+		}
+
+		/// <summary> Vrati pocet nastavenych bitov 32-bitovej masky (scitanim po dvojiciach, stvoriciach a bajtoch). </summary>
+		inline int bitCount(unsigned int mask)
+		{
+			mask = mask - ((mask >> 1) & 0x55555555u);
+			mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+			return static_cast<int>((((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+		}
+
+		/// <summary> Operacie SSE2 pre dany typ prvku: rozkopirovanie hodnoty a maska zhod (bajt po bajte). </summary>
+		template<typename Lane> struct Sse2Ops;
+
+		template<> struct Sse2Ops<std::int8_t>
+		{
+			typedef __m128i Vector;
+			DS_TARGET_SSE2 static Vector broadcast(std::int8_t value) { return _mm_set1_epi8(value); }
+			DS_TARGET_SSE2 static unsigned int mask(const std::int8_t* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(items)), needle)));
+			}
+		};
+
+		template<> struct Sse2Ops<std::int16_t>
+		{
+			typedef __m128i Vector;
+			DS_TARGET_SSE2 static Vector broadcast(std::int16_t value) { return _mm_set1_epi16(value); }
+			DS_TARGET_SSE2 static unsigned int mask(const std::int16_t* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(items)), needle)));
+			}
+		};
+
+		template<> struct Sse2Ops<std::int32_t>
+		{
+			typedef __m128i Vector;
+			DS_TARGET_SSE2 static Vector broadcast(std::int32_t value) { return _mm_set1_epi32(value); }
+			DS_TARGET_SSE2 static unsigned int mask(const std::int32_t* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(items)), needle)));
+			}
+		};
+
+		template<> struct Sse2Ops<std::int64_t>
+		{
+			typedef __m128i Vector;
+			DS_TARGET_SSE2 static Vector broadcast(std::int64_t value) { return _mm_set1_epi64x(value); }
+			DS_TARGET_SSE2 static unsigned int mask(const std::int64_t* items, Vector needle)
+			{
+				// SSE2 nema porovnanie 64-bitovych cisel, zhodovat sa musia obe 32-bitove polovice.
+				__m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(items)), needle);
+				equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+				return static_cast<unsigned int>(_mm_movemask_epi8(equal));
+			}
+		};
+
+		template<> struct Sse2Ops<float>
+		{
+			typedef __m128 Vector;
+			DS_TARGET_SSE2 static Vector broadcast(float value) { return _mm_set1_ps(value); }
+			DS_TARGET_SSE2 static unsigned int mask(const float* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(items), needle))));
+			}
+		};
+
+		template<> struct Sse2Ops<double>
+		{
+			typedef __m128d Vector;
+			DS_TARGET_SSE2 static Vector broadcast(double value) { return _mm_set1_pd(value); }
+			DS_TARGET_SSE2 static unsigned int mask(const double* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(_mm_loadu_pd(items), needle))));
+			}
+		};
+
+		/// <summary> Operacie AVX2 pre dany typ prvku: rozkopirovanie hodnoty a maska zhod (bajt po bajte). </summary>
+		template<typename Lane> struct Avx2Ops;
+
+		template<> struct Avx2Ops<std::int8_t>
+		{
+			typedef __m256i Vector;
+			DS_TARGET_AVX2 static Vector broadcast(std::int8_t value) { return _mm256_set1_epi8(value); }
+			DS_TARGET_AVX2 static unsigned int mask(const std::int8_t* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(items)), needle)));
+			}
+		};
+
+		template<> struct Avx2Ops<std::int16_t>
+		{
+			typedef __m256i Vector;
+			DS_TARGET_AVX2 static Vector broadcast(std::int16_t value) { return _mm256_set1_epi16(value); }
+			DS_TARGET_AVX2 static unsigned int mask(const std::int16_t* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(items)), needle)));
+			}
+		};
+
+		template<> struct Avx2Ops<std::int32_t>
+		{
+			typedef __m256i Vector;
+			DS_TARGET_AVX2 static Vector broadcast(std::int32_t value) { return _mm256_set1_epi32(value); }
+			DS_TARGET_AVX2 static unsigned int mask(const std::int32_t* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(items)), needle)));
+			}
+		};
+
+		template<> struct Avx2Ops<std::int64_t>
+		{
+			typedef __m256i Vector;
+			DS_TARGET_AVX2 static Vector broadcast(std::int64_t value) { return _mm256_set1_epi64x(value); }
+			DS_TARGET_AVX2 static unsigned int mask(const std::int64_t* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(items)), needle)));
+			}
+		};
+
+		template<> struct Avx2Ops<float>
+		{
+			typedef __m256 Vector;
+			DS_TARGET_AVX2 static Vector broadcast(float value) { return _mm256_set1_ps(value); }
+			DS_TARGET_AVX2 static unsigned int mask(const float* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(items), needle, _CMP_EQ_OQ))));
+			}
+		};
+
+		template<> struct Avx2Ops<double>
+		{
+			typedef __m256d Vector;
+			DS_TARGET_AVX2 static Vector broadcast(double value) { return _mm256_set1_pd(value); }
+			DS_TARGET_AVX2 static unsigned int mask(const double* items, Vector needle)
+			{
+				return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(items), needle, _CMP_EQ_OQ))));
+			}
+		};
+
+		/// <summary> Prehladavanie po 16 bajtoch pomocou SSE2. </summary>
+		template<typename Lane>
+		DS_TARGET_SSE2 int scanSse2(const Lane* items, int count, Lane value, bool countAll)
+		{
+			typedef Sse2Ops<Lane> Ops;
+			const int lanes = static_cast<int>(sizeof(typename Ops::Vector) / sizeof(Lane));
+			const typename Ops::Vector needle = Ops::broadcast(value);
+			int found = 0;
+			int i = 0;
+			for (; i + lanes <= count; i += lanes)
+			{
+				unsigned int mask = Ops::mask(items + i, needle);
+				if (mask != 0)
+				{
+					if (!countAll)
+					{
+						return i + lowestBit(mask) / static_cast<int>(sizeof(Lane));
+					}
+					found += bitCount(mask) / static_cast<int>(sizeof(Lane));
+				}
+			}
+			return scanScalar(items, i, count, value, countAll, found);
+		}
+
+		/// <summary> Prehladavanie po 32 bajtoch pomocou AVX2. </summary>
+		template<typename Lane>
+		DS_TARGET_AVX2 int scanAvx2(const Lane* items, int count, Lane value, bool countAll)
+		{
+			typedef Avx2Ops<Lane> Ops;
+			const int lanes = static_cast<int>(sizeof(typename Ops::Vector) / sizeof(Lane));
+			const typename Ops::Vector needle = Ops::broadcast(value);
+			int found = 0;
+			int i = 0;
+			for (; i + lanes <= count; i += lanes)
+			{
+				unsigned int mask = Ops::mask(items + i, needle);
+				if (mask != 0)
+				{
+					if (!countAll)
+					{
+						return i + lowestBit(mask) / static_cast<int>(sizeof(Lane));
+					}
+					found += bitCount(mask) / static_cast<int>(sizeof(Lane));
+				}
+			}
+			return scanScalar(items, i, count, value, countAll, found);
+		}
+
+		/// <summary> Zisti podporu AVX2 procesorom aj operacnym systemom (ulozenie registrov YMM). </summary>
+		bool detectAVX2()
+		{
+#ifdef _MSC_VER
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7)
+			{
+				return false;
+			}
+			__cpuid(info, 1);
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool avx = (info[2] & (1 << 28)) != 0;
+			if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+			{
+				return false;
+			}
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#else
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") != 0;
+#endif
+		}
+
+		/// <summary> Vyberie jadro podla procesora. </summary>
+		template<typename Lane>
+		int dispatch(const Lane* items, int count, Lane value, bool countAll)
+		{
+			return SearchRoutines::isAVX2Supported() ? scanAvx2(items, count, value, countAll) : scanSse2(items, count, value, countAll);
+		}
+#else
+		template<typename Lane>
+		int dispatch(const Lane* items, int count, Lane value, bool countAll)
+		{
+			return scanScalar(items, 0, count, value, countAll, 0);
+		}
+#endif
+	}
+
+	bool SearchRoutines::isAVX2Supported()
+	{
+#if DS_SEARCH_SIMD
+		static const bool supported = detectAVX2();
+		return supported;
+#else
+		return false;
+#endif
+	}
+
+	bool SearchRoutines::isKernelSupported(SearchKernel kernel)
+	{
+		switch (kernel)
+		{
+		case skSCALAR:
+			return true;
+#if DS_SEARCH_SIMD
+		case skSSE2:
+			return true;
+		case skAVX2:
+			return isAVX2Supported();
+#endif
+		default:
+			return false;
+		}
+	}
+
+	template<typename Lane>
+	int SearchRoutines::scanWith(SearchKernel kernel, const Lane* items, int count, Lane value, bool countAll)
+	{
+		if (!isKernelSupported(kernel))
+		{
+			throw std::invalid_argument("SearchRoutines::scanWith: Kernel is not supported.");
+		}
+		switch (kernel)
+		{
+#if DS_SEARCH_SIMD
+		case skSSE2:
+			return scanSse2(items, count, value, countAll);
+		case skAVX2:
+			return scanAvx2(items, count, value, countAll);
+#endif
+		default:
+			return scanScalar(items, 0, count, value, countAll, 0);
+		}
+	}
+
+	template int SearchRoutines::scanWith<std::int8_t>(SearchKernel, const std::int8_t*, int, std::int8_t, bool);
+	template int SearchRoutines::scanWith<std::int16_t>(SearchKernel, const std::int16_t*, int, std::int16_t, bool);
+	template int SearchRoutines::scanWith<std::int32_t>(SearchKernel, const std::int32_t*, int, std::int32_t, bool);
+	template int SearchRoutines::scanWith<std::int64_t>(SearchKernel, const std::int64_t*, int, std::int64_t, bool);
+	template int SearchRoutines::scanWith<float>(SearchKernel, const float*, int, float, bool);
+	template int SearchRoutines::scanWith<double>(SearchKernel, const double*, int, double, bool);
+
+	int SearchRoutines::scan(const std::int8_t* items, int count, std::int8_t value, bool countAll)
+	{
+		return dispatch(items, count, value, countAll);
+	}
+
+	int SearchRoutines::scan(const std::int16_t* items, int count, std::int16_t value, bool countAll)
+	{
+		return dispatch(items, count, value, countAll);
+	}
+
+	int SearchRoutines::scan(const std::int32_t* items, int count, std::int32_t value, bool countAll)
+	{
+		return dispatch(items, count, value, countAll);
+	}
+
+	int SearchRoutines::scan(const std::int64_t* items, int count, std::int64_t value, bool countAll)
+	{
+		return dispatch(items, count, value, countAll);
+	}
+
+	int SearchRoutines::scan(const float* items, int count, float value, bool countAll)
+	{
+		return dispatch(items, count, value, countAll);
+	}
+
+	int SearchRoutines::scan(const double* items, int count, double value, bool countAll)
+	{
+		return dispatch(items, count, value, countAll);
+	}
+}
+
+#ifdef _MANAGED
+#pragma managed(pop)
+#endif
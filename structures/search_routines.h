@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Vektorove (SSE2/AVX2) prehladavanie je k dispozicii iba na procesoroch x86.
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define DS_SEARCH_SIMD 1
+#else
+#define DS_SEARCH_SIMD 0
+#endif
+
+namespace structures {
+
+	/// <summary> Typ, ako ktory sa porovnavaju prvky typu T vo vektorovom prehladavani. </summary>
+	/// <remarks> Celociselne typy sa porovnavaju po bitoch, float a double ako cisla, ostatne typy (void) sa prehladavaju skalarne. </remarks>
+	template<typename T, bool Integral = std::is_integral<T>::value, size_t Size = sizeof(T)>
+	struct SearchLane { typedef void type; };
+	template<typename T> struct SearchLane<T, true, 1> { typedef std::int8_t type; };
+	template<typename T> struct SearchLane<T, true, 2> { typedef std::int16_t type; };
+	template<typename T> struct SearchLane<T, true, 4> { typedef std::int32_t type; };
+	template<typename T> struct SearchLane<T, true, 8> { typedef std::int64_t type; };
+	template<> struct SearchLane<float, false, sizeof(float)> { typedef float type; };
+	template<> struct SearchLane<double, false, sizeof(double)> { typedef double type; };
+
+	/// <summary> Jadro, ktorym sa prehladava pamat. </summary>
+	enum SearchKernel {
+		skSCALAR,
+		skSSE2,
+		skAVX2,
+	};
+
+	/// <summary>
+	/// Kniznicna trieda obsahujuca rutiny na linearne prehladavanie suvislej pamate.
+	/// Pre aritmeticke typy porovnava naraz cely vektorovy register (AVX2, ak ho procesor podporuje, inak SSE2).
+	/// </summary>
+	class SearchRoutines
+	{
+	public:
+		/// <summary> Vrati index prveho prvku rovneho hodnote. </summary>
+		/// <param name = "items"> Prvy prvok prehladavanej pamate. </param>
+		/// <param name = "count"> Pocet prvkov. </param>
+		/// <param name = "value"> Hladana hodnota. </param>
+		/// <returns> Index prveho vyskytu, ak sa hodnota nenachadza, vrati -1. </returns>
+		template<typename T>
+		static int indexOf(const T* items, int count, const T& value);
+
+		/// <summary> Vrati pocet prvkov rovnych hodnote. </summary>
+		/// <param name = "items"> Prvy prvok prehladavanej pamate. </param>
+		/// <param name = "count"> Pocet prvkov. </param>
+		/// <param name = "value"> Hladana hodnota. </param>
+		/// <returns> Pocet vyskytov hodnoty. </returns>
+		template<typename T>
+		static int count(const T* items, int count, const T& value);
+
+		/// <summary> Zisti, ci procesor a operacny system podporuju AVX2. </summary>
+		/// <returns> true, ak je AVX2 k dispozicii, false inak. </returns>
+		/// <remarks> Zistuje sa raz, pri prvom volani. </remarks>
+		static bool isAVX2Supported();
+
+		/// <summary> Zisti, ci je jadro v tomto preklade a na tomto procesore k dispozicii. </summary>
+		/// <param name = "kernel"> Jadro. </param>
+		/// <returns> true, ak sa jadro da pouzit, false inak. </returns>
+		static bool isKernelSupported(SearchKernel kernel);
+
+		/// <summary> Prehlada pamat zvolenym jadrom, bez ohladu na to, ktore by sa vybralo automaticky. </summary>
+		/// <param name = "kernel"> Jadro. </param>
+		/// <param name = "items"> Prvy prvok prehladavanej pamate. </param>
+		/// <param name = "count"> Pocet prvkov. </param>
+		/// <param name = "value"> Hladana hodnota. </param>
+		/// <param name = "countAll"> true, ak sa maju spocitat vsetky vyskyty, false, ak sa hlada prvy. </param>
+		/// <returns> Pocet vyskytov, alebo index prveho vyskytu (-1, ak neexistuje). </returns>
+		/// <exception cref="std::invalid_argument"> Vyhodena, ak jadro nie je k dispozicii. </exception>
+		/// <remarks> Sluzi testom a meraniam. Lane je std::int8_t, std::int16_t, std::int32_t, std::int64_t, float alebo double. </remarks>
+		template<typename Lane>
+		static int scanWith(SearchKernel kernel, const Lane* items, int count, Lane value, bool countAll);
+	private:
+		/// <summary> Skalarna verzia indexOf pre typy, ktore sa nedaju porovnat vektorovo. </summary>
+		template<typename T>
+		static int indexOf(const T* items, int count, const T& value, std::false_type);
+
+		/// <summary> Vektorova verzia indexOf, prvky porovna ako typ SearchLane. </summary>
+		template<typename T>
+		static int indexOf(const T* items, int count, const T& value, std::true_type);
+
+		/// <summary> Skalarna verzia count pre typy, ktore sa nedaju porovnat vektorovo. </summary>
+		template<typename T>
+		static int count(const T* items, int count, const T& value, std::false_type);
+
+		/// <summary> Vektorova verzia count, prvky porovna ako typ SearchLane. </summary>
+		template<typename T>
+		static int count(const T* items, int count, const T& value, std::true_type);
+
+		/// <summary> Vektorove jadro prehladavania. </summary>
+		/// <param name = "items"> Prvy prvok prehladavanej pamate. </param>
+		/// <param name = "count"> Pocet prvkov. </param>
+		/// <param name = "value"> Hladana hodnota. </param>
+		/// <param name = "countAll"> true, ak sa maju spocitat vsetky vyskyty, false, ak sa hlada prvy. </param>
+		/// <returns> Pocet vyskytov, alebo index prveho vyskytu (-1, ak neexistuje). </returns>
+		static int scan(const std::int8_t* items, int count, std::int8_t value, bool countAll);
+		static int scan(const std::int16_t* items, int count, std::int16_t value, bool countAll);
+		static int scan(const std::int32_t* items, int count, std::int32_t value, bool countAll);
+		static int scan(const std::int64_t* items, int count, std::int64_t value, bool countAll);
+		static int scan(const float* items, int count, float value, bool countAll);
+		static int scan(const double* items, int count, double value, bool countAll);
+	};
+
+	template<typename T>
+	inline int SearchRoutines::indexOf(const T* items, int count, const T& value)
+	{
+		return indexOf(items, count, value, std::integral_constant<bool, DS_SEARCH_SIMD && !std::is_void<typename SearchLane<T>::type>::value>());
+	}
+
+	template<typename T>
+	inline int SearchRoutines::count(const T* items, int count, const T& value)
+	{
+		return SearchRoutines::count(items, count, value, std::integral_constant<bool, DS_SEARCH_SIMD && !std::is_void<typename SearchLane<T>::type>::value>());
+	}
+
+	template<typename T>
+	inline int SearchRoutines::indexOf(const T* items, int count, const T& value, std::false_type)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			if (items[i] == value)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	template<typename T>
+	inline int SearchRoutines::indexOf(const T* items, int count, const T& value, std::true_type)
+	{
+		typedef typename SearchLane<T>::type Lane;
+		return scan(reinterpret_cast<const Lane*>(items), count, *reinterpret_cast<const Lane*>(&value), false);
+	}
+
+	template<typename T>
+	inline int SearchRoutines::count(const T* items, int count, const T& value, std::false_type)
+	{
+		int result = 0;
+		for (int i = 0; i < count; i++)
+		{
+			if (items[i] == value)
+			{
+				result++;
+			}
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline int SearchRoutines::count(const T* items, int count, const T& value, std::true_type)
+	{
+		typedef typename SearchLane<T>::type Lane;
+		return scan(reinterpret_cast<const Lane*>(items), count, *reinterpret_cast<const Lane*>(&value), true);
+	}
+}
@@ -51,6 +51,13 @@ namespace structures
 		return size;
 	}
 
+	MemoryUsage Set::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(Set));
+		result.addAllocations(capacity_ / 8);
+		return result;
+	}
+
 	Set& Set::operator=(const Set& other)
 	{
 		if (this != &other)
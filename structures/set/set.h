@@ -9,7 +9,7 @@ typedef unsigned char byte;
 namespace structures
 {
 
-	class Set : public Structure
+	class Set final : public Structure
 	{
 	public:
 
@@ -19,6 +19,7 @@ namespace structures
 		Structure& operator=(const Structure& other) override;
 		Structure* clone() const override;
 		size_t size() const override;
+		MemoryUsage memoryUsage() const override;
 
 		Set& operator=(const Set& other);
 		bool includes(int data);
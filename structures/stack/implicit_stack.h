@@ -8,7 +8,7 @@ namespace structures
 	/// <summary> Implicitny zasobnk. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v zasobniku. </typepram>
 	template<typename T>
-	class ImplicitStack : public Stack<T>
+	class ImplicitStack final : public Stack<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -29,6 +29,10 @@ namespace structures
 		/// <returns> Pocet prvkov v zasobniku. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru zasobnik obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zasobnik obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Zasobnik, z ktoreho ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento zasobnik nachadza po priradeni. </returns>
@@ -46,6 +50,10 @@ namespace structures
 		/// <param name = "data"> Pridavany prvok. </param>
 		void push(const T& data) override;
 
+		/// <summary> Prida prvok do zasobnika. Prvok do zasobnika presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void push(T&& data) override;
+
 		/// <summary> Odstrani prvok na vrchole zasobnika. </summary>
 		/// <returns> Prvok na vrchole zasobnika. </returns>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak je zasobnik prazdny. </exception>  
@@ -68,7 +76,7 @@ namespace structures
 
 	template<typename T>
 	ImplicitStack<T>::ImplicitStack() :
-		Stack(),
+		Stack<T>(),
 		list_(new ArrayList<T>())
 	{
 	}
@@ -119,6 +127,14 @@ namespace structures
 		return list_->size();
 	}
 
+	template<typename T>
+	inline MemoryUsage ImplicitStack<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(ImplicitStack<T>));
+		result.addAllocation(list_->memoryUsage());
+		return result;
+	}
+
 	template<typename T>
 	inline void ImplicitStack<T>::clear()
 	{
@@ -131,6 +147,12 @@ namespace structures
 		list_->add(data);
 	}
 
+	template<typename T>
+	inline void ImplicitStack<T>::push(T&& data)
+	{
+		list_->add(std::move(data));
+	}
+
 	template<typename T>
 	inline T ImplicitStack<T>::pop()
 	{
@@ -0,0 +1,309 @@
+#pragma once
+
+#include "stack.h"
+
+#include <stdexcept>
+
+namespace structures
+{
+	/// <summary> Zasobnik implementovany zretazenymi blokmi pevnej velkosti. </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v zasobniku. </typepram>
+	/// <typeparam name = "K"> Pocet prvkov v jednom bloku. </typepram>
+	/// <remarks>
+	/// Ked sa vrchny blok zaplni, pripoji sa novy blok, prvky sa pri raste nikdy nekopiruju a ich adresy
+	/// sa nemenia, kym prvok nie je odobrany. Jeden uvolneny blok si zasobnik necha v zalohe,
+	/// aby striedave pridavanie a odoberanie na hranici bloku nealokovalo pamat.
+	/// </remarks>
+	template<typename T, int K = 64>
+	class SegmentedStack final : public Stack<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		SegmentedStack();
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Zasobnik, z ktoreho sa prevezmu vlastnosti. </param>
+		SegmentedStack(const SegmentedStack<T, K>& other);
+
+		/// <summary> Destruktor. </summary>
+		~SegmentedStack();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat zasobnika. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov v zasobniku. </summary>
+		/// <returns> Pocet prvkov v zasobniku. </returns>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru zasobnik obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zasobnik obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zasobnik, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zasobnik nachadza po priradeni. </returns>
+		Stack<T>& operator=(const Stack<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zasobnik, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zasobnik nachadza po priradeni. </returns>
+		SegmentedStack<T, K>& operator=(const SegmentedStack<T, K>& other);
+
+		/// <summary> Vymaze zasobnik. </summary>
+		void clear() override;
+
+		/// <summary> Prida prvok do zasobnika. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void push(const T& data) override;
+
+		/// <summary> Prida prvok do zasobnika. Prvok do zasobnika presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void push(T&& data) override;
+
+		/// <summary> Odstrani prvok na vrchole zasobnika. </summary>
+		/// <returns> Prvok na vrchole zasobnika. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je zasobnik prazdny. </exception>
+		T pop() override;
+
+		/// <summary> Vrati prvok na vrchole zasobnika. </summary>
+		/// <returns> Prvok na vrchole zasobnika. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je zasobnik prazdny. </exception>
+		T& peek() override;
+
+		/// <summary> Vrati prvok na vrchole zasobnika. </summary>
+		/// <returns> Prvok na vrchole zasobnika. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je zasobnik prazdny. </exception>
+		const T peek() const override;
+
+	private:
+		/// <summary> Blok zasobnika. </summary>
+		struct Block
+		{
+			/// <summary> Prvky bloku. </summary>
+			T items[K];
+			/// <summary> Blok pod tymto blokom, alebo nullptr. </summary>
+			Block* previous;
+		};
+
+		/// <summary> Vrchny blok, alebo nullptr, ak je zasobnik prazdny. </summary>
+		Block* top_;
+		/// <summary> Uvolneny blok odlozeny na dalsie pouzitie, alebo nullptr. </summary>
+		Block* spare_;
+		/// <summary> Pocet prvkov vo vrchnom bloku. </summary>
+		int topCount_;
+		/// <summary> Pocet prvkov v zasobniku. </summary>
+		size_t size_;
+		/// <summary> Pocet blokov v zasobniku (bez zalozneho bloku). </summary>
+		size_t blockCount_;
+
+	private:
+		/// <summary> Vrati blok na pouzitie, zalozny, ak existuje, inak novo alokovany. </summary>
+		/// <returns> Blok na pouzitie. </returns>
+		Block* acquireBlock();
+
+		/// <summary> Vrati nepotrebny blok. Ak zaloha este nie je obsadena, blok si ponecha. </summary>
+		/// <param name = "block"> Nepotrebny blok. </param>
+		void releaseBlock(Block* block);
+
+		/// <summary> Zabezpeci, aby vo vrchnom bloku bolo miesto na dalsi prvok. </summary>
+		void ensureRoom();
+	};
+
+	template<typename T, int K>
+	inline SegmentedStack<T, K>::SegmentedStack() :
+		Stack<T>(),
+		top_(nullptr),
+		spare_(nullptr),
+		topCount_(0),
+		size_(0),
+		blockCount_(0)
+	{
+	}
+
+	template<typename T, int K>
+	inline SegmentedStack<T, K>::SegmentedStack(const SegmentedStack<T, K>& other) :
+		SegmentedStack()
+	{
+		*this = other;
+	}
+
+	template<typename T, int K>
+	inline SegmentedStack<T, K>::~SegmentedStack()
+	{
+		clear();
+		delete spare_;
+		spare_ = nullptr;
+	}
+
+	template<typename T, int K>
+	inline Structure* SegmentedStack<T, K>::clone() const
+	{
+		return new SegmentedStack<T, K>(*this);
+	}
+
+	template<typename T, int K>
+	inline size_t SegmentedStack<T, K>::size() const
+	{
+		return size_;
+	}
+
+	template<typename T, int K>
+	inline MemoryUsage SegmentedStack<T, K>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(SegmentedStack<T, K>));
+		result.addAllocations(sizeof(Block), blockCount_, blockCount_ * K * sizeof(T) - size_ * sizeof(T));
+		if (spare_ != nullptr)
+		{
+			result.addAllocations(sizeof(Block), 1, K * sizeof(T));
+		}
+		return result;
+	}
+
+	template<typename T, int K>
+	inline Stack<T>& SegmentedStack<T, K>::operator=(const Stack<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const SegmentedStack<T, K>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline SegmentedStack<T, K>& SegmentedStack<T, K>::operator=(const SegmentedStack<T, K>& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			// Bloky sa kopiruju od vrchu, kazdy novy blok sa pripoji pod predchadzajuci.
+			Block** link = &top_;
+			int count = other.topCount_;
+			for (const Block* block = other.top_; block != nullptr; block = block->previous)
+			{
+				Block* copy = acquireBlock();
+				for (int i = 0; i < count; i++)
+				{
+					copy->items[i] = block->items[i];
+				}
+				*link = copy;
+				link = &copy->previous;
+				count = K;
+			}
+			*link = nullptr;
+			topCount_ = other.topCount_;
+			size_ = other.size_;
+		}
+		return *this;
+	}
+
+	template<typename T, int K>
+	inline void SegmentedStack<T, K>::clear()
+	{
+		while (top_ != nullptr)
+		{
+			Block* block = top_;
+			top_ = block->previous;
+			releaseBlock(block);
+		}
+		topCount_ = 0;
+		size_ = 0;
+	}
+
+	template<typename T, int K>
+	inline void SegmentedStack<T, K>::push(const T& data)
+	{
+		ensureRoom();
+		top_->items[topCount_++] = data;
+		size_++;
+	}
+
+	template<typename T, int K>
+	inline void SegmentedStack<T, K>::push(T&& data)
+	{
+		ensureRoom();
+		top_->items[topCount_++] = std::move(data);
+		size_++;
+	}
+
+	template<typename T, int K>
+	inline T SegmentedStack<T, K>::pop()
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("SegmentedStack<T, K>::pop: Stack is empty.");
+		}
+		T result = std::move(top_->items[--topCount_]);
+		size_--;
+		if (topCount_ == 0)
+		{
+			Block* block = top_;
+			top_ = block->previous;
+			releaseBlock(block);
+			topCount_ = top_ != nullptr ? K : 0;
+		}
+		return result;
+	}
+
+	template<typename T, int K>
+	inline T& SegmentedStack<T, K>::peek()
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("SegmentedStack<T, K>::peek: Stack is empty.");
+		}
+		return top_->items[topCount_ - 1];
+	}
+
+	template<typename T, int K>
+	inline const T SegmentedStack<T, K>::peek() const
+	{
+		if (size_ == 0)
+		{
+			throw std::out_of_range("SegmentedStack<T, K>::peek: Stack is empty.");
+		}
+		return top_->items[topCount_ - 1];
+	}
+
+	template<typename T, int K>
+	inline typename SegmentedStack<T, K>::Block* SegmentedStack<T, K>::acquireBlock()
+	{
+		Block* result = spare_;
+		if (result != nullptr)
+		{
+			spare_ = nullptr;
+		}
+		else
+		{
+			result = new Block();
+		}
+		blockCount_++;
+		return result;
+	}
+
+	template<typename T, int K>
+	inline void SegmentedStack<T, K>::releaseBlock(Block* block)
+	{
+		if (spare_ == nullptr)
+		{
+			spare_ = block;
+		}
+		else
+		{
+			delete block;
+		}
+		blockCount_--;
+	}
+
+	template<typename T, int K>
+	inline void SegmentedStack<T, K>::ensureRoom()
+	{
+		if (top_ == nullptr || topCount_ == K)
+		{
+			Block* block = acquireBlock();
+			block->previous = top_;
+			top_ = block;
+			topCount_ = 0;
+		}
+	}
+}
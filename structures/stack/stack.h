@@ -43,6 +43,16 @@ namespace structures
 		/// <param name = "data"> Pridavany prvok. </param>
 		virtual void push(const T& data) = 0;
 
+		/// <summary> Prida prvok do zasobnika. Prvok do zasobnika presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		virtual void push(T&& data) = 0;
+
+		/// <summary> Vytvori prvok z argumentov a prida ho do zasobnika. </summary>
+		/// <param name = "args"> Argumenty konstruktora pridavaneho prvku. </param>
+		/// <remarks> Prvok sa vytvori raz a do zasobnika sa presunie, nekopiruje sa. </remarks>
+		template<typename... Args>
+		void emplace(Args&&... args);
+
 		/// <summary> Odstrani prvok na vrchole zasobnika. </summary>
 		/// <returns> Prvok na vrchole zasobnika. </returns>
 		/// <exception cref="std::out_of_range"> Vyhodena, ak je zasobnik prazdny. </exception>  
@@ -69,6 +79,13 @@ namespace structures
 		return *this;
 	}
 
+	template<typename T>
+	template<typename... Args>
+	inline void Stack<T>::emplace(Args&&... args)
+	{
+		this->push(T(std::forward<Args>(args)...));
+	}
+
 	template<typename T>
 	inline Stack<T>::Stack() :
 		Structure()
@@ -0,0 +1,394 @@
+#pragma once
+
+#include "stack.h"
+#include "../epoch_reclamation.h"
+
+#include <stdexcept>
+
+namespace structures
+{
+	/// <summary> Zasobnik bez zamkov pre viacere vlakna (Treiber). </summary>
+	/// <typeparam name = "T"> Typ dat ukladanych v zasobniku. </typepram>
+	/// <remarks>
+	/// Vrchol zasobnika je atomicky ukazovatel na zretazene uzly, push aj pop ho menia jednou operaciou compare-and-swap.
+	/// Odobrane uzly sa uvolnuju az cez EpochReclamation, kym ich moze citat ine vlakno, preto sa ich adresy nepouziju znova
+	/// a compare-and-swap netrpi problemom ABA. Volitelne pole eliminacie pri neuspesnom compare-and-swap sparuje
+	/// sucasne push a pop priamo, bez pristupu k vrcholu, co pri vysokom sucasnom pristupe znizuje spory o vrchol.
+	/// Kopirovanie, priradenie a peek nie su bezpecne pri sucasnom pouzivani zasobnika.
+	/// </remarks>
+	template<typename T>
+	class TreiberStack final : public Stack<T>
+	{
+	public:
+		/// <summary> Konstruktor. </summary>
+		TreiberStack();
+
+		/// <summary> Parametricky konstruktor. </summary>
+		/// <param name = "eliminationSize"> Pocet miest v poli eliminacie, 0 eliminaciu vypne. </param>
+		TreiberStack(const size_t eliminationSize);
+
+		/// <summary> Kopirovaci konstruktor. </summary>
+		/// <param name = "other"> Zasobnik, z ktoreho sa prevezmu vlastnosti. </param>
+		TreiberStack(const TreiberStack<T>& other);
+
+		/// <summary> Destruktor. </summary>
+		~TreiberStack();
+
+		/// <summary> Operacia klonovania. Vytvori a vrati duplikat zasobnika. </summary>
+		/// <returns> Ukazovatel na klon struktury. </returns>
+		Structure* clone() const override;
+
+		/// <summary> Vrati pocet prvkov v zasobniku. </summary>
+		/// <returns> Pocet prvkov v zasobniku. </returns>
+		/// <remarks> Pri sucasnom pouzivani zasobnika je vysledok iba odhad. </remarks>
+		size_t size() const override;
+
+		/// <summary> Vrati udaje o pamati, ktoru zasobnik obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru zasobnik obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zasobnik, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zasobnik nachadza po priradeni. </returns>
+		Stack<T>& operator=(const Stack<T>& other) override;
+
+		/// <summary> Operator priradenia. </summary>
+		/// <param name = "other"> Zasobnik, z ktoreho ma prebrat vlastnosti. </param>
+		/// <returns> Adresa, na ktorej sa tento zasobnik nachadza po priradeni. </returns>
+		TreiberStack<T>& operator=(const TreiberStack<T>& other);
+
+		/// <summary> Vymaze zasobnik. Odobera prvky po jednom, preto je bezpecne aj pri sucasnom pouzivani. </summary>
+		void clear() override;
+
+		/// <summary> Prida prvok do zasobnika. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void push(const T& data) override;
+
+		/// <summary> Prida prvok do zasobnika. Prvok do zasobnika presunie. </summary>
+		/// <param name = "data"> Pridavany prvok. </param>
+		void push(T&& data) override;
+
+		/// <summary> Odstrani prvok na vrchole zasobnika. </summary>
+		/// <returns> Prvok na vrchole zasobnika. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je zasobnik prazdny. </exception>
+		T pop() override;
+
+		/// <summary> Vrati prvok na vrchole zasobnika. </summary>
+		/// <returns> Prvok na vrchole zasobnika. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je zasobnik prazdny. </exception>
+		/// <remarks> Platny iba vtedy, ked zasobnik nepouzivaju ine vlakna. </remarks>
+		T& peek() override;
+
+		/// <summary> Vrati prvok na vrchole zasobnika. </summary>
+		/// <returns> Prvok na vrchole zasobnika. </returns>
+		/// <exception cref="std::out_of_range"> Vyhodena, ak je zasobnik prazdny. </exception>
+		/// <remarks> Platny iba vtedy, ked zasobnik nepouzivaju ine vlakna. </remarks>
+		const T peek() const override;
+
+		/// <summary> Pokusi sa odobrat prvok z vrcholu zasobnika. </summary>
+		/// <param name = "data"> Premenna, do ktorej sa prvok presunie. </param>
+		/// <returns> true, ak bol prvok odobrany, false, ak je zasobnik prazdny. </returns>
+		bool tryPop(T& data);
+
+	private:
+		/// <summary> Uzol zasobnika. </summary>
+		struct Node
+		{
+			/// <summary> Data uzla. </summary>
+			T data;
+			/// <summary> Uzol pod tymto uzlom, po zverejneni uzla sa nemeni. </summary>
+			Node* next;
+			/// <summary> Nasledujuci vyradeny uzol, pouziva EpochReclamation. </summary>
+			Node* retiredNext;
+		};
+
+		/// <summary> Sprava epoch na uvolnovanie odobratych uzlov. </summary>
+		EpochReclamation<Node>* reclamation_;
+		/// <summary> Pole eliminacie, nullptr, ak je eliminacia vypnuta. </summary>
+		std::atomic<Node*>* exchangers_;
+		/// <summary> Pocet miest v poli eliminacie. </summary>
+		size_t exchangerCount_;
+
+		/// <summary> Oddeluje vrchol od nemennych udajov. </summary>
+		char paddingTop_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+		/// <summary> Vrchol zasobnika. </summary>
+		std::atomic<Node*> top_;
+
+		/// <summary> Oddeluje pocet prvkov od vrcholu. </summary>
+		char paddingSize_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+		/// <summary> Pocet prvkov v zasobniku. </summary>
+		std::atomic<size_t> size_;
+
+		/// <summary> Oddeluje pocet prvkov od nasledujucich objektov v pamati. </summary>
+		char paddingEnd_[ConcurrencyRoutines::CACHE_LINE_SIZE];
+
+	private:
+		/// <summary> Pocet cakani v poli eliminacie na partnera pre push. </summary>
+		static const unsigned ELIMINATION_SPINS = 64;
+
+		/// <summary> Zverejni uzol na vrchole zasobnika, alebo ho cez pole eliminacie odovzda sucasnemu pop. </summary>
+		/// <param name = "node"> Pridavany uzol. </param>
+		void pushNode(Node* node);
+
+		/// <summary> Pokusi sa odovzdat uzol sucasnemu pop cez pole eliminacie. </summary>
+		/// <param name = "node"> Pridavany uzol. </param>
+		/// <returns> true, ak si uzol prevzal pop. </returns>
+		bool tryEliminatePush(Node* node);
+
+		/// <summary> Pokusi sa prevziat uzol od sucasneho push cez pole eliminacie. </summary>
+		/// <param name = "data"> Premenna, do ktorej sa prvok presunie. </param>
+		/// <param name = "guard"> Obsadeny slot spravy epoch, prevzaty uzol sa v nom vyradi. </param>
+		/// <returns> true, ak bol uzol prevzaty. </returns>
+		bool tryEliminatePop(T& data, typename EpochReclamation<Node>::Guard& guard);
+	};
+
+	template<typename T>
+	inline TreiberStack<T>::TreiberStack() :
+		TreiberStack(0)
+	{
+	}
+
+	template<typename T>
+	inline TreiberStack<T>::TreiberStack(const size_t eliminationSize) :
+		Stack<T>(),
+		reclamation_(new EpochReclamation<Node>()),
+		exchangers_(nullptr),
+		exchangerCount_(eliminationSize),
+		top_(nullptr),
+		size_(0)
+	{
+		if (exchangerCount_ > 0)
+		{
+			exchangers_ = new std::atomic<Node*>[exchangerCount_];
+			for (size_t i = 0; i < exchangerCount_; i++)
+			{
+				exchangers_[i].store(nullptr, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	template<typename T>
+	inline TreiberStack<T>::TreiberStack(const TreiberStack<T>& other) :
+		TreiberStack(other.exchangerCount_)
+	{
+		*this = other;
+	}
+
+	template<typename T>
+	inline TreiberStack<T>::~TreiberStack()
+	{
+		Node* node = top_.load(std::memory_order_relaxed);
+		while (node != nullptr)
+		{
+			Node* next = node->next;
+			delete node;
+			node = next;
+		}
+		top_.store(nullptr, std::memory_order_relaxed);
+		delete[] exchangers_;
+		exchangers_ = nullptr;
+		delete reclamation_;
+		reclamation_ = nullptr;
+	}
+
+	template<typename T>
+	inline Structure* TreiberStack<T>::clone() const
+	{
+		return new TreiberStack<T>(*this);
+	}
+
+	template<typename T>
+	inline size_t TreiberStack<T>::size() const
+	{
+		return size_.load(std::memory_order_relaxed);
+	}
+
+	template<typename T>
+	inline MemoryUsage TreiberStack<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(TreiberStack<T>), 3 * ConcurrencyRoutines::CACHE_LINE_SIZE);
+		result.addAllocations(sizeof(EpochReclamation<Node>));
+		result.addAllocations(sizeof(Node), size());
+		if (exchangers_ != nullptr)
+		{
+			result.addAllocations(exchangerCount_ * sizeof(std::atomic<Node*>));
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline Stack<T>& TreiberStack<T>::operator=(const Stack<T>& other)
+	{
+		if (this != &other)
+		{
+			*this = dynamic_cast<const TreiberStack<T>&>(other);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline TreiberStack<T>& TreiberStack<T>::operator=(const TreiberStack<T>& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			// Uzly sa kopiruju od vrcholu, kazdy novy uzol sa pripoji pod predchadzajuci.
+			Node* first = nullptr;
+			Node** link = &first;
+			for (const Node* node = other.top_.load(std::memory_order_acquire); node != nullptr; node = node->next)
+			{
+				*link = new Node{ node->data, nullptr, nullptr };
+				link = &(*link)->next;
+			}
+			size_.store(other.size(), std::memory_order_relaxed);
+			top_.store(first, std::memory_order_release);
+		}
+		return *this;
+	}
+
+	template<typename T>
+	inline void TreiberStack<T>::clear()
+	{
+		T data;
+		while (tryPop(data))
+		{
+		}
+	}
+
+	template<typename T>
+	inline void TreiberStack<T>::push(const T& data)
+	{
+		pushNode(new Node{ data, nullptr, nullptr });
+	}
+
+	template<typename T>
+	inline void TreiberStack<T>::push(T&& data)
+	{
+		pushNode(new Node{ std::move(data), nullptr, nullptr });
+	}
+
+	template<typename T>
+	inline T TreiberStack<T>::pop()
+	{
+		T result;
+		if (!tryPop(result))
+		{
+			throw std::out_of_range("TreiberStack<T>::pop: Stack is empty.");
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline T& TreiberStack<T>::peek()
+	{
+		Node* top = top_.load(std::memory_order_acquire);
+		if (top == nullptr)
+		{
+			throw std::out_of_range("TreiberStack<T>::peek: Stack is empty.");
+		}
+		return top->data;
+	}
+
+	template<typename T>
+	inline const T TreiberStack<T>::peek() const
+	{
+		const Node* top = top_.load(std::memory_order_acquire);
+		if (top == nullptr)
+		{
+			throw std::out_of_range("TreiberStack<T>::peek: Stack is empty.");
+		}
+		return top->data;
+	}
+
+	template<typename T>
+	inline bool TreiberStack<T>::tryPop(T& data)
+	{
+		typename EpochReclamation<Node>::Guard guard(*reclamation_);
+		Backoff backoff;
+		Node* top = top_.load(std::memory_order_acquire);
+		while (top != nullptr)
+		{
+			// Uzol mohol byt medzicasom odobrany, jeho pamat ale drzi obsadeny slot spravy epoch.
+			if (top_.compare_exchange_weak(top, top->next, std::memory_order_acquire, std::memory_order_acquire))
+			{
+				size_.fetch_sub(1, std::memory_order_relaxed);
+				data = std::move(top->data);
+				guard.retire(top);
+				return true;
+			}
+			if (exchangers_ != nullptr && tryEliminatePop(data, guard))
+			{
+				return true;
+			}
+			backoff.pause();
+			top = top_.load(std::memory_order_acquire);
+		}
+		return false;
+	}
+
+	template<typename T>
+	inline void TreiberStack<T>::pushNode(Node* node)
+	{
+		// Pocet sa zvysi pred zverejnenim uzla, aby ho sucasny pop nemohol znizit pod nulu.
+		size_.fetch_add(1, std::memory_order_relaxed);
+		Node* top = top_.load(std::memory_order_relaxed);
+		node->next = top;
+		if (top_.compare_exchange_strong(top, node, std::memory_order_release, std::memory_order_relaxed))
+		{
+			return;
+		}
+		// Pri eliminacii sa porovnava adresa uzla, slot spravy epoch zabrani jej opakovanemu pouzitiu.
+		typename EpochReclamation<Node>::Guard guard(*reclamation_);
+		Backoff backoff;
+		while (true)
+		{
+			if (exchangers_ != nullptr && tryEliminatePush(node))
+			{
+				size_.fetch_sub(1, std::memory_order_relaxed);
+				return;
+			}
+			backoff.pause();
+			node->next = top;
+			if (top_.compare_exchange_weak(top, node, std::memory_order_release, std::memory_order_relaxed))
+			{
+				return;
+			}
+		}
+	}
+
+	template<typename T>
+	inline bool TreiberStack<T>::tryEliminatePush(Node* node)
+	{
+		std::atomic<Node*>& exchanger = exchangers_[EpochReclamation<Node>::threadRandom() % exchangerCount_];
+		Node* expected = nullptr;
+		if (!exchanger.compare_exchange_strong(expected, node, std::memory_order_release, std::memory_order_relaxed))
+		{
+			return false;
+		}
+		for (unsigned i = 0; i < ELIMINATION_SPINS; i++)
+		{
+			if (exchanger.load(std::memory_order_relaxed) != node)
+			{
+				return true;
+			}
+			DS_CPU_RELAX();
+		}
+		// Ak uzol medzicasom neprevzal pop, push ho z pola stiahne.
+		expected = node;
+		return !exchanger.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed);
+	}
+
+	template<typename T>
+	inline bool TreiberStack<T>::tryEliminatePop(T& data, typename EpochReclamation<Node>::Guard& guard)
+	{
+		std::atomic<Node*>& exchanger = exchangers_[EpochReclamation<Node>::threadRandom() % exchangerCount_];
+		Node* node = exchanger.load(std::memory_order_acquire);
+		if (node == nullptr || !exchanger.compare_exchange_strong(node, nullptr, std::memory_order_acquire, std::memory_order_relaxed))
+		{
+			return false;
+		}
+		data = std::move(node->data);
+		guard.retire(node);
+		return true;
+	}
+}
@@ -1,8 +1,42 @@
 #include "structure.h"
-#include <tchar.h>
 
 namespace structures {
 
+	MemoryUsage::MemoryUsage(size_t owned, size_t wasted, size_t allocationCount) :
+		bytesOwned(owned),
+		bytesWasted(wasted),
+		allocations(allocationCount)
+	{
+	}
+
+	MemoryUsage& MemoryUsage::operator+=(const MemoryUsage& other)
+	{
+		bytesOwned += other.bytesOwned;
+		bytesWasted += other.bytesWasted;
+		allocations += other.allocations;
+		return *this;
+	}
+
+	MemoryUsage& MemoryUsage::addAllocations(size_t bytes, size_t count, size_t wasted)
+	{
+		bytesOwned += bytes * count;
+		bytesWasted += wasted * count;
+		allocations += count;
+		return *this;
+	}
+
+	MemoryUsage& MemoryUsage::addAllocation(const MemoryUsage& other)
+	{
+		*this += other;
+		allocations++;
+		return *this;
+	}
+
+	double MemoryUsage::bytesPerElement(size_t count) const
+	{
+		return count == 0 ? static_cast<double>(bytesOwned) : static_cast<double>(bytesOwned) / count;
+	}
+
 	Structure::Structure()
 	{
 	}
@@ -1,12 +1,22 @@
 #pragma once
 
 #include "heap_monitor.h"
+#include <cstddef>
+#include <utility>
 
 namespace structures {
 
+	/// <summary> Znacka konstruktora, ktory vytvori data priamo v prvku z argumentov ich konstruktora. </summary>
+	struct InPlace
+	{
+	};
+
 	/// <summary> Prvok uchovavajuci data. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v prvku. </typepram>
-	/// <remarks> Pouziva sa ako predok pre vnotorne prvky struktur (napr. zretazeny zoznam, tabulka..). </remarks>
+	/// <remarks> 
+	/// Pouziva sa ako predok pre vnotorne prvky struktur (napr. zretazeny zoznam, tabulka..). 
+	/// Nie je polymorfny, aby prvky struktur nenesli smernik na tabulku virtualnych metod.
+	/// </remarks>
 	template <typename T>
 	class DataItem
 	{
@@ -14,22 +24,76 @@ namespace structures {
 		/// <summary> Spristupni data. </summary>
 		/// <returns> Data. </returns>
 		T& accessData();
+
+		/// <summary> Spristupni data na citanie. </summary>
+		/// <returns> Konstantna referencia na data. </returns>
+		const T& accessData() const;
 	protected:
 		/// <summary> Konstruktor. </summary>
 		/// <param name = "data"> Data, ktore uchovava. </param>
 		DataItem(const T& data);
 
+		/// <summary> Konstruktor. Data do prvku presunie. </summary>
+		/// <param name = "data"> Data, ktore uchovava. </param>
+		DataItem(T&& data);
+
+		/// <summary> Konstruktor. Data vytvori priamo v prvku. </summary>
+		/// <param name = "args"> Argumenty konstruktora dat. </param>
+		template<typename... Args>
+		DataItem(InPlace, Args&&... args);
+
 		/// <summary> Kopirovaci konstruktor. </summary>
 		/// <param name = "other"> Prvok uchovavajuci data, z ktoreho sa prevezmu vlastnosti. </param>
 		DataItem(const DataItem<T>& other);
 
 		/// <summary> Destruktor. </summary>
-		virtual ~DataItem();
+		/// <remarks> Nie je virtualny, prvok sa musi rusit cez smernik na svoj skutocny typ. </remarks>
+		~DataItem();
 	private:
 		/// <summary> Data. </summary>
 		T data_;
 	};
 
+	/// <summary> Udaje o pamati obsadenej udajovou strukturou. </summary>
+	/// <remarks> Data ulozene v strukture sa zapocitavaju plytko, teda iba velkostou ich typu. </remarks>
+	struct MemoryUsage
+	{
+		/// <summary> Pocet bytov, ktore struktura vlastni (vratane samotneho objektu struktury). </summary>
+		size_t bytesOwned;
+		/// <summary> Pocet vlastnenych bytov, ktore su alokovane, ale nevyuzite (rezerva kapacity, prazdne miesta). </summary>
+		size_t bytesWasted;
+		/// <summary> Pocet alokacii na halde, ktore struktura vlastni. </summary>
+		size_t allocations;
+
+		/// <summary> Konstruktor. </summary>
+		/// <param name = "owned"> Pocet vlastnenych bytov. </param>
+		/// <param name = "wasted"> Pocet nevyuzitych bytov. </param>
+		/// <param name = "allocationCount"> Pocet alokacii. </param>
+		MemoryUsage(size_t owned = 0, size_t wasted = 0, size_t allocationCount = 0);
+
+		/// <summary> Zapocita pamat obsadenu inou strukturou, ktora je sucastou tejto. </summary>
+		/// <param name = "other"> Pamat obsadena inou strukturou. </param>
+		/// <returns> Adresa, na ktorej sa tento objekt nachadza. </returns>
+		MemoryUsage& operator+=(const MemoryUsage& other);
+
+		/// <summary> Zapocita count alokacii na halde, kazdu o velkosti bytes bytov. </summary>
+		/// <param name = "bytes"> Velkost jednej alokacie. </param>
+		/// <param name = "count"> Pocet alokacii. </param>
+		/// <param name = "wasted"> Pocet nevyuzitych bytov v kazdej z alokacii. </param>
+		/// <returns> Adresa, na ktorej sa tento objekt nachadza. </returns>
+		MemoryUsage& addAllocations(size_t bytes, size_t count = 1, size_t wasted = 0);
+
+		/// <summary> Zapocita pamat obsadenu inou strukturou, ktora bola sama alokovana na halde. </summary>
+		/// <param name = "other"> Pamat obsadena inou strukturou (vratane jej objektu). </param>
+		/// <returns> Adresa, na ktorej sa tento objekt nachadza. </returns>
+		MemoryUsage& addAllocation(const MemoryUsage& other);
+
+		/// <summary> Vrati priemerny pocet vlastnenych bytov na jeden prvok. </summary>
+		/// <param name = "count"> Pocet prvkov v strukture. </param>
+		/// <returns> Pocet bytov na jeden prvok, ak je count 0, tak vsetky vlastnene byty. </returns>
+		double bytesPerElement(size_t count) const;
+	};
+
 	/// <summary> Abstraktny predok kazdej udajovej struktury. </summary>
 	class Structure 
 	{
@@ -54,6 +118,10 @@ namespace structures {
 		/// <summary> Vrati velkost udajovej struktury. </summary>
 		/// <returns> Velkost udajovej struktury. </returns>
 		virtual size_t size() const = 0;
+
+		/// <summary> Vrati udaje o pamati, ktoru udajova struktura obsadzuje. </summary>
+		/// <returns> Vlastnene byty (vratane objektu struktury), nevyuzite byty a pocet alokacii na halde. </returns>
+		virtual MemoryUsage memoryUsage() const = 0;
 	protected:
 		/// <summary> Implicitny konstruktor. </summary>
 		Structure();
@@ -65,12 +133,31 @@ namespace structures {
 		return data_;
 	}
 
+	template<typename T>
+	inline const T & DataItem<T>::accessData() const
+	{
+		return data_;
+	}
+
 	template<typename T>
 	inline DataItem<T>::DataItem(const T& data) :
 		data_(data)
 	{
 	}
 
+	template<typename T>
+	inline DataItem<T>::DataItem(T&& data) :
+		data_(std::move(data))
+	{
+	}
+
+	template<typename T>
+	template<typename... Args>
+	inline DataItem<T>::DataItem(InPlace, Args&&... args) :
+		data_(std::forward<Args>(args)...)
+	{
+	}
+
 	template<typename T>
 	inline DataItem<T>::DataItem(const DataItem<T>& other) :
 		DataItem(other.data_)
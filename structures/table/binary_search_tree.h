@@ -34,6 +34,10 @@ namespace structures
 		/// <returns> Pocet prvkov v tabulke. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru tabulka obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru tabulka obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Tabulka, z ktorej ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tato tabulka nachadza po priradeni. </returns>
@@ -62,6 +66,12 @@ namespace structures
 		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
 		void insert(const K& key, const T& data) override;
 
+		/// <summary> Vlozi data s danym klucom do tabulky. Data do tabulky presunie. </summary>
+		/// <param name = "key"> Kluc vkladanych dat. </param>
+		/// <param name = "data"> Vkladane data. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
+		void insert(const K& key, T&& data) override;
+
 		/// <summary> Odstrani z tabulky prvok s danym klucom. </summary>
 		/// <param name = "key"> Kluc prvku. </param>
 		/// <returns> Odstranene data. </returns>
@@ -112,6 +122,16 @@ namespace structures
 		/// <param name = "node"> Vrchol stromu, ktory ma byt vyjmuty. </param>
 		/// <remarks> Vrchol nebude zruseny, iba odstraneny zo stromu a ziadne vrcholy nebudu ukazovat na neho a ani on nebude ukazovat na ziadne ine vrcholy. </remarks>
 		void extractNode(BSTTreeNode* node);
+
+		/// <summary> Vytvori pre prvok tabulky vrchol a vlozi ho do stromu. </summary>
+		/// <param name = "item"> Vkladany prvok. Tabulka ho prebera do vlastnictva. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. Prvok je vtedy zruseny. </exception>  
+		void insertItem(TableItem<K, T>* item);
+
+		/// <summary> Zrusi prvok tabulky. </summary>
+		/// <param name = "item"> Ruseny prvok. </param>
+		/// <remarks> Destruktor prvku nie je virtualny, potomkovia s inym typom prvku ho preto rusia cez smernik na svoj typ. </remarks>
+		virtual void deleteItem(TableItem<K, T>* item);
 	private:
 		
 		BSTTreeNode* getInOrderPredecessor(BSTTreeNode* node);
@@ -154,6 +174,15 @@ namespace structures
 		return size_;
 	}
 
+	template<typename K, typename T>
+	inline MemoryUsage BinarySearchTree<K, T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(BinarySearchTree<K, T>));
+		result.addAllocation(binaryTree_->memoryUsage());
+		result.addAllocations(sizeof(TableItem<K, T>), size_);
+		return result;
+	}
+
 	template<typename K, typename T>
 	inline Table<K, T>& BinarySearchTree<K, T>::operator=(const Table<K, T>& other)
 	{
@@ -217,14 +246,13 @@ namespace structures
 	template<typename K, typename T>
 	inline void BinarySearchTree<K, T>::insert(const K & key, const T & data)
 	{
-		BSTTreeNode* newNode = new BinaryTreeNode<TableItem<K, T>*>(new TableItem<K, T>(key, data));
+		insertItem(new TableItem<K, T>(key, data));
+	}
 
-		if (!tryToInsertNode(newNode))
-		{
-			delete newNode->accessData();
-			delete newNode;
-			throw std::logic_error("BinarySearchTree<K, T>::insert: Unable to insert!");
-		}
+	template<typename K, typename T>
+	inline void BinarySearchTree<K, T>::insert(const K & key, T && data)
+	{
+		insertItem(new TableItem<K, T>(key, std::move(data)));
 	}
 
 	template<typename K, typename T>
@@ -234,10 +262,11 @@ namespace structures
 		BSTTreeNode* node = findBSTNode(key, found);
 		if (found)
 		{
-			T result = node->accessData()->accessData();
+			T result = std::move(node->accessData()->accessData());
 			extractNode(node);
 			node->removeLeftSon();
 			node->removeRightSon();
+			deleteItem(node->accessData());
 			delete node;
 			size_--;
 			return result;
@@ -356,6 +385,25 @@ namespace structures
 		return true;
 	}
 
+	template<typename K, typename T>
+	inline void BinarySearchTree<K, T>::insertItem(TableItem<K, T>* item)
+	{
+		BSTTreeNode* newNode = new BinaryTreeNode<TableItem<K, T>*>(item);
+
+		if (!tryToInsertNode(newNode))
+		{
+			deleteItem(newNode->accessData());
+			delete newNode;
+			throw std::logic_error("BinarySearchTree<K, T>::insert: Unable to insert!");
+		}
+	}
+
+	template<typename K, typename T>
+	inline void BinarySearchTree<K, T>::deleteItem(TableItem<K, T>* item)
+	{
+		delete item;
+	}
+
 	template<typename K, typename T>
 	inline void BinarySearchTree<K, T>::extractNode(BSTTreeNode* node)
 	{
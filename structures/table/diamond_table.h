@@ -8,7 +8,7 @@ namespace structures
 {
 
 	template<typename K, typename T>
-	class DiamondTable : public SequenceTable<K, T>
+	class DiamondTable final : public SequenceTable<K, T>
 	{
 	public:
 
@@ -16,7 +16,6 @@ namespace structures
 		DiamondTable(const DiamondTable<K, T>& other);
 		~DiamondTable();
 
-		void insert(const K& key, const T& data) override;
 		T& operator[](const K key) override;
 		const T operator[](const K key) const override;
 		T remove(const K& key) override;
@@ -24,6 +23,9 @@ namespace structures
 		Structure* clone() const override;
 		size_t size() const override;
 
+	protected:
+
+		void insertItem(TableItem<K, T>* item) override;
 
 	private:
 		
@@ -38,7 +40,7 @@ namespace structures
 		int getLevelByIndex(int index) const;
 		bool isMostLeftInLevel(int index) const;
 		bool isMostRightInLevel(int index) const;
-		K getKeyByIndex(int index) const;
+		const K& getKeyByIndex(int index) const;
 		T& accessDataByIndex(int index);
 		const T accessDataByIndex(int index) const;
 		int getIndexByKey(const K key) const;
@@ -70,9 +72,9 @@ namespace structures
 	}
 
 	template<typename K, typename T>
-	inline void DiamondTable<K, T>::insert(const K& key, const T& data)
+	inline void DiamondTable<K, T>::insertItem(TableItem<K, T>* item)
 	{
-		this->list_->add(new TableItem<K, T>(key, data));
+		this->list_->add(item);
 		moveToCorrectPosition(this->list_->size() - 1);
 	}
 
@@ -95,7 +97,7 @@ namespace structures
 		int lastIndex = this->list_->size() - 1;
 		DSRoutines::swap((*this->list_)[index], (*this->list_)[lastIndex]);
 		TableItem<K, T>* item = this->list_->removeAt(lastIndex);
-		T result = item->accessData();
+		T result = std::move(item->accessData());
 		delete item;
 		item = nullptr;
 		if (index < static_cast<int>(this->list_->size()))
@@ -194,7 +196,7 @@ namespace structures
 	}
 
 	template<typename K, typename T>
-	inline K DiamondTable<K, T>::getKeyByIndex(int index) const
+	inline const K& DiamondTable<K, T>::getKeyByIndex(int index) const
 	{
 		return (*this->list_)[index]->getKey();
 	}
@@ -13,7 +13,7 @@ namespace structures
 	/// <typeparam name = "K"> Kluc prvkov v tabulke. </typepram>
 	/// <typeparam name = "T"> Typ dat ukladanych v tabulke. </typepram>
 	template <typename K, typename T>
-	class HashTable : public Table<K, T>
+	class HashTable final : public Table<K, T>
 	{
 	private:
 		static const int DATA_ARRAY_SIZE = 100;
@@ -36,6 +36,10 @@ namespace structures
 		/// <returns> Pocet prvkov v tabulke. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru tabulka obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru tabulka obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Tabulka, z ktorej ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tato tabulka nachadza po priradeni. </returns>
@@ -64,6 +68,12 @@ namespace structures
 		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
 		void insert(const K& key, const T& data) override;
 
+		/// <summary> Vlozi data s danym klucom do tabulky. Data do tabulky presunie. </summary>
+		/// <param name = "key"> Kluc vkladanych dat. </param>
+		/// <param name = "data"> Vkladane data. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
+		void insert(const K& key, T&& data) override;
+
 		/// <summary> Odstrani z tabulky prvok s danym klucom. </summary>
 		/// <param name = "key"> Kluc prvku. </param>
 		/// <returns> Odstranene data. </returns>
@@ -104,6 +114,11 @@ namespace structures
 		/// <returns> Index do pola dat, ktory vznikol zahashovanim kluca. </returns>
 		int hashFunction(const K& key) const;
 
+		/// <summary> Vrati tabulku, do ktorej patria data s danym klucom. Ak este neexistuje, vytvori ju. </summary>
+		/// <param name = "key"> Kluc dat. </param>
+		/// <returns> Tabulka, do ktorej patria data s danym klucom. </returns>
+		Table<K, T>* bucketForInsert(const K& key);
+
 	private:
 		/// <summary> Iterator pre HashTable. </summary>
 		class HashTableIterator : public Iterator<TableItem<K, T>*>
@@ -189,6 +204,26 @@ namespace structures
 		return size_;
 	}
 
+	template<typename K, typename T>
+	inline MemoryUsage HashTable<K, T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(HashTable<K, T>));
+		result.addAllocation(data_->memoryUsage());
+		for (int i = 0; i < static_cast<int>(data_->size()); i++)
+		{
+			Table<K, T>* table = (*data_)[i];
+			if (table != nullptr)
+			{
+				result.addAllocation(table->memoryUsage());
+			}
+			else
+			{
+				result.bytesWasted += sizeof(Table<K, T>*);
+			}
+		}
+		return result;
+	}
+
 	template<typename K, typename T>
 	inline Table<K, T>& HashTable<K, T>::operator=(const Table<K, T>& other)
 	{
@@ -246,14 +281,14 @@ namespace structures
 	template<typename K, typename T>
 	inline void HashTable<K, T>::insert(const K & key, const T & data)
 	{
-		int hash = hashFunction(key);
-		Table<K, T>* table = (*data_)[hash];
-		if (table == nullptr)
-		{
-			table = new LinkedTable<K, T>();
-			(*data_)[key] = table;
-		}
-		table->insert(key, data);
+		bucketForInsert(key)->insert(key, data);
+		size_++;
+	}
+
+	template<typename K, typename T>
+	inline void HashTable<K, T>::insert(const K & key, T && data)
+	{
+		bucketForInsert(key)->insert(key, std::move(data));
 		size_++;
 	}
 
@@ -329,6 +364,19 @@ namespace structures
 		return (key * (key + 3)) % DATA_ARRAY_SIZE;
 	}
 
+	template<typename K, typename T>
+	inline Table<K, T>* HashTable<K, T>::bucketForInsert(const K & key)
+	{
+		int hash = hashFunction(key);
+		Table<K, T>* table = (*data_)[hash];
+		if (table == nullptr)
+		{
+			table = new LinkedTable<K, T>();
+			(*data_)[hash] = table;
+		}
+		return table;
+	}
+
 	template<typename K, typename T>
 	inline HashTable<K, T>::HashTableIterator::HashTableIterator(const HashTable<K, T>* hashTable, int position):
 		Iterator<TableItem<K, T>*>(),
@@ -10,7 +10,7 @@ namespace structures
 	/// <typeparam name = "K"> Kluc prvkov v tabulke. </typepram>
 	/// <typeparam name = "T"> Typ dat ukladanych v tabulke. </typepram>
 	template <typename K, typename T>
-	class LinkedTable : public SequenceTable<K, T>
+	class LinkedTable final : public SequenceTable<K, T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
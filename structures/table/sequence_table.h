@@ -25,6 +25,10 @@ namespace structures
 		/// <returns> Pocet prvkov v tabulke. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru tabulka obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru tabulka obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Tabulka, z ktorej ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tato tabulka nachadza po priradeni. </returns>
@@ -53,6 +57,12 @@ namespace structures
 		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
 		void insert(const K& key, const T& data) override;
 
+		/// <summary> Vlozi data s danym klucom do tabulky. Data do tabulky presunie. </summary>
+		/// <param name = "key"> Kluc vkladanych dat. </param>
+		/// <param name = "data"> Vkladane data. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
+		void insert(const K& key, T&& data) override;
+
 		/// <summary> Odstrani z tabulky prvok s danym klucom. </summary>
 		/// <param name = "key"> Kluc prvku. </param>
 		/// <returns> Odstranene data. </returns>
@@ -95,6 +105,11 @@ namespace structures
 		/// <param name = "key"> Hladany kluc. </param>
 		/// <returns> Prvok tabulky s danym klucom, ak neexistuje, vrati nullptr. </returns>
 		virtual TableItem<K, T>* findTableItem(const K& key) const;
+
+		/// <summary> Zaradi vytvoreny prvok do tabulky. </summary>
+		/// <param name = "item"> Zaradovany prvok. Tabulka ho prebera do vlastnictva. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. Prvok je vtedy zruseny. </exception>  
+		virtual void insertItem(TableItem<K, T>* item);
 	protected:
 		List<TableItem<K, T>*>* list_;
 	};
@@ -113,6 +128,15 @@ namespace structures
 		return list_->size();
 	}
 
+	template<typename K, typename T>
+	inline MemoryUsage SequenceTable<K, T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(SequenceTable<K, T>));
+		result.addAllocation(list_->memoryUsage());
+		result.addAllocations(sizeof(TableItem<K, T>), this->size());
+		return result;
+	}
+
 	template<typename K, typename T>
 	inline Table<K, T>& SequenceTable<K, T>::operator=(const Table<K, T>& other)
 	{
@@ -168,14 +192,13 @@ namespace structures
 	template<typename K, typename T>
 	inline void SequenceTable<K, T>::insert(const K & key, const T & data)
 	{
-		if (!containsKey(key))
-		{
-			list_->add(new TableItem<K, T>(key, data));
-		}
-		else
-		{
-			throw std::logic_error("SequenceTable<K, T>::insert: Key already present in table!");
-		}
+		insertItem(new TableItem<K, T>(key, data));
+	}
+
+	template<typename K, typename T>
+	inline void SequenceTable<K, T>::insert(const K & key, T && data)
+	{
+		insertItem(new TableItem<K, T>(key, std::move(data)));
 	}
 
 	template<typename K, typename T>
@@ -185,7 +208,7 @@ namespace structures
 		if (tableItem != nullptr)
 		{
 			list_->tryRemove(tableItem);
-			T result = tableItem->accessData();
+			T result = std::move(tableItem->accessData());
 			delete tableItem;
 			return result;
 		}
@@ -213,8 +236,7 @@ namespace structures
 	template<typename K, typename T>
 	inline bool SequenceTable<K, T>::containsKey(const K & key)
 	{
-		T data;
-		return tryFind(key, data);
+		return findTableItem(key) != nullptr;
 	}
 
 	template<typename K, typename T>
@@ -246,6 +268,20 @@ namespace structures
 	{
 	}
 
+	template<typename K, typename T>
+	inline void SequenceTable<K, T>::insertItem(TableItem<K, T>* item)
+	{
+		if (!containsKey(item->getKey()))
+		{
+			list_->add(item);
+		}
+		else
+		{
+			delete item;
+			throw std::logic_error("SequenceTable<K, T>::insert: Key already present in table!");
+		}
+	}
+
 	template<typename K, typename T>
 	inline TableItem<K, T>* SequenceTable<K, T>::findTableItem(const K & key) const
 	{
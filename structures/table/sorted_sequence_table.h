@@ -10,7 +10,7 @@ namespace structures
 	/// <typeparam name = "K"> Kluc prvkov v tabulke. </typepram>
 	/// <typeparam name = "T"> Typ dat ukladanych v tabulke. </typepram>
 	template <typename K, typename T>
-	class SortedSequenceTable : public SequenceTable<K, T>
+	class SortedSequenceTable final : public SequenceTable<K, T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -23,17 +23,16 @@ namespace structures
 		/// <summary> Operacia klonovania. Vytvori a vrati duplikat udajovej struktury. </summary>
 		/// <returns> Ukazovatel na klon struktury. </returns>
 		Structure* clone() const override;
-
-		/// <summary> Vlozi data s danym klucom do tabulky. </summary>
-		/// <param name = "key"> Kluc vkladanych dat. </param>
-		/// <param name = "data"> Vkladane data. </param>
-		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
-		void insert(const K& key, const T& data) override;
 	protected:
 		/// <summary> Najde prvok tabulky s danym klucom. </summary>
 		/// <param name = "key"> Hladany kluc. </param>
 		/// <returns> Prvok tabulky s danym klucom, ak neexistuje, vrati nullptr. </returns>
 		TableItem<K, T>* findTableItem(const K& key) const override;
+
+		/// <summary> Zaradi vytvoreny prvok do tabulky na miesto dane jeho klucom. </summary>
+		/// <param name = "item"> Zaradovany prvok. Tabulka ho prebera do vlastnictva. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. Prvok je vtedy zruseny. </exception>  
+		void insertItem(TableItem<K, T>* item) override;
 	private:
 		/// <summary> Najde index prvku s danym klucom. Kontroluje rozsah [indexStart, indexEnd). Pracuje na principe bisekcie. </summary>
 		/// <param name = "key"> Hladany kluc. </param>
@@ -64,16 +63,17 @@ namespace structures
 	}
 
 	template<typename K, typename T>
-	inline void SortedSequenceTable<K, T>::insert(const K & key, const T & data)
+	inline void SortedSequenceTable<K, T>::insertItem(TableItem<K, T>* item)
 	{
 		bool found = false;
-		int index = indexOfKey(key, 0, static_cast<int>(this->size()), found);
+		int index = indexOfKey(item->getKey(), 0, static_cast<int>(this->size()), found);
 		if (!found)
 		{
-			this->list_->insert(new TableItem<K, T>(key, data), index);
+			this->list_->insert(item, index);
 		}
 		else
 		{
+			delete item;
 			throw std::logic_error("SortedSequenceTable<K, T>::insert: Key already present in table!");
 		}
 	}
@@ -103,7 +103,7 @@ namespace structures
 			return indexSize;
 		}
 		int pivot = (indexStart + indexEnd) / 2;
-		K keyAtPivot = (*this->list_)[pivot]->getKey();
+		const K& keyAtPivot = (*this->list_)[pivot]->getKey();
 		if (keyAtPivot == key)
 		{
 			found = true;
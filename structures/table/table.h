@@ -15,11 +15,16 @@ namespace structures
 		/// <summary> Konstruktor. </summary>
 		/// <param name = "key"> Kluc prvku. </param>
 		/// <param name = "data"> Data, ktore uchovava. </param>
-		TableItem(K key, T data);
+		TableItem(const K& key, const T& data);
+
+		/// <summary> Konstruktor. Data do prvku presunie. </summary>
+		/// <param name = "key"> Kluc prvku. </param>
+		/// <param name = "data"> Data, ktore uchovava. </param>
+		TableItem(const K& key, T&& data);
 
 		/// <summary> Getter atributu kluc. </summary>
-		/// <returns> Kluc. </returns>
-		K getKey();
+		/// <returns> Konstantna referencia na kluc. </returns>
+		const K& getKey() const;
 	private:
 		/// <summary> Kluc prvku. </summary>
 		K key_;
@@ -70,6 +75,20 @@ namespace structures
 		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
 		virtual void insert(const K& key, const T& data) = 0;
 
+		/// <summary> Vlozi data s danym klucom do tabulky. Data do tabulky presunie. </summary>
+		/// <param name = "key"> Kluc vkladanych dat. </param>
+		/// <param name = "data"> Vkladane data. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
+		virtual void insert(const K& key, T&& data) = 0;
+
+		/// <summary> Vytvori data z argumentov a vlozi ich s danym klucom do tabulky. </summary>
+		/// <param name = "key"> Kluc vkladanych dat. </param>
+		/// <param name = "args"> Argumenty konstruktora vkladanych dat. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
+		/// <remarks> Data sa vytvoria raz a do tabulky sa presunu, nekopiruju sa. </remarks>
+		template<typename... Args>
+		void emplace(const K& key, Args&&... args);
+
 		/// <summary> Odstrani z tabulky prvok s danym klucom. </summary>
 		/// <param name = "key"> Kluc prvku. </param>
 		/// <returns> Odstranene data. </returns>
@@ -105,14 +124,21 @@ namespace structures
 	};
 
 	template<typename K, typename T>
-	inline TableItem<K, T>::TableItem(K key, T data):
+	inline TableItem<K, T>::TableItem(const K& key, const T& data):
 		DataItem<T>(data),
 		key_(key)
 	{
 	}
 
 	template<typename K, typename T>
-	inline K TableItem<K, T>::getKey()
+	inline TableItem<K, T>::TableItem(const K& key, T&& data):
+		DataItem<T>(std::move(data)),
+		key_(key)
+	{
+	}
+
+	template<typename K, typename T>
+	inline const K& TableItem<K, T>::getKey() const
 	{
 		return key_;
 	}
@@ -134,5 +160,12 @@ namespace structures
 		return *this;
 	}
 
+	template<typename K, typename T>
+	template<typename... Args>
+	inline void Table<K, T>::emplace(const K& key, Args&&... args)
+	{
+		this->insert(key, T(std::forward<Args>(args)...));
+	}
+
 }
 
@@ -16,11 +16,17 @@ namespace structures
 		/// <param name = "key"> Kluc prvku. </param>
 		/// <param name = "data"> Data, ktore uchovava. </param>
 		/// <param name = "priority"> Priorita. </param>
-		TreapItem(K key, T data, int priority);
+		TreapItem(const K& key, const T& data, int priority);
+
+		/// <summary> Konstruktor. Data do prvku presunie. </summary>
+		/// <param name = "key"> Kluc prvku. </param>
+		/// <param name = "data"> Data, ktore uchovava. </param>
+		/// <param name = "priority"> Priorita. </param>
+		TreapItem(const K& key, T&& data, int priority);
 
 		/// <summary> Getter atributu priorita. </summary>
 		/// <returns> Priorita. </returns>
-		int getPriority();
+		int getPriority() const;
 
 		/// <summary> Nastavi minimalnu prioritu. </summary>
 		void minimizePriority();
@@ -33,7 +39,7 @@ namespace structures
 	/// <typeparam name = "K"> Kluc prvkov v tabulke. </typepram>
 	/// <typeparam name = "T"> Typ dat ukladanych v tabulke. </typepram>
 	template <typename K, typename T>
-	class Treap : public BinarySearchTree<K, T>
+	class Treap final : public BinarySearchTree<K, T>
 	{
 	public:
 		typedef typename BinaryTreeNode<TableItem<K, T>*> BSTTreeNode;
@@ -52,6 +58,10 @@ namespace structures
 		/// <returns> Ukazovatel na klon struktury. </returns>
 		Structure* clone() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru treap obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru treap obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Binarny vyhladavaci strom, z ktoreho ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tato tabulka nachadza po priradeni. </returns>
@@ -68,16 +78,32 @@ namespace structures
 		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
 		void insert(const K& key, const T& data) override;
 
+		/// <summary> Vlozi data s danym klucom do tabulky. Data do tabulky presunie. </summary>
+		/// <param name = "key"> Kluc vkladanych dat. </param>
+		/// <param name = "data"> Vkladane data. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. </exception>  
+		void insert(const K& key, T&& data) override;
+
 		/// <summary> Odstrani z tabulky prvok s danym klucom. </summary>
 		/// <param name = "key"> Kluc prvku. </param>
 		/// <returns> Odstranene data. </returns>
 		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka neobsahuje data s takymto klucom. </exception>  
 		T remove(const K& key) override;
 
+	protected:
+		/// <summary> Zrusi prvok treap-u. </summary>
+		/// <param name = "item"> Ruseny prvok, musi byt typu TreapItem. </param>
+		void deleteItem(TableItem<K, T>* item) override;
+
 	private:
 		/// <summary> Generator nahodnej priority. </summary>
 		std::default_random_engine* generator_;
 
+		/// <summary> Vlozi prvok treap-u do stromu a obnovi haldove usporiadanie. </summary>
+		/// <param name = "item"> Vkladany prvok. Treap ho prebera do vlastnictva. </param>
+		/// <exception cref="std::logic_error"> Vyhodena, ak tabulka uz obsahuje data s takymto klucom. Prvok je vtedy zruseny. </exception>  
+		void insertTreapItem(TreapItem<K, T>* item);
+
 		/// <summary> Skontroluje, ci je haldove usporiadanie prvkov okolo vrcholu OK. </summary>
 		/// <param name = "node"> Vrchol, ktoreho susedstvo sa kontroluje. </param>
 		/// <returns> true, ak je haldove usporiadanie prvkov okolo vrcholu OK, false inak. </returns>
@@ -110,14 +136,21 @@ namespace structures
 	};
 
 	template<typename K, typename T>
-	inline TreapItem<K, T>::TreapItem(K key, T data, int priority):
+	inline TreapItem<K, T>::TreapItem(const K& key, const T& data, int priority):
 		TableItem<K, T>(key, data),
 		priority_(priority)
 	{
 	}
 
 	template<typename K, typename T>
-	inline int TreapItem<K, T>::getPriority()
+	inline TreapItem<K, T>::TreapItem(const K& key, T&& data, int priority):
+		TableItem<K, T>(key, std::move(data)),
+		priority_(priority)
+	{
+	}
+
+	template<typename K, typename T>
+	inline int TreapItem<K, T>::getPriority() const
 	{
 		return priority_;
 	}
@@ -155,6 +188,16 @@ namespace structures
 		return new Treap<K, T>(*this);
 	}
 
+	template<typename K, typename T>
+	inline MemoryUsage Treap<K, T>::memoryUsage() const
+	{
+		MemoryUsage result = BinarySearchTree<K, T>::memoryUsage();
+		result.bytesOwned += sizeof(Treap<K, T>) - sizeof(BinarySearchTree<K, T>);
+		result.bytesOwned += (sizeof(TreapItem<K, T>) - sizeof(TableItem<K, T>)) * this->size();
+		result.addAllocations(sizeof(std::default_random_engine));
+		return result;
+	}
+
 	template<typename K, typename T>
 	inline BinarySearchTree<K, T>& Treap<K, T>::operator=(const BinarySearchTree<K, T>& other)
 	{
@@ -175,11 +218,23 @@ namespace structures
 	template<typename K, typename T>
 	inline void Treap<K, T>::insert(const K & key, const T & data)
 	{
-		BSTTreeNode* newNode = new BinaryTreeNode<TableItem<K, T>*>(new TreapItem<K, T>(key, data, (*generator_)()));
+		insertTreapItem(new TreapItem<K, T>(key, data, (*generator_)()));
+	}
+
+	template<typename K, typename T>
+	inline void Treap<K, T>::insert(const K & key, T && data)
+	{
+		insertTreapItem(new TreapItem<K, T>(key, std::move(data), (*generator_)()));
+	}
+
+	template<typename K, typename T>
+	inline void Treap<K, T>::insertTreapItem(TreapItem<K, T>* item)
+	{
+		BSTTreeNode* newNode = new BinaryTreeNode<TableItem<K, T>*>(item);
 
 		if (!this->tryToInsertNode(newNode))
 		{
-			delete newNode->accessData();
+			this->deleteItem(newNode->accessData());
 			delete newNode;
 			throw std::logic_error("BinarySearchTree<K, T>::insert: Unable to insert!");
 		}
@@ -206,6 +261,12 @@ namespace structures
 		throw std::exception("Treap<K, T>::remove: Not implemented yet.");
 	}
 
+	template<typename K, typename T>
+	inline void Treap<K, T>::deleteItem(TableItem<K, T>* item)
+	{
+		delete static_cast<TreapItem<K, T>*>(item);
+	}
+
 	template<typename K, typename T>
 	inline bool Treap<K, T>::isHeapOK(typename BinarySearchTree<K, T>::BSTTreeNode* node)
 	{
@@ -226,7 +287,7 @@ namespace structures
 	template<typename K, typename T>
 	inline int Treap<K, T>::extractPriority(typename BinarySearchTree<K, T>::BSTTreeNode * node)
 	{
-		return node == nullptr ? INT_MIN : dynamic_cast<TreapItem<K, T>*>(node->accessData())->getPriority();
+		return node == nullptr ? INT_MIN : static_cast<TreapItem<K, T>*>(node->accessData())->getPriority();
 	}
 
 	template<typename K, typename T>
@@ -14,7 +14,7 @@ namespace structures
 	public:
 		/// <summary> Konstruktor. </summary>
 		/// <param name = "data"> Data, ktore uchovava. </param>
-		BinaryTreeNode(T data);
+		BinaryTreeNode(const T& data);
 
 		/// <summary> Kopirovaci konstruktor. </summary>
 		/// <param name = "other"> Vrchol binarneho stromu, z ktoreho sa prevezmu vlastnosti. </param>
@@ -88,7 +88,7 @@ namespace structures
 	/// <summary> Binary strom. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v strome. </typepram>
 	template <typename T>
-	class BinaryTree : public KWayTree<T,2>
+	class BinaryTree final : public KWayTree<T,2>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -131,7 +131,7 @@ namespace structures
 	};
 
 	template<typename T>
-	inline BinaryTreeNode<T>::BinaryTreeNode(T data):
+	inline BinaryTreeNode<T>::BinaryTreeNode(const T& data):
 		KWayTreeNode<T, 2>(data)
 	{
 	}
@@ -14,7 +14,7 @@ namespace structures
 	public:
 		/// <summary> Konstruktor. </summary>
 		/// <param name = "data"> Data, ktore uchovava. </param>
-		KWayTreeNode(T data);
+		KWayTreeNode(const T& data);
 
 		/// <summary> Kopirovaci konstruktor. </summary>
 		/// <param name = "other"> Vrchol k-cestneho stromu, z ktoreho sa prevezmu vlastnosti. </param>
@@ -65,6 +65,10 @@ namespace structures
 		/// <summary> Vrati pocet neNULLovych synov. </summary>
 		/// <returns> Pocet neNULLovych synov. </returns>
 		int numberOfSons();
+
+		/// <summary> Vrati udaje o pamati obsadenej vrcholom bez jeho synov. </summary>
+		/// <returns> Udaje o pamati obsadenej vrcholom, prazdne miesta pre synov su nevyuzita pamat. </returns>
+		MemoryUsage memoryUsageOfNode() override;
 	protected:
 		/// <summary> Synova vrchola. </summary>
 		Array<KWayTreeNode<T, K>*>* children_;
@@ -95,7 +99,7 @@ namespace structures
 
 
 	template<typename T, int K>
-	inline KWayTreeNode<T, K>::KWayTreeNode(T data):
+	inline KWayTreeNode<T, K>::KWayTreeNode(const T& data):
 		TreeNode<T>(data),
 		children_(new Array<KWayTreeNode<T, K>*>(K))
 	{
@@ -185,7 +189,7 @@ namespace structures
 	template<typename T, int K>
 	inline int KWayTreeNode<T, K>::numberOfSons()
 	{
-		int sum;
+		int sum = 0;
 		for (size_t i = 0; i < K; i++)
 		{
 			if ((*children_)[i] != nullptr)
@@ -196,6 +200,16 @@ namespace structures
 		return sum;
 	}
 
+	template<typename T, int K>
+	inline MemoryUsage KWayTreeNode<T, K>::memoryUsageOfNode()
+	{
+		MemoryUsage result;
+		result.addAllocations(sizeof(KWayTreeNode<T, K>));
+		result.addAllocation(children_->memoryUsage());
+		result.bytesWasted += (K - numberOfSons()) * sizeof(KWayTreeNode<T, K>*);
+		return result;
+	}
+
 	template<typename T, int K>
 	inline KWayTree<T, K>::KWayTree():
 		Tree<T>()
@@ -2,7 +2,7 @@
 
 #include "tree.h"
 #include "../list/list.h"
-#include "../list/array_list.h"
+#include "../list/small_array_list.h"
 
 namespace structures
 {
@@ -14,7 +14,7 @@ namespace structures
 	public:
 		/// <summary> Konstruktor. </summary>
 		/// <param name = "data"> Data, ktore uchovava. </param>
-		MultiWayTreeNode(T data);
+		MultiWayTreeNode(const T& data);
 
 		/// <summary> Kopirovaci konstruktor. </summary>
 		/// <param name = "other"> Vrchol viaccestneho stromu, z ktoreho sa prevezmu vlastnosti. </param>
@@ -61,15 +61,20 @@ namespace structures
 		/// <summary> Vrati pocet synov vrcholu. </summary>
 		/// <returns> Vzdy K. </returns>
 		int degree() override;
+
+		/// <summary> Vrati udaje o pamati obsadenej vrcholom bez jeho synov. </summary>
+		/// <returns> Udaje o pamati obsadenej vrcholom. </returns>
+		MemoryUsage memoryUsageOfNode() override;
 	protected:
 		/// <summary> Synova vrchola. </summary>
+		/// <remarks> Vacsina vrcholov ma len par synov, tych prvych 4 sa ulozi bez alokacie pola. </remarks>
 		List<MultiWayTreeNode<T>*>* children_;
 	};
 
 	/// <summary> Viaccestny strom. </summary>
 	/// <typeparam name = "T"> Typ dat ukladanych v strome. </typepram>
 	template <typename T>
-	class MultiWayTree : public Tree<T>
+	class MultiWayTree final : public Tree<T>
 	{
 	public:
 		/// <summary> Konstruktor. </summary>
@@ -90,16 +95,16 @@ namespace structures
 
 
 	template<typename T>
-	inline MultiWayTreeNode<T>::MultiWayTreeNode(T data) :
+	inline MultiWayTreeNode<T>::MultiWayTreeNode(const T& data) :
 		TreeNode<T>(data),
-		children_(new ArrayList<MultiWayTreeNode<T>*>())
+		children_(new SmallArrayList<MultiWayTreeNode<T>*, 4>())
 	{
 	}
 
 	template<typename T>
 	inline MultiWayTreeNode<T>::MultiWayTreeNode(const MultiWayTreeNode<T>& other) :
 		TreeNode<T>(other),
-		children_(dynamic_cast<ArrayList<MultiWayTreeNode<T>*>*>(other.children_->clone()))
+		children_(dynamic_cast<SmallArrayList<MultiWayTreeNode<T>*, 4>*>(other.children_->clone()))
 	{
 	}
 
@@ -163,6 +168,15 @@ namespace structures
 		return children_->size();
 	}
 
+	template<typename T>
+	inline MemoryUsage MultiWayTreeNode<T>::memoryUsageOfNode()
+	{
+		MemoryUsage result;
+		result.addAllocations(sizeof(MultiWayTreeNode<T>));
+		result.addAllocation(children_->memoryUsage());
+		return result;
+	}
+
 	template<typename T>
 	inline MultiWayTree<T>::MultiWayTree() :
 		Tree<T>()
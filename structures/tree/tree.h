@@ -12,6 +12,10 @@ namespace structures
 	class TreeNode : public DataItem<T>
 	{
 	public:
+		/// <summary> Destruktor. </summary>
+		/// <remarks> Je virtualny, pretoze vrcholy su rusene cez smernik na TreeNode. </remarks>
+		virtual ~TreeNode();
+
 		/// <summary> Vytvori plytku kopiu vrchola (teda skopiruje iba data a smerniky na synov). </summary>
 		/// <returns> Vystvorena plytka kopia vrcholu. </returns>
 		virtual TreeNode<T>* shallowCopy() = 0;
@@ -84,10 +88,18 @@ namespace structures
 		/// <summary> Vrati pocet vrcholov v podstrome. </summary>
 		/// <returns> Pocet vrcholov v podstrome. </returns>
 		virtual size_t sizeOfSubtree();
+
+		/// <summary> Vrati udaje o pamati obsadenej vrcholom bez jeho synov. </summary>
+		/// <returns> Udaje o pamati obsadenej vrcholom, vratane alokacie samotneho vrcholu. </returns>
+		virtual MemoryUsage memoryUsageOfNode() = 0;
+
+		/// <summary> Vrati udaje o pamati obsadenej vsetkymi vrcholmi podstromu. </summary>
+		/// <returns> Udaje o pamati obsadenej vsetkymi vrcholmi podstromu. </returns>
+		virtual MemoryUsage memoryUsageOfSubtree();
 	protected:
 		/// <summary> Konstruktor. </summary>
 		/// <param name = "data"> Data, ktore uchovava. </param>
-		TreeNode(T data);
+		TreeNode(const T& data);
 
 		/// <summary> Kopirovaci konstruktor. </summary>
 		/// <param name = "other"> Vrchol stromu, z ktoreho sa prevezmu vlastnosti. </param>
@@ -118,6 +130,10 @@ namespace structures
 		/// <returns> Pocet vrcholov v strome. </returns>
 		virtual size_t size() const;
 
+		/// <summary> Vrati udaje o pamati, ktoru strom obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru strom obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Struktura (strom), z ktorej ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento strom nachadza po priradeni. </returns>
@@ -310,7 +326,22 @@ namespace structures
 	}
 
 	template<typename T>
-	inline TreeNode<T>::TreeNode(T data):
+	inline MemoryUsage TreeNode<T>::memoryUsageOfSubtree()
+	{
+		MemoryUsage result = memoryUsageOfNode();
+		for (int i = 0; i < degree(); i++)
+		{
+			TreeNode<T>* son = getSon(i);
+			if (son != nullptr)
+			{
+				result += son->memoryUsageOfSubtree();
+			}
+		}
+		return result;
+	}
+
+	template<typename T>
+	inline TreeNode<T>::TreeNode(const T& data):
 		DataItem<T>(data),
 		parent_(nullptr)
 	{
@@ -322,6 +353,12 @@ namespace structures
 		parent_(other.parent_)
 	{
 	}
+
+	template<typename T>
+	inline TreeNode<T>::~TreeNode()
+	{
+		parent_ = nullptr;
+	}
   
 	template<typename T>
 	inline Tree<T>::~Tree()
@@ -341,6 +378,17 @@ namespace structures
 		return isEmpty() ? 0 : root_->sizeOfSubtree();
 	}
 
+	template<typename T>
+	inline MemoryUsage Tree<T>::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(Tree<T>));
+		if (root_ != nullptr)
+		{
+			result += root_->memoryUsageOfSubtree();
+		}
+		return result;
+	}
+
 	template<typename T>
 	inline Iterator<T>* Tree<T>::getBeginIterator() const
 	{
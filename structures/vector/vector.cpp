@@ -34,6 +34,16 @@ namespace structures {
 		return size_;
 	}
 
+	MemoryUsage Vector::memoryUsage() const
+	{
+		MemoryUsage result(sizeof(Vector));
+		if (this->memory_ != nullptr)
+		{
+			result.addAllocations(this->size_);
+		}
+		return result;
+	}
+
 	Structure& Vector::operator=(const Structure& other)
 	{
 		if (this != &other)
@@ -1,13 +1,13 @@
 #pragma once
 
-#include "../Structure.h"
+#include "../structure.h"
 #include "../ds_structure_types.h"
 #include <stdexcept>
 
 namespace structures {
 	
 	/// <summary> Vektor. </summary>
-	class Vector : public Structure
+	class Vector final : public Structure
 	{		
 	public:
 		/// <summary> Konstruktor vytvori vektor o velkosti size bytov. </summary>
@@ -29,6 +29,10 @@ namespace structures {
 		/// <returns> Pocet bytov vo vektore. </returns>
 		size_t size() const override;
 
+		/// <summary> Vrati udaje o pamati, ktoru vektor obsadzuje. </summary>
+		/// <returns> Udaje o pamati, ktoru vektor obsadzuje. </returns>
+		MemoryUsage memoryUsage() const override;
+
 		/// <summary> Operator priradenia. </summary>
 		/// <param name = "other"> Struktura (vektor), z ktorej ma prebrat vlastnosti. </param>
 		/// <returns> Adresa, na ktorej sa tento vektor nachadza po priradeni. </returns>
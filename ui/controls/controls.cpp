@@ -509,6 +509,12 @@ namespace ui {
 
 	void ActionStructureSize::doPresentResult()
 	{
+		structures::MemoryUsage memory = Controls->Structure->memoryUsage();
+		Logger::getInstance()->logHint("Memory: " + 
+			System::Convert::ToString(memory.bytesOwned) + " B owned, " + 
+			System::Convert::ToString(memory.bytesWasted) + " B wasted, " + 
+			System::Convert::ToString(memory.allocations) + " allocations, " + 
+			System::Convert::ToString(memory.bytesPerElement(result_)) + " B per element.");
 		data::DataRoutines::showNumber(static_cast<int>(result_), Caption);
 	}
 
@@ -64,12 +64,20 @@ namespace ui {
 
 			case structures::StructureADS::adsLIST_ARRAY:
 				return "Array list";
+			case structures::StructureADS::adsLIST_SMALL_ARRAY:
+				return "Small array list";
 			case structures::StructureADS::adsLIST_LINKED:
 				return "Linked list";
 			case structures::StructureADS::adsLIST_DOUBLE_LINKED:
 				return "Double-linked list";
 			case structures::StructureADS::adsLIST_CYCLICAL:
 				return "Cyclical list";
+			case structures::StructureADS::adsLIST_UNROLLED:
+				return "Unrolled linked list";
+			case structures::StructureADS::adsLIST_ROPE:
+				return "Rope list";
+			case structures::StructureADS::adsLIST_TIERED_VECTOR:
+				return "Tiered vector list";
 
 			case structures::StructureADS::adsQUEUE_ARRAY:
 				return "Queue by array";
@@ -80,6 +88,8 @@ namespace ui {
 				return "Stack by array";
 			case structures::StructureADS::adsSTACK_LIST:
 				return "Stack by list";
+			case structures::StructureADS::adsSTACK_SEGMENTED:
+				return "Stack by segmented array";
 
 			case structures::StructureADS::adsPRIORITY_QUEUE_ARRAY_LIST_SORTED:
 				return "Priority queue by sorted array list";
@@ -93,6 +103,12 @@ namespace ui {
 				return "Priority queue double layer implementation";
 			case structures::StructureADS::adsPRIORITY_QUEUE_HEAP:
 				return "Heap";
+			case structures::StructureADS::adsPRIORITY_QUEUE_PAIRING_HEAP:
+				return "Pairing heap";
+			case structures::StructureADS::adsPRIORITY_QUEUE_RADIX_HEAP:
+				return "Radix heap (monotone)";
+			case structures::StructureADS::adsPRIORITY_QUEUE_BUCKET_QUEUE:
+				return "Bucket queue (monotone)";
 
 			case structures::StructureADS::adsTREE_MULTI_WAY:
 				return "Multi way tree";